@@ -0,0 +1,361 @@
+//
+// BlockCompressor.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "BlockCompressor.h"
+#include "WorkerPool.h"
+#include <cmath>
+#include <cstring>
+
+
+typedef uint8_t		Texel[4];		// RGBA
+
+size_t BlockCompressor::CompressedSize(uint32_t width, uint32_t height, TextureCompression compression)
+{
+	return (size_t) ((width + 3) / 4) * ((height + 3) / 4) * BlockBytes(compression);
+}
+
+static int clampByte(int value)		{ return value < 0 ? 0 : value > 255 ? 255 : value; }
+
+
+// BC7 (MODE 6)
+
+static const int BC7Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+struct BC7Endpoints {
+	int		quantized[2][4];	// 7 bits per channel,
+	int		pBit[2];			//	plus one shared "parity" bit (the low bit) per endpoint
+	int		expanded[2][4];		// (8-bit values they stand for)
+};
+
+static void quantizeEndpoint(const float value[4], int pBit, int quantized[4], int expanded[4])
+{
+	for (int c = 0; c < 4; ++c) {
+		quantized[c] = std::min(127, std::max(0, (int) lroundf((value[c] - pBit) / 2)));
+		expanded[c] = quantized[c] << 1 | pBit;
+	}
+}
+
+// Each texel's nearest of the 16 colors between the endpoints, and the total squared error.  Projecting onto
+//	the line between them lands next to it; the rounding either way is checked to be sure.
+//
+static int chooseIndices(const Texel texels[16], const BC7Endpoints& endpoints, uint8_t indices[16])
+{
+	int palette[16][4];
+	for (int i = 0; i < 16; ++i)
+		for (int c = 0; c < 4; ++c)
+			palette[i][c] = ((64 - BC7Weights[i]) * endpoints.expanded[0][c] + BC7Weights[i] * endpoints.expanded[1][c] + 32) >> 6;
+	int direction[4], lengthSquared = 0;
+	for (int c = 0; c < 4; ++c) {
+		direction[c] = endpoints.expanded[1][c] - endpoints.expanded[0][c];
+		lengthSquared += direction[c] * direction[c];
+	}
+
+	int totalError = 0;
+	for (int iTexel = 0; iTexel < 16; ++iTexel) {
+		int guess = 0;
+		if (lengthSquared > 0) {
+			int along = 0;
+			for (int c = 0; c < 4; ++c)
+				along += (texels[iTexel][c] - endpoints.expanded[0][c]) * direction[c];
+			float weight = 64.0f * along / lengthSquared;
+			while (guess < 15 && (BC7Weights[guess] + BC7Weights[guess + 1]) < 2 * weight)
+				++guess;
+		}
+		int bestError = INT32_MAX;
+		for (int index = std::max(0, guess - 1); index <= std::min(15, guess + 1); ++index) {
+			int error = 0;
+			for (int c = 0; c < 4; ++c) {
+				int difference = palette[index][c] - texels[iTexel][c];
+				error += difference * difference;
+			}
+			if (error < bestError) {
+				bestError = error;
+				indices[iTexel] = index;
+			}
+		}
+		totalError += bestError;
+	}
+	return totalError;
+}
+
+// Best of the four parity bit combinations for these (unquantized) endpoints.
+//
+static int quantizeEndpoints(const float ends[2][4], const Texel texels[16], BC7Endpoints& best, uint8_t indices[16])
+{
+	int bestError = INT32_MAX;
+	for (int pBits = 0; pBits < 4; ++pBits) {
+		BC7Endpoints endpoints;
+		uint8_t tryIndices[16];
+		for (int iEnd = 0; iEnd < 2; ++iEnd) {
+			endpoints.pBit[iEnd] = (pBits >> iEnd) & 1;
+			quantizeEndpoint(ends[iEnd], endpoints.pBit[iEnd], endpoints.quantized[iEnd], endpoints.expanded[iEnd]);
+		}
+		int error = chooseIndices(texels, endpoints, tryIndices);
+		if (error < bestError) {
+			bestError = error;
+			best = endpoints;
+			memcpy(indices, tryIndices, 16);
+		}
+	}
+	return bestError;
+}
+
+struct BitPacker {			// (least-significant bit first, as BC7 is laid out)
+	uint64_t	words[2] = { 0, 0 };
+	int			position = 0;
+
+	void put(uint32_t value, int numBits) {
+		for (int i = 0; i < numBits; ++i, ++position)
+			words[position / 64] |= (uint64_t) ((value >> i) & 1) << (position % 64);
+	}
+};
+
+static void encodeBC7(const Texel texels[16], uint8_t* pBlock)
+{
+	// Endpoints where the texels' extent along their principal axis (by power iteration) begins and ends.
+	float mean[4] = { };
+	for (int i = 0; i < 16; ++i)
+		for (int c = 0; c < 4; ++c)
+			mean[c] += texels[i][c] / 16.0f;
+	float covariance[4][4] = { };
+	for (int i = 0; i < 16; ++i)
+		for (int row = 0; row < 4; ++row)
+			for (int column = 0; column < 4; ++column)
+				covariance[row][column] += (texels[i][row] - mean[row]) * (texels[i][column] - mean[column]);
+	float axis[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+	for (int iteration = 0; iteration < 8; ++iteration) {
+		float next[4] = { }, largest = 0.0f;
+		for (int row = 0; row < 4; ++row) {
+			for (int column = 0; column < 4; ++column)
+				next[row] += covariance[row][column] * axis[column];
+			largest = std::max(largest, fabsf(next[row]));
+		}
+		if (largest == 0.0f)
+			break;
+		for (int c = 0; c < 4; ++c)
+			axis[c] = next[c] / largest;
+	}
+	float axisLengthSquared = 0.0f;
+	for (int c = 0; c < 4; ++c)
+		axisLengthSquared += axis[c] * axis[c];
+	float lowest = 0.0f, highest = 0.0f;
+	for (int i = 0; i < 16; ++i) {
+		float along = 0.0f;
+		for (int c = 0; c < 4; ++c)
+			along += (texels[i][c] - mean[c]) * axis[c];
+		along /= axisLengthSquared;
+		lowest = std::min(lowest, along);
+		highest = std::max(highest, along);
+	}
+	float ends[2][4];
+	for (int c = 0; c < 4; ++c) {
+		ends[0][c] = std::min(255.0f, std::max(0.0f, mean[c] + lowest * axis[c]));
+		ends[1][c] = std::min(255.0f, std::max(0.0f, mean[c] + highest * axis[c]));
+	}
+	BC7Endpoints endpoints;
+	uint8_t indices[16];
+	int error = quantizeEndpoints(ends, texels, endpoints, indices);
+
+	// Then refit them to the indices chosen (least squares), keeping that if better.
+	if (error > 0) {
+		float a = 0.0f, b = 0.0f, d = 0.0f, towardFirst[4] = { }, towardSecond[4] = { };
+		for (int i = 0; i < 16; ++i) {
+			float weight = BC7Weights[indices[i]] / 64.0f;
+			a += (1 - weight) * (1 - weight);
+			b += (1 - weight) * weight;
+			d += weight * weight;
+			for (int c = 0; c < 4; ++c) {
+				towardFirst[c]	+= (1 - weight) * texels[i][c];
+				towardSecond[c]	+= weight * texels[i][c];
+			}
+		}
+		float determinant = a * d - b * b;
+		if (fabsf(determinant) > 1e-6f) {
+			float refit[2][4];
+			for (int c = 0; c < 4; ++c) {
+				refit[0][c] = std::min(255.0f, std::max(0.0f, (d * towardFirst[c] - b * towardSecond[c]) / determinant));
+				refit[1][c] = std::min(255.0f, std::max(0.0f, (a * towardSecond[c] - b * towardFirst[c]) / determinant));
+			}
+			BC7Endpoints refitEndpoints;
+			uint8_t refitIndices[16];
+			if (quantizeEndpoints(refit, texels, refitEndpoints, refitIndices) < error) {
+				endpoints = refitEndpoints;
+				memcpy(indices, refitIndices, 16);
+			}
+		}
+	}
+
+	// The first texel's index has its top bit left out (as zero), so flip the line if it'd be set.
+	if (indices[0] >= 8) {
+		std::swap(endpoints.quantized[0], endpoints.quantized[1]);
+		std::swap(endpoints.pBit[0], endpoints.pBit[1]);
+		for (int i = 0; i < 16; ++i)
+			indices[i] = 15 - indices[i];
+	}
+	BitPacker bits;
+	bits.put(1 << 6, 7);		// mode 6
+	for (int c = 0; c < 4; ++c) {
+		bits.put(endpoints.quantized[0][c], 7);
+		bits.put(endpoints.quantized[1][c], 7);
+	}
+	bits.put(endpoints.pBit[0], 1);
+	bits.put(endpoints.pBit[1], 1);
+	bits.put(indices[0], 3);
+	for (int i = 1; i < 16; ++i)
+		bits.put(indices[i], 4);
+	for (int i = 0; i < 16; ++i)
+		pBlock[i] = (uint8_t) (bits.words[i / 8] >> (8 * (i % 8)));
+}
+
+
+// ETC2 (ETC1-COMPATIBLE MODES)
+
+static const int EtcModifiers[8][2] = { { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 },
+										{ 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 } };
+
+struct EtcHalf {			// one half of a block, as encoded
+	int		base[3];			// (8-bit, as expanded from 4 or 5 bits)
+	int		table;
+	uint8_t	indices[8];			// (pixel index values: 0 and 1 add the table's two modifiers, 2 and 3 subtract)
+	int		error;
+};
+
+// The modifier table, and each texel's modifier from it, best fitting these texels to this base color.
+//
+static void fitEtcHalf(const Texel* texels[8], EtcHalf& half)
+{
+	half.error = INT32_MAX;
+	for (int table = 0; table < 8; ++table) {
+		int modifiers[4] = { EtcModifiers[table][0], EtcModifiers[table][1],
+							 -EtcModifiers[table][0], -EtcModifiers[table][1] };
+		int error = 0;
+		uint8_t indices[8];
+		for (int i = 0; i < 8 && error < half.error; ++i) {
+			int bestError = INT32_MAX;
+			for (int index = 0; index < 4; ++index) {
+				int texelError = 0;
+				for (int c = 0; c < 3; ++c) {
+					int difference = clampByte(half.base[c] + modifiers[index]) - (*texels[i])[c];
+					texelError += difference * difference;
+				}
+				if (texelError < bestError) {
+					bestError = texelError;
+					indices[i] = index;
+				}
+			}
+			error += bestError;
+		}
+		if (error < half.error) {
+			half.error = error;
+			half.table = table;
+			memcpy(half.indices, indices, 8);
+		}
+	}
+}
+
+static void encodeEtc2(const Texel texels[16], uint8_t* pBlock)
+{
+	uint64_t bestBlock = 0;
+	int bestError = INT32_MAX;
+	for (int isFlipped = 0; isFlipped <= 1; ++isFlipped) {		// halves side by side, or (flipped) one above the other
+		const Texel* halfTexels[2][8];
+		int pixelOf[2][8];				// (pixel number as the block numbers them: down each column, left to right)
+		float average[2][3] = { };
+		int numInHalf[2] = { };
+		for (int y = 0; y < 4; ++y)
+			for (int x = 0; x < 4; ++x) {
+				int iHalf = isFlipped ? (y >= 2) : (x >= 2);
+				int n = numInHalf[iHalf]++;
+				halfTexels[iHalf][n] = &texels[y * 4 + x];
+				pixelOf[iHalf][n] = x * 4 + y;
+				for (int c = 0; c < 3; ++c)
+					average[iHalf][c] += texels[y * 4 + x][c] / 8.0f;
+			}
+
+		for (int isDifferential = 0; isDifferential <= 1; ++isDifferential) {
+			int quantized[2][3];
+			EtcHalf halves[2];
+			for (int iHalf = 0; iHalf < 2; ++iHalf)
+				for (int c = 0; c < 3; ++c)
+					if (isDifferential) {	// 5 bits each, the second as a 3-bit difference from the first
+						quantized[iHalf][c] = (int) lroundf(average[iHalf][c] * 31 / 255);
+						halves[iHalf].base[c] = quantized[iHalf][c] << 3 | quantized[iHalf][c] >> 2;
+					} else {				// 4 bits each
+						quantized[iHalf][c] = (int) lroundf(average[iHalf][c] * 15 / 255);
+						halves[iHalf].base[c] = quantized[iHalf][c] * 17;
+					}
+			if (isDifferential) {
+				bool isInRange = true;
+				for (int c = 0; c < 3; ++c) {
+					int difference = quantized[1][c] - quantized[0][c];
+					isInRange = isInRange && difference >= -4 && difference <= 3;
+				}
+				if (! isInRange)
+					continue;
+			}
+			fitEtcHalf(halfTexels[0], halves[0]);
+			fitEtcHalf(halfTexels[1], halves[1]);
+			int error = halves[0].error + halves[1].error;
+			if (error >= bestError)
+				continue;
+			bestError = error;
+
+			uint64_t block = 0;
+			for (int c = 0; c < 3; ++c) {
+				int shift = 59 - 8 * c;		// (each color channel's byte, from the top)
+				if (isDifferential)
+					block |= (uint64_t) quantized[0][c] << shift | (uint64_t) ((quantized[1][c] - quantized[0][c]) & 7) << (shift - 3);
+				else
+					block |= (uint64_t) quantized[0][c] << (shift + 1) | (uint64_t) quantized[1][c] << (shift - 3);
+			}
+			block |= (uint64_t) halves[0].table << 37 | (uint64_t) halves[1].table << 34
+				   | (uint64_t) isDifferential << 33 | (uint64_t) isFlipped << 32;
+			for (int iHalf = 0; iHalf < 2; ++iHalf)
+				for (int i = 0; i < 8; ++i) {
+					int pixel = pixelOf[iHalf][i], index = halves[iHalf].indices[i];
+					block |= (uint64_t) (index >> 1) << (16 + pixel) | (uint64_t) (index & 1) << pixel;
+				}
+			bestBlock = block;
+		}
+	}
+	for (int i = 0; i < 8; ++i)		// (big-endian)
+		pBlock[i] = (uint8_t) (bestBlock >> (56 - 8 * i));
+}
+
+
+void BlockCompressor::Compress(const uint8_t* pRGBA, uint32_t width, uint32_t height, TextureCompression compression,
+							   uint8_t* pBlocks)
+{
+	if (compression == TEXTURE_UNCOMPRESSED) {
+		memcpy(pBlocks, pRGBA, (size_t) width * height * 4);
+		return;
+	}
+	uint32_t blocksWide = (width + 3) / 4, blocksHigh = (height + 3) / 4;
+	size_t blockBytes = BlockBytes(compression);
+	size_t rowsPerTask = std::max<size_t>(1, BLOCKS_PER_TASK / blocksWide);
+
+	WorkerPool::Shared().parallelFor((blocksHigh + rowsPerTask - 1) / rowsPerTask, [&](size_t iTask) {
+		size_t rowEnd = std::min<size_t>(blocksHigh, (iTask + 1) * rowsPerTask);
+		for (size_t blockY = iTask * rowsPerTask; blockY < rowEnd; ++blockY)
+			for (uint32_t blockX = 0; blockX < blocksWide; ++blockX) {
+				Texel texels[16];
+				for (uint32_t y = 0; y < 4; ++y)
+					for (uint32_t x = 0; x < 4; ++x) {
+						size_t imageX = std::min(blockX * 4 + x, width - 1);
+						size_t imageY = std::min<size_t>(blockY * 4 + y, height - 1);
+						memcpy(texels[y * 4 + x], &pRGBA[(imageY * width + imageX) * 4], 4);
+					}
+				uint8_t* pBlock = pBlocks + (blockY * blocksWide + blockX) * blockBytes;
+				if (compression == TEXTURE_BC7)
+					encodeBC7(texels, pBlock);
+				else
+					encodeEtc2(texels, pBlock);
+			}
+	});
+}
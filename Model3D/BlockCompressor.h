@@ -0,0 +1,51 @@
+//
+// BlockCompressor.h
+//	Vulkan Convenience 3D Objects
+//
+// CPU encoding of 8-bit RGBA images into GPU block-compressed formats, for
+//	TextureCache: each 4x4 texel block to 16 bytes of BC7 (desktop GPUs) or
+//	8 bytes of ETC2 RGB (mobile/embedded ones, e.g. Raspberry Pi's), a
+//	quarter or an eighth the memory and bandwidth of RGBA8.
+// Built for speed over ultimate quality, as it may run on first load:
+//	- BC7 uses only mode 6 (one RGBA line per block, 4-bit indices), its
+//		endpoints along the block's principal axis, then refit by least
+//		squares to the indices chosen.
+//	- ETC2 uses only its ETC1-compatible modes (the two halves of a block
+//		each a base color plus per-texel brightness offsets), trying both
+//		splits and both base color encodings, and is opaque only: a texture
+//		with alpha is left uncompressed instead (see TextureCache).
+// Blocks overhanging the edge of an image (or a mip level smaller than a
+//	block) repeat its last row and column.  Rows of blocks are spread across
+//	the shared WorkerPool.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef BlockCompressor_h
+#define BlockCompressor_h
+
+#include <cstdint>
+#include <cstddef>
+
+
+enum TextureCompression {
+	TEXTURE_UNCOMPRESSED,		// RGBA8
+	TEXTURE_BC7,
+	TEXTURE_ETC2				// (RGB; opaque textures only)
+};
+
+
+class BlockCompressor
+{
+public:
+	static size_t BlockBytes(TextureCompression compression)	{ return compression == TEXTURE_BC7 ? 16 : 8; }
+	static size_t CompressedSize(uint32_t width, uint32_t height, TextureCompression compression);
+
+	// 'pBlocks' needs CompressedSize bytes: rows of blocks, top to bottom, left to right within each.
+	static void Compress(const uint8_t* pRGBA, uint32_t width, uint32_t height, TextureCompression compression,
+						 uint8_t* pBlocks);
+
+	static const size_t BLOCKS_PER_TASK = 1024;
+};
+
+#endif	// BlockCompressor_h
@@ -7,33 +7,54 @@
 //
 // from `https://github.com/tinyobjloader/tinyobjloader.git`
 //
+#ifndef TINY_OBJ_LOADER_H_		// (same guard as the real one)
+#define TINY_OBJ_LOADER_H_
 
-class tinyobj
+#include <string>
+#include <vector>
+
+namespace tinyobj {			// (only what's used of the real one, declared as it declares them)
+
+typedef float real_t;
+
+struct attrib_t {
+	std::vector<real_t> vertices;
+	std::vector<real_t> normals;
+	std::vector<real_t> texcoords;
+	std::vector<real_t> colors;
+};
+
+struct index_t {
+	int vertex_index;
+	int normal_index;
+	int texcoord_index;
+};
+
+struct mesh_t {
+	std::vector<index_t> indices;
+	std::vector<int>	 material_ids;	// per face
+};
+
+struct shape_t {
+	std::string name;
+	mesh_t		mesh;
+};
+
+struct material_t {
+	std::string name;
+	real_t		diffuse[3];
+	std::string diffuse_texname;
+};
+
+inline bool LoadObj(attrib_t* /*attrib*/, std::vector<shape_t>* /*shapes*/, std::vector<material_t>* /*materials*/,
+					std::string* warn, std::string* err, const char* /*filename*/, const char* /*mtl_basedir*/ = NULL,
+					bool /*triangulate*/ = true, bool /*default_vcols_fallback*/ = true)
 {
-public:
-	struct attrib_t {
-		vector<float> vertices;
-		vector<float> normals;
-		vector<float> texcoords;
-		vector<float> colors;
-	};
-	struct index_t {
-		int vertex_index;
-		int normal_index;
-		int texcoord_index;
-	};
-	struct mesh_t {
-		vector<index_t> indices;
-	};
-	struct shape_t {
-		mesh_t mesh;
-	};
-	typedef int material_t;
-
-	static bool LoadObj(attrib_t* a, vector<shape_t>* s, vector<material_t>* m,
-						string* w, string* e, const char* c) {
-		*e = "The 'Model.OBJ' Loader is stubbed-out. Please see 'tiny_obj_loader.h' and download the real one!";
-		*w = "Thus you won't see the model actually display.";
-		return false;
-	};
-}; 
+	*err = "The 'Model.OBJ' Loader is stubbed-out. Please see 'tiny_obj_loader.h' and download the real one!";
+	*warn = "Thus you won't see the model actually display.";
+	return false;
+}
+
+}	// namespace tinyobj
+
+#endif	// TINY_OBJ_LOADER_H_
@@ -0,0 +1,266 @@
+//
+// FastObjParser.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "FastObjParser.h"
+#include "WorkerPool.h"
+#include "ObjTextParsing.h"
+#include <cstring>		// for memcpy
+
+
+// CHUNK-WISE PARSING
+
+struct ObjChunk {
+	const char* begin;
+	const char* end;
+
+	size_t numPositions = 0, numNormals = 0, numTexCoords = 0, numFaces = 0;	// this chunk only
+	size_t basePosition = 0, baseNormal = 0, baseTexCoord = 0;					// sum of all prior chunks
+
+	vector<float>		colors;			// allocated (local to chunk) only upon first color seen
+	vector<tinyobj::shape_t> shapes;	// first one continues whichever precedes chunk (so is unnamed)
+	vector<string>		materialNames;	// faces' material_ids index this (or are -1: whichever precedes)
+	int					lastMaterial = -1;
+	string				materialLibrary;
+	size_t				numLinesSkipped = 0;
+};
+
+static void countElements(ObjChunk& chunk)
+{
+	for (const char* p = chunk.begin; p < chunk.end; p = nextLine(p, chunk.end)) {
+		skipBlanks(p, chunk.end);
+		if (chunk.end - p < 2)
+			continue;
+		if (p[0] == 'v') {
+			if (isBlank(p[1]))		++chunk.numPositions;
+			else if (p[1] == 'n')	++chunk.numNormals;
+			else if (p[1] == 't')	++chunk.numTexCoords;
+		} else if (p[0] == 'f' && isBlank(p[1]))
+			++chunk.numFaces;
+	}
+}
+
+static void parseChunk(ObjChunk& chunk, tinyobj::attrib_t& attrib)
+{
+	const char* end = chunk.end;
+
+	float* pPosition = attrib.vertices.data()  + 3 * chunk.basePosition;
+	float* pNormal	 = attrib.normals.data()   + 3 * chunk.baseNormal;
+	float* pTexCoord = attrib.texcoords.data() + 2 * chunk.baseTexCoord;
+	size_t iPosition = 0, iNormal = 0, iTexCoord = 0;	// local counts so far
+
+	chunk.shapes.resize(1);
+	tinyobj::shape_t* pShape = &chunk.shapes.back();
+	pShape->mesh.indices.reserve(3 * chunk.numFaces);	// (assume mostly triangles; quads will grow it once)
+	pShape->mesh.material_ids.reserve(chunk.numFaces);
+	int iMaterial = -1;
+	vector<tinyobj::index_t> polygon;
+
+	for (const char* p = chunk.begin; p < end; p = nextLine(p, end)) {
+		skipBlanks(p, end);
+		if (end - p < 2)
+			continue;
+		bool isOK = true;
+
+		if (p[0] == 'v' && isBlank(p[1])) {
+			p += 2;
+			float* xyz = pPosition + 3 * iPosition;
+			isOK = parseFloat(p, end, xyz[0]) && parseFloat(p, end, xyz[1]) && parseFloat(p, end, xyz[2]);
+			float w, rgb[3];		// optional: either w (ignored) or vertex color r g b (a common extension)
+			if (isOK && parseFloat(p, end, w)) {
+				rgb[0] = w;
+				if (parseFloat(p, end, rgb[1]) && parseFloat(p, end, rgb[2])) {
+					if (chunk.colors.empty())
+						chunk.colors.resize(3 * chunk.numPositions, 1.0f);
+					memcpy(&chunk.colors[3 * iPosition], rgb, sizeof(rgb));
+				}
+			}
+			++iPosition;
+		}
+		else if (p[0] == 'v' && p[1] == 'n') {
+			p += 2;
+			float* xyz = pNormal + 3 * iNormal++;
+			isOK = parseFloat(p, end, xyz[0]) && parseFloat(p, end, xyz[1]) && parseFloat(p, end, xyz[2]);
+		}
+		else if (p[0] == 'v' && p[1] == 't') {
+			p += 2;
+			float* uv = pTexCoord + 2 * iTexCoord++;
+			isOK = parseFloat(p, end, uv[0]);
+			if (isOK && ! parseFloat(p, end, uv[1]))	// (1D texture coordinates do exist)
+				uv[1] = 0.0f;
+		}
+		else if (p[0] == 'f' && isBlank(p[1])) {
+			p += 2;
+			polygon.clear();
+			for (skipBlanks(p, end); p < end && ! isEndOfLine(*p); skipBlanks(p, end)) {
+				tinyobj::index_t corner = { -1, -1, -1 };
+				int index;
+				if (! parseInt(p, end, index)) {
+					isOK = false;
+					break;
+				}
+				corner.vertex_index = resolveIndex(index, chunk.basePosition + iPosition);
+				if (p < end && *p == '/') {
+					if (++p < end && *p != '/' && parseInt(p, end, index))
+						corner.texcoord_index = resolveIndex(index, chunk.baseTexCoord + iTexCoord);
+					if (p < end && *p == '/' && parseInt(++p, end, index))
+						corner.normal_index = resolveIndex(index, chunk.baseNormal + iNormal);
+				}
+				if (p < end && ! isBlank(*p) && ! isEndOfLine(*p)) {
+					isOK = false;
+					break;
+				}
+				polygon.push_back(corner);
+			}
+			if (isOK && polygon.size() >= 3)
+				for (size_t iCorner = 2; iCorner < polygon.size(); ++iCorner) {		// triangle fan
+					auto& indices = pShape->mesh.indices;
+					indices.push_back(polygon[0]);
+					indices.push_back(polygon[iCorner - 1]);
+					indices.push_back(polygon[iCorner]);
+					pShape->mesh.material_ids.push_back(iMaterial);
+				}
+			else
+				isOK = false;
+		}
+		else if (isKeyword(p, end, "o", 1) || isKeyword(p, end, "g", 1)) {
+			chunk.shapes.emplace_back();
+			pShape = &chunk.shapes.back();
+			pShape->name = restOfLine(p, end);
+		}
+		else if (isKeyword(p, end, "usemtl", 6)) {
+			string name = restOfLine(p, end);
+			auto pFound = std::find(chunk.materialNames.begin(), chunk.materialNames.end(), name);
+			iMaterial = (int) (pFound - chunk.materialNames.begin());
+			if (pFound == chunk.materialNames.end())
+				chunk.materialNames.push_back(name);
+			chunk.lastMaterial = iMaterial;
+		}
+		else if (isKeyword(p, end, "mtllib", 6) && chunk.materialLibrary.empty())
+			chunk.materialLibrary = restOfLine(p, end);
+		if (! isOK)
+			++chunk.numLinesSkipped;
+	}
+}
+
+
+bool FastObjParser::parse(const char* pText, size_t numBytes, tinyobj::attrib_t& attrib, vector<tinyobj::shape_t>& shapes)
+{
+	WorkerPool& pool = WorkerPool::Shared();
+
+	// Divide into chunks, each boundary nudged forward to the start of a line.
+	size_t maxChunks = max<size_t>(1, numBytes / MINIMUM_CHUNK_BYTES);
+	size_t chunksWanted = min<size_t>(maxChunks, 4 * pool.concurrency());	// (extras help balance the load)
+	vector<ObjChunk> chunks;
+	chunks.reserve(chunksWanted);
+	const char* pEnd = pText + numBytes;
+	for (const char* pBegin = pText; pBegin < pEnd; ) {
+		const char* pSplit = pText + numBytes * (chunks.size() + 1) / chunksWanted;
+		pSplit = (pSplit < pEnd) ? nextLine(max(pSplit, pBegin), pEnd) : pEnd;
+		ObjChunk chunk = {};
+		chunk.begin = pBegin;
+		chunk.end	= pSplit;
+		chunks.push_back(chunk);
+		pBegin = pSplit;
+	}
+	numChunks = chunks.size();
+
+	pool.parallelFor(chunks.size(), [&](size_t iChunk) {
+		countElements(chunks[iChunk]);
+	});
+
+	size_t numPositions = 0, numNormals = 0, numTexCoords = 0;
+	for (auto& chunk : chunks) {
+		chunk.basePosition = numPositions;	numPositions += chunk.numPositions;
+		chunk.baseNormal   = numNormals;	numNormals	 += chunk.numNormals;
+		chunk.baseTexCoord = numTexCoords;	numTexCoords += chunk.numTexCoords;
+	}
+	attrib.vertices.resize(3 * numPositions);
+	attrib.normals.resize(3 * numNormals);
+	attrib.texcoords.resize(2 * numTexCoords);
+	attrib.colors.clear();
+
+	pool.parallelFor(chunks.size(), [&](size_t iChunk) {
+		parseChunk(chunks[iChunk], attrib);
+	});
+
+	// Only now know if any vertex had color: if so, every vertex gets one (defaulting white).
+	bool hasColors = false;
+	for (auto& chunk : chunks)
+		hasColors |= ! chunk.colors.empty();
+	if (hasColors) {
+		attrib.colors.resize(3 * numPositions, 1.0f);
+		for (auto& chunk : chunks)
+			if (! chunk.colors.empty())
+				memcpy(&attrib.colors[3 * chunk.basePosition], chunk.colors.data(), chunk.colors.size() * sizeof(float));
+	}
+
+	// Resolve what each chunk's first shape and leading faces continue from its predecessors,
+	//	and local material indices to ones into the combined materialNames.
+	numLinesSkipped = 0;
+	shapes.clear();
+	materialNames.clear();
+	materialLibrary.clear();
+	string shapeName;
+	int iMaterial = -1;
+	for (auto& chunk : chunks) {
+		numLinesSkipped += chunk.numLinesSkipped;
+		if (materialLibrary.empty())
+			materialLibrary = chunk.materialLibrary;
+
+		vector<int> globalIDs;
+		for (const string& name : chunk.materialNames) {
+			auto pFound = std::find(materialNames.begin(), materialNames.end(), name);
+			globalIDs.push_back((int) (pFound - materialNames.begin()));
+			if (pFound == materialNames.end())
+				materialNames.push_back(name);
+		}
+		for (size_t iShape = 0; iShape < chunk.shapes.size(); ++iShape) {
+			auto& shape = chunk.shapes[iShape];
+			if (iShape == 0)
+				shape.name = shapeName;
+			else
+				shapeName = shape.name;
+			for (int& materialID : shape.mesh.material_ids)
+				materialID = (materialID < 0) ? iMaterial : globalIDs[materialID];
+			if (! shape.mesh.indices.empty())
+				shapes.push_back(std::move(shape));
+		}
+		if (chunk.lastMaterial >= 0)
+			iMaterial = globalIDs[chunk.lastMaterial];
+	}
+	return numPositions > 0;
+}
+
+
+// Only what a Submesh's material needs: name, diffuse color and texture.
+//
+void FastObjParser::parseMaterials(const char* pText, size_t numBytes, vector<ModelMaterial>& materials)
+{
+	materials.clear();
+	const char* end = pText + numBytes;
+	for (const char* p = pText; p < end; p = nextLine(p, end)) {
+		skipBlanks(p, end);
+		if (isKeyword(p, end, "newmtl", 6)) {
+			materials.emplace_back();
+			materials.back().name = restOfLine(p, end);
+		}
+		else if (materials.empty())
+			continue;
+		else if (isKeyword(p, end, "Kd", 2)) {
+			float* rgb = materials.back().diffuseColor;
+			if (! (parseFloat(p, end, rgb[0]) && parseFloat(p, end, rgb[1]) && parseFloat(p, end, rgb[2])))
+				++numLinesSkipped;
+		}
+		else if (isKeyword(p, end, "map_Kd", 6)) {
+			string arguments = restOfLine(p, end);		// (filename is last; options like -s 1 1 1 may precede)
+			size_t iBlank = arguments.find_last_of(" \t");
+			materials.back().diffuseTexture = (iBlank == string::npos) ? arguments : arguments.substr(iBlank + 1);
+		}
+	}
+}
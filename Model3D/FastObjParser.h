@@ -0,0 +1,52 @@
+//
+// FastObjParser.h
+//	Vulkan Convenience 3D Objects
+//
+// Our own "faster OBJ loader" (see SpecType OBJ_FILE_FAST) parsing Wavefront
+//	OBJ text already sitting in memory (typically a MappedFile).  Speed comes
+//	from: never copying the text, splitting it on line boundaries into chunks
+//	parsed concurrently across the shared WorkerPool, and a hand-rolled number
+//	parser that doesn't consult the C locale (as strtod/atof do, per call).
+// Two passes over each chunk: first merely counts v/vn/vt lines so every chunk
+//	knows its starting offset into the attribute arrays, which lets the second
+//	pass resolve (even negative/relative) face indices to absolute ones and
+//	write vertex data directly in-place, so there's no "merge" copy afterward.
+// Output mimics tiny_obj_loader's attrib_t/shape_t, so both loaders share the
+//	same downstream vertex assembly/welding in ModelLoader.  Supported subset:
+//	v (with optional trailing RGB color), vn, vt, f (polygons fan-triangulated),
+//	o/g (each starts a new shape) and usemtl (per-face material_ids, indexing
+//	materialNames, resolved against the .mtl library by the caller).  Everything
+//	else (s, l, p, comments) is skipped.  Since a chunk can't know which shape
+//	or material was current where it begins, its first shape and leading faces
+//	are marked as "continued" and resolved after all chunks are parsed.
+// Also parses .mtl material libraries (newmtl, Kd, map_Kd), sequentially.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef FastObjParser_h
+#define FastObjParser_h
+
+#include "VulkanPlatform.h"		// for std::vector etc.
+#include "tiny_obj_loader.h"
+#include "Submeshes.h"
+
+
+class FastObjParser
+{
+public:
+	// Parse numBytes of OBJ text at pText.  Each chunk's faces go into a separate shape.
+	//	Returns false only if nothing usable came out (no vertex positions).
+	bool parse(const char* pText, size_t numBytes, tinyobj::attrib_t& attrib, vector<tinyobj::shape_t>& shapes);
+
+	void parseMaterials(const char* pText, size_t numBytes, vector<ModelMaterial>& materials);
+
+	size_t	numLinesSkipped	= 0;	// malformed lines (versus merely unsupported ones)
+	size_t	numChunks		= 0;	// (informational) degree of parallelism actually used
+	vector<string>	materialNames;	// as named by 'usemtl', in order of first use
+	string			materialLibrary;	// (first) 'mtllib' filename, if any
+
+	static const size_t MINIMUM_CHUNK_BYTES = 512 * 1024;	// smaller isn't worth a thread
+};
+
+#endif	// FastObjParser_h
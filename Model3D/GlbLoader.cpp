@@ -0,0 +1,414 @@
+//
+// GlbLoader.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "GlbLoader.h"
+#include "Vertex3DTypes.h"
+#include <algorithm>
+#include <cmath>
+
+
+const uint32_t GLB_MAGIC	  = 0x46546C67;	// "glTF"
+const uint32_t GLB_CHUNK_JSON = 0x4E4F534A;	// "JSON"
+const uint32_t GLB_CHUNK_BIN  = 0x004E4942;	// "BIN\0"
+
+enum GltfComponentType {
+	GLTF_BYTE			= 5120,
+	GLTF_UNSIGNED_BYTE	= 5121,
+	GLTF_SHORT			= 5122,
+	GLTF_UNSIGNED_SHORT	= 5123,
+	GLTF_UNSIGNED_INT	= 5125,
+	GLTF_FLOAT			= 5126
+};
+
+const int GLTF_TRIANGLES = 4;
+
+static const char* AttributeNames[NUM_ATTRIBUTES] = { "POSITION", "NORMAL", "TEXCOORD_0", "COLOR_0" };
+static const int   AttributeComponents[NUM_ATTRIBUTES] = { 3, 3, 2, 4 };	// (as VerticesDynamic packs them)
+
+
+struct GlbAccessor {				// an accessor resolved to where its elements lie in the BIN chunk
+	const uint8_t*	pData	= nullptr;
+	uint32_t		count	= 0;
+	uint32_t		stride	= 0;
+	uint32_t		elementSize	  = 0;
+	int				componentType = 0;
+	int				numComponents = 0;
+	bool			isNormalized  = false;
+	int64_t			bufferView	  = -1;
+};
+
+static uint32_t readU32(const char* p)
+{
+	uint32_t value;
+	memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+static int componentSize(int componentType)
+{
+	switch (componentType) {
+		case GLTF_BYTE:  case GLTF_UNSIGNED_BYTE:	return 1;
+		case GLTF_SHORT: case GLTF_UNSIGNED_SHORT:	return 2;
+		case GLTF_UNSIGNED_INT: case GLTF_FLOAT:	return 4;
+		default:									return 0;
+	}
+}
+
+static int numComponentsOf(const string& type)
+{
+	return type == "SCALAR" ? 1 : type == "VEC2" ? 2 : type == "VEC3" ? 3 : type == "VEC4" ? 4 : 0;
+}
+
+
+bool GlbLoader::open(const string& fullPath)
+{
+	close();
+	if (! file.open(fullPath))
+		return fail("can't open/map file, or it's empty");
+
+	// 12-byte header, then chunks (each length, type, data), JSON first, BIN optionally second.
+	const char* p = file.data();
+	if (file.size() < 20 || readU32(p) != GLB_MAGIC)
+		return fail("not a binary glTF file");
+	if (readU32(p + 4) != 2)
+		return fail("glTF version " + to_string(readU32(p + 4)) + " not supported");
+	size_t totalSize = std::min((size_t) readU32(p + 8), file.size());
+
+	const char* pJSON = nullptr;
+	size_t jsonSize = 0;
+	for (size_t offset = 12; offset + 8 <= totalSize; ) {
+		size_t chunkSize = readU32(p + offset);
+		uint32_t chunkType = readU32(p + offset + 4);
+		if (chunkSize > totalSize - offset - 8)
+			return fail("chunk extends past end of file");
+		if (chunkType == GLB_CHUNK_JSON && ! pJSON) {
+			pJSON = p + offset + 8;
+			jsonSize = chunkSize;
+		} else if (chunkType == GLB_CHUNK_BIN && ! pBinary) {
+			pBinary = (const uint8_t*) p + offset + 8;
+			binarySize = chunkSize;
+		}
+		offset += 8 + ((chunkSize + 3) & ~(size_t) 3);
+	}
+	string error;
+	if (! pJSON || ! JsonValue::Parse(pJSON, jsonSize, json, error))
+		return fail("bad JSON chunk: " + (pJSON ? error : "missing"));
+
+	// Gather the triangle-list primitives of all meshes.
+	const JsonValue& meshes = json["meshes"];
+	for (size_t iMesh = 0; iMesh < meshes.size(); ++iMesh) {
+		const string& name = meshes[iMesh]["name"].string();
+		auto pFound = std::find(shapeNames.begin(), shapeNames.end(), name);
+		uint32_t shapeID = (uint32_t) (pFound - shapeNames.begin());
+		if (pFound == shapeNames.end())
+			shapeNames.push_back(name);
+
+		const JsonValue& meshPrimitives = meshes[iMesh]["primitives"];
+		for (size_t iPrimitive = 0; iPrimitive < meshPrimitives.size(); ++iPrimitive) {
+			const JsonValue& primitive = meshPrimitives[iPrimitive];
+			const JsonValue& attributes = primitive["attributes"];
+			if (primitive["mode"].integer(GLTF_TRIANGLES) != GLTF_TRIANGLES || ! attributes.has("POSITION")) {
+				++numPrimitivesSkipped;
+				continue;
+			}
+			Primitive gathered;
+			for (int attr = 0; attr < NUM_ATTRIBUTES; ++attr)
+				gathered.attributes[attr] = attributes[AttributeNames[attr]].integer(-1);
+			gathered.indices	= primitive["indices"].integer(-1);
+			gathered.shapeID	= shapeID;
+			gathered.materialID	= (int32_t) primitive["material"].integer(-1);
+			if (gathered.materialID >= (int32_t) json["materials"].size())
+				gathered.materialID = -1;
+			primitives.push_back(gathered);
+		}
+	}
+	if (primitives.empty())
+		return fail("no triangle meshes");
+	return true;
+}
+
+void GlbLoader::close()
+{
+	file.close();
+	json = JsonValue();
+	pBinary = nullptr;
+	binarySize = 0;
+	primitives.clear();
+	shapeNames.clear();
+	numPrimitivesSkipped = 0;
+	failure.clear();
+}
+
+// Validated against the BIN chunk's extent, so all elements are safe to read.
+//
+bool GlbLoader::resolve(int64_t iAccessor, GlbAccessor& accessor)
+{
+	const JsonValue& description = json["accessors"][(size_t) iAccessor];
+	if (iAccessor < 0 || description.isNull())
+		return fail("accessor " + to_string(iAccessor) + " missing");
+	if (description.has("sparse"))
+		return fail("sparse accessors not supported");
+
+	accessor.componentType = (int) description["componentType"].integer();
+	accessor.numComponents = numComponentsOf(description["type"].string());
+	accessor.isNormalized  = description["normalized"].boolean();
+	accessor.elementSize   = componentSize(accessor.componentType) * accessor.numComponents;
+	accessor.bufferView	   = description["bufferView"].integer(-1);
+	int64_t count		   = description["count"].integer(-1);
+	if (accessor.elementSize == 0 || count < 0 || count > UINT32_MAX)
+		return fail("accessor " + to_string(iAccessor) + " of unsupported type");
+	accessor.count = (uint32_t) count;
+
+	const JsonValue& view = json["bufferViews"][(size_t) accessor.bufferView];
+	if (accessor.bufferView < 0 || view.isNull())
+		return fail("accessor " + to_string(iAccessor) + " has no buffer view");
+	const JsonValue& buffer = json["buffers"][(size_t) view["buffer"].integer(-1)];
+	if (view["buffer"].integer(-1) != 0 || buffer.has("uri") || ! pBinary)
+		return fail("buffer data outside the .glb not supported");
+
+	int64_t viewOffset	 = view["byteOffset"].integer(0);
+	int64_t viewLength	 = view["byteLength"].integer(-1);
+	int64_t byteStride	 = view["byteStride"].integer(0);
+	int64_t byteOffset	 = description["byteOffset"].integer(0);
+	accessor.stride		 = byteStride > 0 ? (uint32_t) byteStride : accessor.elementSize;
+	int64_t extent		 = accessor.count == 0 ? 0 : (int64_t) (accessor.count - 1) * accessor.stride + accessor.elementSize;
+	if (viewOffset < 0 || viewLength < 0 || byteOffset < 0 || byteStride < 0 || byteStride > 252
+		|| viewOffset + viewLength > (int64_t) binarySize || byteOffset + extent > viewLength)
+		return fail("accessor " + to_string(iAccessor) + " out of bounds");
+	accessor.pData = pBinary + viewOffset + byteOffset;
+	return true;
+}
+
+// In place only if every primitive draws from the same vertex accessors, whose float elements
+//	are interleaved exactly as VerticesDynamic packs them, and indices are all of one type in one view,
+//	each primitive's whole triangles following the last's with no gap (so all draw as one range).
+//	Also checks that indices stay in range (the GPU won't), finding each submesh's bounds as it goes.
+//
+bool GlbLoader::viewInPlace(GlbInPlaceMesh& view)
+{
+	const Primitive& first = primitives[0];
+	for (const Primitive& primitive : primitives) {
+		if (! std::equal(primitive.attributes, primitive.attributes + NUM_ATTRIBUTES, first.attributes))
+			return fail("primitives have separate vertices");
+		if (primitive.indices < 0)
+			return fail("primitives not indexed");
+	}
+
+	GlbAccessor attributes[NUM_ATTRIBUTES];
+	uint32_t offset = 0;
+	view.attribits = 0;
+	for (int attr = 0; attr < NUM_ATTRIBUTES; ++attr) {
+		if (first.attributes[attr] < 0)
+			continue;
+		GlbAccessor& accessor = attributes[attr];
+		if (! resolve(first.attributes[attr], accessor))
+			return false;
+		if (accessor.componentType != GLTF_FLOAT || accessor.numComponents != AttributeComponents[attr])
+			return fail(string(AttributeNames[attr]) + " not stored as our vertex layout's");
+		if (accessor.bufferView != attributes[POSITION].bufferView || accessor.count != attributes[POSITION].count
+			|| accessor.pData != attributes[POSITION].pData + offset)
+			return fail("vertex attributes not interleaved as our vertex layout's");
+		offset += accessor.elementSize;
+		view.attribits |= Attribits[attr];
+	}
+	for (int attr = 0; attr < NUM_ATTRIBUTES; ++attr)
+		if ((view.attribits & Attribits[attr]) && attributes[attr].stride != offset)
+			return fail("vertex stride differs from our vertex layout's");
+	const uint8_t* pVertices = attributes[POSITION].pData;
+	view.pVertices	 = pVertices;
+	view.vertexCount = attributes[POSITION].count;
+
+	vector<GlbAccessor> indexAccessors(primitives.size());
+	for (size_t iPrimitive = 0; iPrimitive < primitives.size(); ++iPrimitive) {
+		GlbAccessor& accessor = indexAccessors[iPrimitive];
+		if (! resolve(primitives[iPrimitive].indices, accessor))
+			return false;
+		if ((accessor.componentType != GLTF_UNSIGNED_SHORT && accessor.componentType != GLTF_UNSIGNED_INT)
+			|| accessor.numComponents != 1 || accessor.stride != accessor.elementSize
+			|| accessor.componentType != indexAccessors[0].componentType
+			|| accessor.bufferView != indexAccessors[0].bufferView)
+			return fail("indices not 16/32-bit in one buffer view");
+	}
+	vector<const GlbAccessor*> inOrder;
+	for (const GlbAccessor& accessor : indexAccessors)
+		inOrder.push_back(&accessor);
+	std::sort(inOrder.begin(), inOrder.end(),
+			  [](const GlbAccessor* a, const GlbAccessor* b) { return a->pData < b->pData; });
+	const uint8_t* pStart = inOrder[0]->pData;
+	view.indexSize	= indexAccessors[0].elementSize;
+	view.pIndices	= pStart;
+	view.indexCount	= 0;
+	for (const GlbAccessor* pAccessor : inOrder) {
+		if (pAccessor->count % 3 != 0 || pAccessor->pData != pStart + (size_t) view.indexCount * view.indexSize)
+			return fail("primitives' indices not one contiguous range of triangles");
+		view.indexCount += pAccessor->count;
+	}
+
+	view.submeshes.clear();
+	for (size_t iPrimitive = 0; iPrimitive < primitives.size(); ++iPrimitive) {
+		const GlbAccessor& accessor = indexAccessors[iPrimitive];
+		Submesh submesh = {};
+		submesh.firstIndex = (uint32_t) ((accessor.pData - pStart) / view.indexSize);
+		submesh.indexCount = accessor.count;
+		submesh.materialID = primitives[iPrimitive].materialID;
+		submesh.shapeID	   = primitives[iPrimitive].shapeID;
+		std::fill(submesh.boundsMin, submesh.boundsMin + 3, INFINITY);
+		std::fill(submesh.boundsMax, submesh.boundsMax + 3, -INFINITY);
+		for (uint32_t i = 0; i < submesh.indexCount; ++i) {
+			uint32_t index = (view.indexSize == sizeof(uint16_t)) ? ((const uint16_t*) accessor.pData)[i]
+																  : ((const uint32_t*) accessor.pData)[i];
+			if (index >= view.vertexCount)
+				return fail("index " + to_string(index) + " out of range");
+			const float* position = (const float*) (pVertices + (size_t) index * offset);
+			for (int xyz = 0; xyz < 3; ++xyz) {
+				submesh.boundsMin[xyz] = std::min(submesh.boundsMin[xyz], position[xyz]);
+				submesh.boundsMax[xyz] = std::max(submesh.boundsMax[xyz], position[xyz]);
+			}
+		}
+		view.submeshes.push_back(submesh);
+	}
+	std::stable_sort(view.submeshes.begin(), view.submeshes.end(),
+					 [](const Submesh& a, const Submesh& b) { return a.materialID < b.materialID; });
+	return true;
+}
+
+// One component, converted to float (normalized integers as glTF defines them).
+//
+static float componentAsFloat(const uint8_t* p, int componentType, bool isNormalized)
+{
+	switch (componentType) {
+		case GLTF_FLOAT:		  { float value;	memcpy(&value, p, sizeof(value));  return value; }
+		case GLTF_UNSIGNED_BYTE:  return isNormalized ? *p / 255.0f : *p;
+		case GLTF_BYTE:			  return isNormalized ? std::max(*(const int8_t*) p / 127.0f, -1.0f) : *(const int8_t*) p;
+		case GLTF_UNSIGNED_SHORT: { uint16_t value;	memcpy(&value, p, sizeof(value));
+									return isNormalized ? value / 65535.0f : value; }
+		case GLTF_SHORT:		  { int16_t value;	memcpy(&value, p, sizeof(value));
+									return isNormalized ? std::max(value / 32767.0f, -1.0f) : value; }
+		case GLTF_UNSIGNED_INT:	  { uint32_t value;	memcpy(&value, p, sizeof(value));  return (float) value; }
+		default:				  return 0.0f;
+	}
+}
+
+static void readElement(const GlbAccessor& accessor, uint32_t i, float* out, int numComponents)
+{
+	const uint8_t* p = accessor.pData + (size_t) i * accessor.stride;
+	int size = componentSize(accessor.componentType);
+	for (int c = 0; c < std::min(numComponents, accessor.numComponents); ++c)
+		out[c] = componentAsFloat(p + c * size, accessor.componentType, accessor.isNormalized);
+}
+
+static uint32_t readIndex(const GlbAccessor& accessor, uint32_t i)
+{
+	const uint8_t* p = accessor.pData + (size_t) i * accessor.stride;
+	switch (accessor.componentType) {
+		case GLTF_UNSIGNED_BYTE:	return *p;
+		case GLTF_UNSIGNED_SHORT:	{ uint16_t index;  memcpy(&index, p, sizeof(index));  return index; }
+		default:					{ uint32_t index;  memcpy(&index, p, sizeof(index));  return index; }
+	}
+}
+
+// Primitives' vertices are appended one after another, each with its indices offset to match (but only
+//	once for primitives sharing the same accessors).  Unlike OBJ, there's no welding: glTF exporters
+//	already share vertices within a primitive.  An attribute some primitives lack is zero for them (but
+//	white, if color).
+//
+AttributeBits GlbLoader::repack(VerticesDynamic& vertices, vector<uint32_t>& indices,
+								vector<uint32_t>& triangleShapes, vector<int32_t>& triangleMaterials)
+{
+	failure.clear();
+	vector<uint32_t> primitiveFirstVertex;
+	AttributeBits attribits = 0;
+	for (const Primitive& primitive : primitives)
+		for (int attr = 0; attr < NUM_ATTRIBUTES; ++attr)
+			if (primitive.attributes[attr] >= 0)
+				attribits |= Attribits[attr];
+	vertices.setAttributes(attribits);
+
+	for (size_t iPrimitive = 0; iPrimitive < primitives.size(); ++iPrimitive) {
+		const Primitive& primitive = primitives[iPrimitive];
+		GlbAccessor attributes[NUM_ATTRIBUTES];
+		for (int attr = 0; attr < NUM_ATTRIBUTES; ++attr) {
+			if (primitive.attributes[attr] < 0)
+				continue;
+			if (! resolve(primitive.attributes[attr], attributes[attr]))
+				return 0;
+			if (attributes[attr].count != attributes[POSITION].count
+				|| attributes[attr].numComponents < (attr == COLOR ? 3 : AttributeComponents[attr])) {
+				fail(string(AttributeNames[attr]) + " has wrong count or type");
+				return 0;
+			}
+		}
+
+		uint32_t firstVertex = (uint32_t) vertices.count();
+		uint32_t vertexCount = attributes[POSITION].count;
+		bool isShared = false;
+		for (size_t iEarlier = 0; iEarlier < iPrimitive && ! isShared; ++iEarlier)
+			if (std::equal(primitive.attributes, primitive.attributes + NUM_ATTRIBUTES, primitives[iEarlier].attributes)) {
+				firstVertex = primitiveFirstVertex[iEarlier];
+				isShared = true;
+			}
+		primitiveFirstVertex.push_back(firstVertex);
+		for (uint32_t iVertex = 0; iVertex < vertexCount && ! isShared; ++iVertex) {
+			Vertex3DNormalTextureColor vertex;
+			float position[3] = { 0 }, normal[3] = { 0 }, texCoord[2] = { 0 }, color[4] = { 1, 1, 1, 1 };
+			readElement(attributes[POSITION], iVertex, position, 3);
+			if (attributes[NORMAL].pData)	readElement(attributes[NORMAL], iVertex, normal, 3);
+			if (attributes[TEXCOORD].pData)	readElement(attributes[TEXCOORD], iVertex, texCoord, 2);
+			if (attributes[COLOR].pData)	readElement(attributes[COLOR], iVertex, color, 4);
+			vertex.position = { position[0], position[1], position[2] };
+			vertex.normal	= { normal[0], normal[1], normal[2] };
+			vertex.texCoord	= { texCoord[0], texCoord[1] };
+			vertex.color	= { color[0], color[1], color[2], color[3] };
+			vertices.push_back(vertex);
+		}
+
+		GlbAccessor indexAccessor;
+		uint32_t indexCount = vertexCount;
+		if (primitive.indices >= 0) {
+			if (! resolve(primitive.indices, indexAccessor))
+				return 0;
+			if (indexAccessor.numComponents != 1 || indexAccessor.componentType == GLTF_FLOAT
+				|| indexAccessor.componentType == GLTF_BYTE || indexAccessor.componentType == GLTF_SHORT) {
+				fail("indices of unsupported type");
+				return 0;
+			}
+			indexCount = indexAccessor.count;
+		}
+		indexCount = indexCount / 3 * 3;
+		for (uint32_t i = 0; i < indexCount; ++i) {
+			uint32_t index = indexAccessor.pData ? readIndex(indexAccessor, i) : i;
+			if (index >= vertexCount) {
+				fail("index " + to_string(index) + " out of range");
+				return 0;
+			}
+			indices.push_back(firstVertex + index);
+		}
+		triangleShapes.insert(triangleShapes.end(), indexCount / 3, primitive.shapeID);
+		triangleMaterials.insert(triangleMaterials.end(), indexCount / 3, primitive.materialID);
+	}
+	vertices.exactResize();
+	return attribits;
+}
+
+void GlbLoader::readMaterials(vector<ModelMaterial>& materials)
+{
+	const JsonValue& gltfMaterials = json["materials"];
+	for (size_t iMaterial = 0; iMaterial < gltfMaterials.size(); ++iMaterial) {
+		const JsonValue& pbr = gltfMaterials[iMaterial]["pbrMetallicRoughness"];
+		ModelMaterial material;
+		material.name = gltfMaterials[iMaterial]["name"].string();
+		for (int rgb = 0; rgb < 3; ++rgb)
+			material.diffuseColor[rgb] = (float) pbr["baseColorFactor"][rgb].number(1.0);
+		if (pbr.has("baseColorTexture")) {
+			const JsonValue& texture = json["textures"][(size_t) pbr["baseColorTexture"]["index"].integer(-1)];
+			material.diffuseTexture = json["images"][(size_t) texture["source"].integer(-1)]["uri"].string();
+		}
+		materials.push_back(material);
+	}
+}
@@ -0,0 +1,89 @@
+//
+// GlbLoader.h
+//	Vulkan Convenience 3D Objects
+//
+// Binary glTF 2.0 (.glb) loading (see SpecType GLTF_BINARY).  The file is
+//	memory-mapped, its JSON chunk parsed (JsonValue), and every triangle-list
+//	primitive of every mesh gathered (node transforms are not applied, so
+//	meshes come out in their own model space, as OBJ shapes do).
+// Where the data already is laid out as VerticesDynamic would pack it - one
+//	interleaved float buffer view, attributes in position/normal/texCoord/color
+//	order (any may be absent) with no padding, shared by all primitives, whose
+//	indices are 16- or 32-bit in one tightly-packed view - viewInPlace() hands
+//	back pointers straight into the mapped file, nothing copied or converted,
+//	so loading costs little more than the I/O; the mapping must then outlive
+//	the MeshObject's use of it.  Other layouts (separate per-attribute views,
+//	normalized-integer attributes, RGB colors, 8-bit or no indices, primitives
+//	each with their own vertices) are repack()ed into our usual layout instead.
+// Either way, each primitive becomes a Submesh, its mesh being its shape;
+//	materials keep name, base color and its texture's image uri (an image
+//	embedded in the .glb itself is not extracted; diffuseTexture is left empty).
+// Texture coordinates are left as glTF defines them, origin at upper left.
+//	The BIN chunk must hold all buffer data; external .bin files, sparse
+//	accessors, and compression extensions aren't supported.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef GlbLoader_h
+#define GlbLoader_h
+
+#include "VerticesDynamic.h"
+#include "MappedFile.h"
+#include "JsonValue.h"
+#include "Submeshes.h"
+
+
+struct GlbInPlaceMesh {			// all pointers are into the mapped file
+	AttributeBits	attribits	= 0;
+	const void*		pVertices	= nullptr;
+	uint32_t		vertexCount	= 0;
+	const void*		pIndices	= nullptr;
+	uint32_t		indexCount	= 0;
+	uint32_t		indexSize	= 0;	// 2 or 4 bytes
+	vector<Submesh>	submeshes;			// (sorted by material)
+};
+
+struct GlbAccessor;
+
+
+class GlbLoader
+{
+	struct Primitive {
+		int64_t	 attributes[NUM_ATTRIBUTES];	// accessor of each, or -1
+		int64_t	 indices;
+		uint32_t shapeID;
+		int32_t	 materialID;
+	};
+
+	MappedFile		  file;
+	JsonValue		  json;
+	const uint8_t*	  pBinary	 = nullptr;		// (BIN chunk)
+	size_t			  binarySize = 0;
+	vector<Primitive> primitives;
+
+	bool fail(const string& why)	{ failure = why;  return false; }
+	bool resolve(int64_t iAccessor, GlbAccessor& accessor);
+
+public:
+	// Maps the file and reads its structure; false if it isn't a .glb we can read (see 'failure').
+	bool open(const string& fullPath);
+	void close();
+	bool isOpen()	{ return ! primitives.empty(); }
+
+	// Whether the model can be drawn from the file as-is (if not, 'failure' says why).
+	bool viewInPlace(GlbInPlaceMesh& view);
+
+	// Otherwise copy it, converting as needed, returning the attributes the vertices have, or 0 on failure.
+	//	Like OBJ loaders, tags each triangle with its shape and material (for SubmeshBuilder).
+	AttributeBits repack(VerticesDynamic& vertices, vector<uint32_t>& indices,
+						 vector<uint32_t>& triangleShapes, vector<int32_t>& triangleMaterials);
+
+	void readMaterials(vector<ModelMaterial>& materials);
+
+	vector<string>	shapeNames;				// (the glTF meshes' names, same-named ones being one shape)
+	size_t			numPrimitivesSkipped = 0;	// (points or lines, or no positions)
+	string			failure;
+};
+
+#endif	// GlbLoader_h
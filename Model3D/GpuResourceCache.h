@@ -0,0 +1,139 @@
+//
+// GpuResourceCache.h
+//	Vulkan Convenience 3D Objects
+//
+// Ref-counted cache of GPU resources - textures (VkImage, its memory, view
+//	and sampler) or buffers - so that objects specifying the same texture,
+//	or an object deleted and soon re-created (as the viewer does cycling
+//	between objects), share what was already decoded and uploaded rather than
+//	create it all again.  Keyed by name (e.g. the texture's file name) plus a
+//	PROPERTIES struct (e.g. its sampler's filtering, addressing, anisotropy,
+//	mipmapping), compared bytewise, so like WeldTable's KEY it must be
+//	trivially-copyable with any padding zeroed.
+// RESOURCE is whatever the caller's creation code produces; it's created by
+//	the Creator given to acquire(), on a miss, and released by the Destroyer
+//	given to the cache.  Callers hold the Handle while drawing with it.
+//	Resources nobody holds stay resident, least-recently used destroyed first,
+//	once the total exceeds the byte budget; but only during acquire(), trim(),
+//	setBudget() or clear(), which therefore must only be called when the GPU
+//	is done with anything released (e.g. after vkDeviceWaitIdle, as the
+//	viewer does before retiring an object).  Not thread-safe: use from the
+//	thread creating GPU resources.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef GpuResourceCache_h
+#define GpuResourceCache_h
+
+#include "Hash64.h"
+#include <unordered_map>
+#include <functional>
+#include <memory>
+#include <string>
+#include <list>
+
+
+template<typename RESOURCE, typename PROPERTIES>
+class GpuResourceCache
+{
+public:
+	typedef std::shared_ptr<RESOURCE>						Handle;
+	typedef std::function<bool(RESOURCE&, size_t& numBytes)> Creator;		// false if it failed
+	typedef std::function<void(RESOURCE&)>					Destroyer;
+
+	static const size_t DEFAULT_BUDGET_BYTES = 512 << 20;
+
+	GpuResourceCache(Destroyer destroyer, size_t maxBytes = DEFAULT_BUDGET_BYTES)
+		:	destroy(destroyer), budgetBytes(maxBytes)	{ }
+	~GpuResourceCache()		{ evictAll(true); }		// (anything still held then is the holder's to worry about)
+
+private:
+	struct Entry {
+		RESOURCE		  resource;
+		size_t			  numBytes = 0;
+		std::string		  key;
+		typename std::list<Entry*>::iterator lruPosition;
+	};
+
+	std::unordered_map<std::string, std::shared_ptr<Entry>> entries;
+	std::list<Entry*> recentlyUsed;		// (most recent first)
+	Destroyer		  destroy;
+	size_t			  budgetBytes;
+	size_t			  residentBytes = 0;
+
+	static std::string keyFor(const std::string& name, const PROPERTIES& properties)
+	{
+		uint64_t hash = Hash64(&properties, sizeof(PROPERTIES));
+		return name + '|' + std::string((const char*) &hash, sizeof(hash));
+	}
+
+	void evict(typename std::list<Entry*>::iterator& iEntry)
+	{
+		Entry* pEntry = *iEntry;
+		residentBytes -= pEntry->numBytes;
+		++numEvictions;
+		destroy(pEntry->resource);
+		iEntry = recentlyUsed.erase(iEntry);
+		std::string key = pEntry->key;		// (as erasing frees the entry)
+		entries.erase(key);
+	}
+
+	void evictAll(bool evenIfHeld)
+	{
+		for (auto iEntry = recentlyUsed.begin(); iEntry != recentlyUsed.end(); )
+			if (evenIfHeld || entries[(*iEntry)->key].use_count() == 1)
+				evict(iEntry);
+			else
+				++iEntry;
+	}
+
+public:
+	// The resource for this name and properties, created if not already resident; null if creating it failed.
+	//
+	Handle acquire(const std::string& name, const PROPERTIES& properties, Creator create)
+	{
+		std::string key = keyFor(name, properties);
+		auto found = entries.find(key);
+		if (found != entries.end()) {
+			++numHits;
+			Entry* pEntry = found->second.get();
+			recentlyUsed.splice(recentlyUsed.begin(), recentlyUsed, pEntry->lruPosition);
+			return Handle(found->second, &pEntry->resource);
+		}
+		++numMisses;
+		auto pEntry = std::make_shared<Entry>();
+		if (! create(pEntry->resource, pEntry->numBytes))
+			return nullptr;
+		pEntry->key = key;
+		recentlyUsed.push_front(pEntry.get());
+		pEntry->lruPosition = recentlyUsed.begin();
+		entries[key] = pEntry;
+		residentBytes += pEntry->numBytes;
+		Handle handle(pEntry, &pEntry->resource);		// (held, so not itself evicted by trim)
+		trim();
+		return handle;
+	}
+
+	// Destroy least-recently-used resources nobody holds, until back under budget.
+	//
+	void trim()
+	{
+		for (auto iEntry = recentlyUsed.end(); residentBytes > budgetBytes && iEntry != recentlyUsed.begin(); ) {
+			--iEntry;
+			if (entries[(*iEntry)->key].use_count() == 1)
+				evict(iEntry);
+		}
+	}
+
+	void setBudget(size_t maxBytes)	{ budgetBytes = maxBytes;  trim(); }
+	void clear()					{ evictAll(false); }	// (of all resources not held)
+
+	size_t	numHits = 0;			// (informational)
+	size_t	numMisses = 0;
+	size_t	numEvictions = 0;
+	size_t	bytesResident()		{ return residentBytes; }
+	size_t	numResident()		{ return entries.size(); }
+};
+
+#endif	// GpuResourceCache_h
@@ -0,0 +1,88 @@
+//
+// Hash64.h
+//	Vulkan Convenience 3D Objects
+//
+// Fast, well-distributed 64-bit hash of raw bytes: the XXH64 algorithm
+//	(by Yann Collet, BSD-licensed, github.com/Cyan4973/xxHash) re-typed
+//	compactly here, so as not to add another dependency.  Used both to
+//	fingerprint whole files (e.g. to validate cached/cooked meshes against
+//	their source) and to hash small keys.  Results are only guaranteed to
+//	match across machines of the same endianness.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef Hash64_h
+#define Hash64_h
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+
+namespace Hash64Detail
+{
+	const uint64_t Prime1 = 0x9E3779B185EBCA87ULL;
+	const uint64_t Prime2 = 0xC2B2AE3D27D4EB4FULL;
+	const uint64_t Prime3 = 0x165667B19E3779F9ULL;
+	const uint64_t Prime4 = 0x85EBCA77C2B2AE63ULL;
+	const uint64_t Prime5 = 0x27D4EB2F165667C5ULL;
+
+	inline uint64_t rotl(uint64_t x, int r)	{ return (x << r) | (x >> (64 - r)); }
+
+	inline uint64_t read64(const uint8_t* p)	{ uint64_t v; memcpy(&v, p, 8); return v; }	// (alignment-safe;
+	inline uint32_t read32(const uint8_t* p)	{ uint32_t v; memcpy(&v, p, 4); return v; }	//	compiles to a mov)
+
+	inline uint64_t round(uint64_t acc, uint64_t input) {
+		acc += input * Prime2;
+		return rotl(acc, 31) * Prime1;
+	}
+	inline uint64_t mergeRound(uint64_t acc, uint64_t val) {
+		acc ^= round(0, val);
+		return acc * Prime1 + Prime4;
+	}
+	inline uint64_t avalanche(uint64_t h) {
+		h ^= h >> 33;  h *= Prime2;
+		h ^= h >> 29;  h *= Prime3;
+		return h ^ (h >> 32);
+	}
+}
+
+
+inline uint64_t Hash64(const void* pData, size_t numBytes, uint64_t seed = 0)
+{
+	using namespace Hash64Detail;
+
+	const uint8_t* p = (const uint8_t*) pData;
+	const uint8_t* pEnd = p + numBytes;
+	uint64_t h;
+
+	if (numBytes >= 32) {
+		uint64_t v1 = seed + Prime1 + Prime2, v2 = seed + Prime2, v3 = seed, v4 = seed - Prime1;
+		for (const uint8_t* pLimit = pEnd - 32; p <= pLimit; p += 32) {
+			v1 = round(v1, read64(p));
+			v2 = round(v2, read64(p + 8));
+			v3 = round(v3, read64(p + 16));
+			v4 = round(v4, read64(p + 24));
+		}
+		h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+		h = mergeRound(h, v1);	h = mergeRound(h, v2);
+		h = mergeRound(h, v3);	h = mergeRound(h, v4);
+	} else
+		h = seed + Prime5;
+
+	h += (uint64_t) numBytes;
+
+	for ( ; p + 8 <= pEnd; p += 8)
+		h = rotl(h ^ round(0, read64(p)), 27) * Prime1 + Prime4;
+	if (p + 4 <= pEnd) {
+		h = rotl(h ^ (read32(p) * Prime1), 23) * Prime2 + Prime3;
+		p += 4;
+	}
+	for ( ; p < pEnd; ++p)
+		h = rotl(h ^ (*p * Prime5), 11) * Prime1;
+
+	return avalanche(h);
+}
+
+#endif	// Hash64_h
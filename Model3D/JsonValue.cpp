@@ -0,0 +1,274 @@
+//
+// JsonValue.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "JsonValue.h"
+#include <cstring>
+#include <cstdlib>
+
+using std::string;
+
+
+static const JsonValue Null;
+
+
+const JsonValue& JsonValue::operator[](const char* key) const
+{
+	for (const auto& member : members)
+		if (member.first == key)
+			return member.second;
+	return Null;
+}
+
+const JsonValue& JsonValue::operator[](size_t index) const
+{
+	return (index < elements.size()) ? elements[index] : Null;
+}
+
+
+// Recursive descent, bounded by 'end' (text needn't be null-terminated).
+//
+class JsonParser
+{
+	const char* p;
+	const char* end;
+	int			depth = 0;
+
+	static const int MAX_DEPTH = 256;	// (malicious nesting mustn't overflow the stack)
+
+public:
+	string error;
+
+	JsonParser(const char* pText, size_t numBytes) : p(pText), end(pText + numBytes)	{ }
+
+	bool parseDocument(JsonValue& root)
+	{
+		if (! parseValue(root))
+			return false;
+		skipWhitespace();
+		return p == end || fail("unexpected text after end");
+	}
+
+private:
+	bool fail(const char* message)
+	{
+		if (error.empty())
+			error = string(message) + " (" + std::to_string(end - p) + " bytes before end)";
+		return false;
+	}
+
+	void skipWhitespace()
+	{
+		while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r' || *p == '\0'))
+			++p;		// ('\0' as GLB pads its JSON chunk with spaces, but some writers use nulls)
+	}
+
+	bool match(const char* literal)
+	{
+		size_t length = strlen(literal);
+		if ((size_t) (end - p) < length || memcmp(p, literal, length) != 0)
+			return false;
+		p += length;
+		return true;
+	}
+
+	bool parseValue(JsonValue& value)
+	{
+		skipWhitespace();
+		if (p == end)
+			return fail("unexpected end");
+		switch (*p) {
+			case '{':	return parseObject(value);
+			case '[':	return parseArray(value);
+			case '"':	value.type = JsonValue::STRING;
+						return parseString(value.text);
+			case 't':	value.type = JsonValue::BOOLEAN;  value.value = 1.0;
+						return match("true") || fail("bad literal");
+			case 'f':	value.type = JsonValue::BOOLEAN;  value.value = 0.0;
+						return match("false") || fail("bad literal");
+			case 'n':	value.type = JsonValue::NUL;
+						return match("null") || fail("bad literal");
+			default:	return parseNumber(value);
+		}
+	}
+
+	bool parseNumber(JsonValue& value)
+	{
+		char digits[64];		// (strtod wants termination; longer numbers than this aren't sensible)
+		size_t length = 0;
+		while (p + length < end && length < sizeof(digits) - 1 && strchr("+-0123456789.eE", p[length]))
+			++length;
+		if (length == 0)
+			return fail("unexpected character");
+		memcpy(digits, p, length);
+		digits[length] = '\0';
+		char* pAfter;
+		value.value = strtod(digits, &pAfter);
+		if (pAfter != digits + length)
+			return fail("bad number");
+		value.type = JsonValue::NUMBER;
+		p += length;
+		return true;
+	}
+
+	static void appendUTF8(string& text, uint32_t codePoint)
+	{
+		if (codePoint < 0x80)
+			text += (char) codePoint;
+		else if (codePoint < 0x800) {
+			text += (char) (0xC0 | (codePoint >> 6));
+			text += (char) (0x80 | (codePoint & 0x3F));
+		} else if (codePoint < 0x10000) {
+			text += (char) (0xE0 | (codePoint >> 12));
+			text += (char) (0x80 | ((codePoint >> 6) & 0x3F));
+			text += (char) (0x80 | (codePoint & 0x3F));
+		} else {
+			text += (char) (0xF0 | (codePoint >> 18));
+			text += (char) (0x80 | ((codePoint >> 12) & 0x3F));
+			text += (char) (0x80 | ((codePoint >> 6) & 0x3F));
+			text += (char) (0x80 | (codePoint & 0x3F));
+		}
+	}
+
+	bool parseHex4(uint32_t& codePoint)
+	{
+		if (end - p < 4)
+			return fail("truncated \\u escape");
+		codePoint = 0;
+		for (int i = 0; i < 4; ++i, ++p) {
+			char c = *p;
+			int digit = (c >= '0' && c <= '9') ? c - '0' : (c >= 'a' && c <= 'f') ? c - 'a' + 10
+					  : (c >= 'A' && c <= 'F') ? c - 'A' + 10 : -1;
+			if (digit < 0)
+				return fail("bad \\u escape");
+			codePoint = (codePoint << 4) | digit;
+		}
+		return true;
+	}
+
+	bool parseString(string& text)
+	{
+		++p;		// (opening quote)
+		for (;;) {
+			const char* pRun = p;
+			while (p < end && *p != '"' && *p != '\\')
+				++p;
+			text.append(pRun, p);
+			if (p == end)
+				return fail("unterminated string");
+			if (*p++ == '"')
+				return true;
+			if (p == end)
+				return fail("unterminated string");
+			char escaped = *p++;
+			switch (escaped) {
+				case '"':  case '\\':  case '/':	text += escaped;  break;
+				case 'b':	text += '\b';	break;
+				case 'f':	text += '\f';	break;
+				case 'n':	text += '\n';	break;
+				case 'r':	text += '\r';	break;
+				case 't':	text += '\t';	break;
+				case 'u': {
+					uint32_t codePoint = 0;
+					if (! parseHex4(codePoint))
+						return false;
+					if (codePoint >= 0xD800 && codePoint < 0xDC00 && match("\\u")) {	// surrogate pair
+						uint32_t low = 0;
+						if (! parseHex4(low))
+							return false;
+						if (low < 0xDC00 || low > 0xDFFF)
+							return fail("bad surrogate pair");
+						codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+					}
+					appendUTF8(text, codePoint);
+					break;
+				}
+				default:
+					return fail("bad escape");
+			}
+		}
+	}
+
+	bool parseArray(JsonValue& value)
+	{
+		if (++depth > MAX_DEPTH)
+			return fail("nested too deeply");
+		value.type = JsonValue::ARRAY;
+		++p;
+		skipWhitespace();
+		if (p < end && *p == ']') {
+			++p;
+			--depth;
+			return true;
+		}
+		for (;;) {
+			value.elements.emplace_back();
+			if (! parseValue(value.elements.back()))
+				return false;
+			skipWhitespace();
+			if (p < end && *p == ',') {
+				++p;
+				continue;
+			}
+			if (p < end && *p == ']') {
+				++p;
+				--depth;
+				return true;
+			}
+			return fail("expected , or ]");
+		}
+	}
+
+	bool parseObject(JsonValue& value)
+	{
+		if (++depth > MAX_DEPTH)
+			return fail("nested too deeply");
+		value.type = JsonValue::OBJECT;
+		++p;
+		skipWhitespace();
+		if (p < end && *p == '}') {
+			++p;
+			--depth;
+			return true;
+		}
+		for (;;) {
+			skipWhitespace();
+			if (p == end || *p != '"')
+				return fail("expected member name");
+			value.members.emplace_back();
+			if (! parseString(value.members.back().first))
+				return false;
+			skipWhitespace();
+			if (p == end || *p++ != ':')
+				return fail("expected :");
+			if (! parseValue(value.members.back().second))
+				return false;
+			skipWhitespace();
+			if (p < end && *p == ',') {
+				++p;
+				continue;
+			}
+			if (p < end && *p == '}') {
+				++p;
+				--depth;
+				return true;
+			}
+			return fail("expected , or }");
+		}
+	}
+};
+
+
+bool JsonValue::Parse(const char* pText, size_t numBytes, JsonValue& root, std::string& error)
+{
+	root = JsonValue();
+	JsonParser parser(pText, numBytes);
+	bool isOK = parser.parseDocument(root);
+	error = parser.error;
+	return isOK;
+}
@@ -0,0 +1,62 @@
+//
+// JsonValue.h
+//	Vulkan Convenience 3D Objects
+//
+// Minimal JSON reader, enough for the likes of a glTF file's JSON chunk:
+//	parses a whole document into a tree of JsonValues.  Lookups never fail;
+//	a missing member or element yields a shared null value, whose number()/
+//	string() give the caller's default, so optional fields read in one step:
+//		int mode = primitive["mode"].integer(4);
+//	Object members keep document order; lookup is linear (fine for the
+//	handful each object in such files tends to have).  Numbers are doubles.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef JsonValue_h
+#define JsonValue_h
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+
+class JsonValue
+{
+public:
+	enum Type { NUL, BOOLEAN, NUMBER, STRING, ARRAY, OBJECT };
+
+	// Returns false (and leaves an error description) if text isn't well-formed JSON.
+	static bool Parse(const char* pText, size_t numBytes, JsonValue& root, std::string& error);
+
+		// MEMBERS
+private:
+	Type		type	= NUL;
+	double		value	= 0.0;		// (number, or boolean as 0/1)
+	std::string	text;
+	std::vector<JsonValue>							elements;
+	std::vector<std::pair<std::string, JsonValue>>	members;
+
+	friend class JsonParser;
+
+		// METHODS
+public:
+	const JsonValue& operator[](const char* key) const;
+	const JsonValue& operator[](size_t index) const;
+
+	Type	kind() const		{ return type; }
+	bool	isNull() const		{ return type == NUL; }
+	bool	has(const char* key) const	{ return ! (*this)[key].isNull(); }
+	size_t	size() const		{ return type == ARRAY ? elements.size() : type == OBJECT ? members.size() : 0; }
+
+	double	number(double otherwise = 0.0) const	{ return (type == NUMBER || type == BOOLEAN) ? value : otherwise; }
+	int64_t	integer(int64_t otherwise = 0) const	{ return (type == NUMBER) ? (int64_t) value : otherwise; }
+	bool	boolean(bool otherwise = false) const	{ return (type == BOOLEAN) ? value != 0.0 : otherwise; }
+	const std::string& string() const				{ return text; }	// (empty unless STRING)
+
+	const std::vector<std::pair<std::string, JsonValue>>& objectMembers() const	{ return members; }
+};
+
+#endif	// JsonValue_h
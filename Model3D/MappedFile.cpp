@@ -0,0 +1,117 @@
+//
+// MappedFile.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "MappedFile.h"
+
+#ifdef _WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#include <windows.h>
+#else
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+
+MappedFile& MappedFile::operator=(MappedFile&& other)
+{
+	if (this != &other) {
+		close();
+		pData = other.pData;			other.pData = nullptr;
+		numBytes = other.numBytes;		other.numBytes = 0;
+		modifyTime = other.modifyTime;
+	  #ifdef _WIN32
+		hFile = other.hFile;			other.hFile = nullptr;
+		hMapping = other.hMapping;		other.hMapping = nullptr;
+	  #endif
+	}
+	return *this;
+}
+
+
+#ifdef _WIN32
+
+bool MappedFile::open(const std::string& fullPath)
+{
+	close();
+
+	hFile = CreateFileA(fullPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+						OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		hFile = nullptr;
+		return false;
+	}
+	LARGE_INTEGER fileSize;
+	FILETIME lastWrite;
+	if (! GetFileSizeEx(hFile, &fileSize) || fileSize.QuadPart == 0) {
+		close();
+		return false;
+	}
+	if (GetFileTime(hFile, nullptr, nullptr, &lastWrite)) {		// (100ns intervals since 1601, to Unix seconds)
+		uint64_t ticks = ((uint64_t) lastWrite.dwHighDateTime << 32) | lastWrite.dwLowDateTime;
+		modifyTime = ticks / 10'000'000 - 11'644'473'600;
+	}
+	hMapping = CreateFileMappingA(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (hMapping)
+		pData = (const char*) MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+	if (! pData) {
+		close();
+		return false;
+	}
+	numBytes = (size_t) fileSize.QuadPart;
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (pData)		UnmapViewOfFile(pData);
+	if (hMapping)	CloseHandle(hMapping);
+	if (hFile)		CloseHandle(hFile);
+	pData = nullptr;  hMapping = nullptr;  hFile = nullptr;
+	numBytes = 0;
+}
+
+#else	// POSIX (Linux, Apple)
+
+bool MappedFile::open(const std::string& fullPath)
+{
+	close();
+
+	int fd = ::open(fullPath.c_str(), O_RDONLY);
+	if (fd < 0)
+		return false;
+
+	struct stat info;
+	if (fstat(fd, &info) != 0 || info.st_size == 0) {	// (zero-length can't be mapped)
+		::close(fd);
+		return false;
+	}
+	void* pMapped = mmap(nullptr, (size_t) info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);		// mapping remains valid after descriptor closes
+	if (pMapped == MAP_FAILED)
+		return false;
+
+	madvise(pMapped, (size_t) info.st_size, MADV_SEQUENTIAL);	// (hint only, so ignore failure)
+
+	pData = (const char*) pMapped;
+	numBytes = (size_t) info.st_size;
+	modifyTime = (uint64_t) info.st_mtime;
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (pData)
+		munmap((void*) pData, numBytes);
+	pData = nullptr;
+	numBytes = 0;
+}
+
+#endif
@@ -0,0 +1,56 @@
+//
+// MappedFile.h
+//	Vulkan Convenience 3D Objects
+//
+// Read-only memory-mapping of an entire file, so loaders can parse straight
+//	out of the OS's page cache without first copying into a heap buffer.
+//	Unmaps upon destruction (or when reassigned/moved-from).
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef MappedFile_h
+#define MappedFile_h
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+
+class MappedFile
+{
+public:
+	MappedFile()	{ }
+	MappedFile(const std::string& fullPath)	{ open(fullPath); }
+	~MappedFile()	{ close(); }
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+	MappedFile(MappedFile&& other)				{ *this = std::move(other); }
+	MappedFile& operator=(MappedFile&& other);
+
+		// MEMBERS
+private:
+	const char*	pData		= nullptr;
+	size_t		numBytes	= 0;
+	uint64_t	modifyTime	= 0;	// seconds since epoch, or 0 if unknown
+  #ifdef _WIN32
+	void*		hFile		= nullptr;
+	void*		hMapping	= nullptr;
+  #endif
+
+		// METHODS
+public:
+	bool open(const std::string& fullPath);
+	void close();
+
+		// getters
+	bool		isOpen()	{ return pData != nullptr; }
+	const char*	data()		{ return pData; }
+	const char*	end()		{ return pData + numBytes; }
+	size_t		size()		{ return numBytes; }
+	uint64_t	mtime()		{ return modifyTime; }
+};
+
+#endif	// MappedFile_h
@@ -0,0 +1,433 @@
+//
+// MeshBVH.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "MeshBVH.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define MESHBVH_SSE2
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+	#define MESHBVH_NEON
+	#include <arm_neon.h>
+#endif
+
+
+const float TRAVERSAL_COST = 1.0f;		// (of visiting a node, relative to intersecting a triangle)
+
+const int STACK_SIZE = 256;				// (each level pushes at most three more than it pops, and depth is
+										//	under MAX_SAH_DEPTH plus 32 more levels of halving)
+
+struct BuildBox {						// (four wide, the last ignored, so it grows by SIMD)
+	float	min[4] = {  FLT_MAX,  FLT_MAX,  FLT_MAX,  FLT_MAX };
+	float	max[4] = { -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+	void grow(const float pointMin[4], const float pointMax[4]) {
+	  #if defined(MESHBVH_SSE2)
+		_mm_storeu_ps(min, _mm_min_ps(_mm_loadu_ps(min), _mm_loadu_ps(pointMin)));
+		_mm_storeu_ps(max, _mm_max_ps(_mm_loadu_ps(max), _mm_loadu_ps(pointMax)));
+	  #elif defined(MESHBVH_NEON)
+		vst1q_f32(min, vminq_f32(vld1q_f32(min), vld1q_f32(pointMin)));
+		vst1q_f32(max, vmaxq_f32(vld1q_f32(max), vld1q_f32(pointMax)));
+	  #else
+		for (int xyz = 0; xyz < 4; ++xyz) {
+			min[xyz] = std::min(min[xyz], pointMin[xyz]);
+			max[xyz] = std::max(max[xyz], pointMax[xyz]);
+		}
+	  #endif
+	}
+	void grow(const BuildBox& box)	{ grow(box.min, box.max); }
+	float area() const {					// (half of it, as only ratios matter; zero if empty)
+		float dx = max[0] - min[0], dy = max[1] - min[1], dz = max[2] - min[2];
+		return (dx < 0.0f) ? 0.0f : dx * dy + dy * dz + dz * dx;
+	}
+};
+
+struct BuildRef {						// a triangle while building
+	BuildBox	bounds;
+	float		center[4];
+	uint32_t	triangle;
+};
+
+struct BuildNode {						// of the binary tree, before it's collapsed
+	BuildBox	bounds;
+	uint32_t	first;					// its first ref if a leaf (count > 0), else its two children's first
+	uint32_t	count;
+};
+
+// Splits nodes (already bounded, as are their triangles' centers) recursively; a binary tree of n leaves has
+//	2n - 1 nodes, so 'nodes' is sized for as many as there could be, and never moves.
+//
+struct BVHBuilder {
+	std::vector<BuildRef>	  refs;
+	std::vector<BuildNode>	  nodes;
+	std::atomic<uint32_t> numNodes { 1 };
+
+	static int binOf(const BuildRef& ref, int axis, float centerMin, float scale, int numBins) {
+		return std::min(numBins - 1, (int) ((ref.center[axis] - centerMin) * scale));
+	}
+
+	void split(uint32_t iNode, const BuildBox& centers, int depth)
+	{
+		BuildNode& node = nodes[iNode];
+		uint32_t first = node.first, count = node.count;
+		BuildRef* pRefs = refs.data() + first;
+		if (count <= 1)
+			return;
+
+		// Cheapest split by SAH: of each axis's bins, the boundary below which the bins' boxes' area times
+		//	count, plus the same of those above, is least.  (All three axes binned in one pass; a small node in
+		//	fewer bins, as sweeping them would otherwise cost more than the binning.)
+		int numBins = (int) std::min<uint32_t>(MeshBVH::SAH_BINS, count);
+		BuildBox binBounds[3][MeshBVH::SAH_BINS];
+		uint32_t binCounts[3][MeshBVH::SAH_BINS] = { };
+		float scales[3];
+		bool isBinned = depth < MeshBVH::MAX_SAH_DEPTH;
+		for (int axis = 0; axis < 3; ++axis) {
+			float extent = centers.max[axis] - centers.min[axis];
+			scales[axis] = (extent > 0.0f) ? numBins / extent : 0.0f;
+		}
+		for (uint32_t iRef = 0; isBinned && iRef < count; ++iRef)
+			for (int axis = 0; axis < 3; ++axis) {
+				int iBin = binOf(pRefs[iRef], axis, centers.min[axis], scales[axis], numBins);
+				binBounds[axis][iBin].grow(pRefs[iRef].bounds);
+				++binCounts[axis][iBin];
+			}
+		int bestAxis = -1, bestBin = 0;
+		float bestCost = FLT_MAX;
+		for (int axis = 0; isBinned && axis < 3; ++axis) {
+			if (scales[axis] == 0.0f)
+				continue;
+			float aboveCosts[MeshBVH::SAH_BINS];
+			BuildBox swept;
+			uint32_t numSwept = 0;
+			for (int iBin = numBins - 1; iBin > 0; --iBin) {
+				swept.grow(binBounds[axis][iBin]);
+				numSwept += binCounts[axis][iBin];
+				aboveCosts[iBin] = numSwept ? swept.area() * numSwept : FLT_MAX;
+			}
+			swept = BuildBox();
+			numSwept = 0;
+			for (int iBin = 1; iBin < numBins; ++iBin) {
+				swept.grow(binBounds[axis][iBin - 1]);
+				numSwept += binCounts[axis][iBin - 1];
+				if (numSwept == 0 || aboveCosts[iBin] == FLT_MAX)
+					continue;
+				float cost = swept.area() * numSwept + aboveCosts[iBin];
+				if (cost < bestCost) {
+					bestCost = cost;
+					bestAxis = axis;
+					bestBin	 = iBin;
+				}
+			}
+		}
+		float area = node.bounds.area();
+		float leafCost = area * count, splitCost = area * TRAVERSAL_COST + bestCost;
+		if (count <= MeshBVH::MAX_LEAF_TRIANGLES && (bestAxis < 0 || leafCost <= splitCost))
+			return;
+
+		BuildRef* pMiddle;
+		if (bestAxis >= 0) {
+			float centerMin = centers.min[bestAxis], scale = scales[bestAxis];
+			pMiddle = std::partition(pRefs, pRefs + count, [&](const BuildRef& ref) {
+				return binOf(ref, bestAxis, centerMin, scale, numBins) < bestBin;
+			});
+		} else {		// (too deep, or centers all coincide: halve along the widest axis, by count)
+			int axis = 0;
+			for (int xyz = 1; xyz < 3; ++xyz)
+				if (centers.max[xyz] - centers.min[xyz] > centers.max[axis] - centers.min[axis])
+					axis = xyz;
+			pMiddle = pRefs + count / 2;
+			std::nth_element(pRefs, pMiddle, pRefs + count, [axis](const BuildRef& a, const BuildRef& b) {
+				return a.center[axis] < b.center[axis];
+			});
+		}
+		uint32_t numBelow = (uint32_t) (pMiddle - pRefs);
+
+		uint32_t iChildren = numNodes.fetch_add(2);
+		BuildNode* pChildren = &nodes[iChildren];
+		pChildren[0] = { BuildBox(), first, numBelow };
+		pChildren[1] = { BuildBox(), first + numBelow, count - numBelow };
+		BuildBox childCenters[2];
+		for (uint32_t iRef = 0; iRef < count; ++iRef) {
+			int iChild = (iRef < numBelow) ? 0 : 1;
+			pChildren[iChild].bounds.grow(pRefs[iRef].bounds);
+			childCenters[iChild].grow(pRefs[iRef].center, pRefs[iRef].center);
+		}
+		node.first = iChildren;
+		node.count = 0;
+
+		if (count >= MeshBVH::TRIANGLES_PER_TASK)
+			WorkerPool::Shared().parallelFor(2, [&](size_t iChild) {
+				split(iChildren + (uint32_t) iChild, childCenters[iChild], depth + 1);
+			});
+		else {
+			split(iChildren, childCenters[0], depth + 1);
+			split(iChildren + 1, childCenters[1], depth + 1);
+		}
+	}
+};
+
+// Four-wide node from a binary one: its two children, then whichever child (not a leaf) has the largest area
+//	replaced by its own two, until there are four.  Then so on for each child not a leaf, depth first.
+//
+static uint32_t collapse(const std::vector<BuildNode>& buildNodes, uint32_t iBuildNode, std::vector<BVHNode>& nodeList)
+{
+	uint32_t iNode = (uint32_t) nodeList.size();
+	nodeList.emplace_back();
+
+	uint32_t children[4];
+	int numChildren = 0;
+	const BuildNode& buildNode = buildNodes[iBuildNode];
+	if (buildNode.count > 0)				// (only if root: the whole mesh is one leaf)
+		children[numChildren++] = iBuildNode;
+	else {
+		children[numChildren++] = buildNode.first;
+		children[numChildren++] = buildNode.first + 1;
+	}
+	while (numChildren < 4) {
+		int iWidest = -1;
+		float widestArea = -1.0f;
+		for (int iChild = 0; iChild < numChildren; ++iChild) {
+			const BuildNode& child = buildNodes[children[iChild]];
+			if (child.count == 0 && child.bounds.area() > widestArea) {
+				widestArea = child.bounds.area();
+				iWidest = iChild;
+			}
+		}
+		if (iWidest < 0)
+			break;
+		uint32_t iFirst = buildNodes[children[iWidest]].first;
+		children[iWidest] = iFirst;
+		children[numChildren++] = iFirst + 1;
+	}
+
+	for (int iChild = 0; iChild < 4; ++iChild) {
+		BuildBox bounds;					// (empty, for missing children: no ray hits it)
+		uint32_t link = 0;
+		if (iChild < numChildren) {
+			const BuildNode& child = buildNodes[children[iChild]];
+			bounds = child.bounds;
+			link = (child.count > 0) ? MeshBVH::LEAF_BIT | child.first << 2 | (child.count - 1)
+									 : collapse(buildNodes, children[iChild], nodeList);
+		}
+		BVHNode& node = nodeList[iNode];	// (after recursing, which may have moved it)
+		for (int xyz = 0; xyz < 3; ++xyz) {
+			node.bounds[xyz][iChild]	 = bounds.min[xyz];
+			node.bounds[xyz + 3][iChild] = bounds.max[xyz];
+		}
+		node.child[iChild] = link;
+	}
+	return iNode;
+}
+
+
+void MeshBVH::build(const uint8_t* pVertices, size_t vertexStride, const uint32_t* indices, size_t indexCount)
+{
+	clear();
+	size_t numTriangles = indexCount / 3;
+	if (numTriangles == 0 || numTriangles >= (LEAF_BIT >> 2))		// (more than leaves can address: left unbuilt)
+		return;
+
+	WorkerPool& pool = WorkerPool::Shared();
+	size_t numTasks = (numTriangles + TRIANGLES_PER_TASK - 1) / TRIANGLES_PER_TASK;
+	auto position = [&](uint32_t index, float xyz[3]) {
+		memcpy(xyz, pVertices + (size_t) index * vertexStride, 3 * sizeof(float));
+	};
+
+	BVHBuilder builder;
+	builder.refs.resize(numTriangles);
+	builder.nodes.resize(2 * numTriangles - 1);
+	std::vector<BuildBox> taskBounds(numTasks), taskCenters(numTasks);
+	pool.parallelFor(numTasks, [&](size_t iTask) {
+		size_t end = std::min(numTriangles, (iTask + 1) * TRIANGLES_PER_TASK);
+		for (size_t iTriangle = iTask * TRIANGLES_PER_TASK; iTriangle < end; ++iTriangle) {
+			BuildRef& ref = builder.refs[iTriangle];
+			for (int iCorner = 0; iCorner < 3; ++iCorner) {
+				float corner[4] = { };
+				position(indices[3 * iTriangle + iCorner], corner);
+				ref.bounds.grow(corner, corner);
+			}
+			for (int xyz = 0; xyz < 4; ++xyz)
+				ref.center[xyz] = 0.5f * (ref.bounds.min[xyz] + ref.bounds.max[xyz]);
+			ref.triangle = (uint32_t) iTriangle;
+			taskBounds[iTask].grow(ref.bounds);
+			taskCenters[iTask].grow(ref.center, ref.center);
+		}
+	});
+	BuildNode& root = builder.nodes[0];
+	root = { BuildBox(), 0, (uint32_t) numTriangles };
+	BuildBox centers;
+	for (size_t iTask = 0; iTask < numTasks; ++iTask) {
+		root.bounds.grow(taskBounds[iTask]);
+		centers.grow(taskCenters[iTask]);
+	}
+	builder.split(0, centers, 0);
+
+	builder.nodes.resize(builder.numNodes);
+	nodeList.reserve((builder.nodes.size() + 1) / 2);		// (at most one per binary node that's not a leaf)
+	collapse(builder.nodes, 0, nodeList);
+
+	triangleList.resize(numTriangles);				// (in leaf order)
+	pool.parallelFor(numTasks, [&](size_t iTask) {
+		size_t end = std::min(numTriangles, (iTask + 1) * TRIANGLES_PER_TASK);
+		for (size_t iRef = iTask * TRIANGLES_PER_TASK; iRef < end; ++iRef) {
+			BVHTriangle& triangle = triangleList[iRef];
+			triangle.triangle = builder.refs[iRef].triangle;
+			const uint32_t* corners = &indices[3 * triangle.triangle];
+			float second[3], third[3];
+			position(corners[0], triangle.corner);
+			position(corners[1], second);
+			position(corners[2], third);
+			for (int xyz = 0; xyz < 3; ++xyz) {
+				triangle.edge1[xyz] = second[xyz] - triangle.corner[xyz];
+				triangle.edge2[xyz] = third[xyz]  - triangle.corner[xyz];
+			}
+		}
+	});
+}
+
+void MeshBVH::clear()
+{
+	std::vector<BVHNode>().swap(nodeList);
+	std::vector<BVHTriangle>().swap(triangleList);
+}
+
+
+// Möller-Trumbore: the hit's barycentric coordinates and distance, from determinants.
+//
+static bool intersectTriangle(const BVHTriangle& triangle, const float origin[3], const float direction[3],
+							  PickHit& hit)
+{
+	auto cross = [](const float a[3], const float b[3], float out[3]) {
+		out[0] = a[1] * b[2] - a[2] * b[1];
+		out[1] = a[2] * b[0] - a[0] * b[2];
+		out[2] = a[0] * b[1] - a[1] * b[0];
+	};
+	auto dot = [](const float a[3], const float b[3]) { return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]; };
+
+	float p[3];
+	cross(direction, triangle.edge2, p);
+	float determinant = dot(triangle.edge1, p);
+	if (determinant == 0.0f)				// (ray parallel to its plane, or it's degenerate)
+		return false;
+	float inverse = 1.0f / determinant;
+	float s[3] = { origin[0] - triangle.corner[0], origin[1] - triangle.corner[1], origin[2] - triangle.corner[2] };
+	float u = dot(s, p) * inverse;
+	if (u < 0.0f || u > 1.0f)
+		return false;
+	float q[3];
+	cross(s, triangle.edge1, q);
+	float v = dot(direction, q) * inverse;
+	if (v < 0.0f || u + v > 1.0f)
+		return false;
+	float distance = dot(triangle.edge2, q) * inverse;
+	if (distance <= 0.0f || distance >= hit.distance)
+		return false;
+	hit.distance = distance;
+	hit.triangle = triangle.triangle;
+	hit.u = u;
+	hit.v = v;
+	return true;
+}
+
+bool MeshBVH::intersect(const float origin[3], const float direction[3], PickHit& hit) const
+{
+	if (nodeList.empty())
+		return false;
+
+	// Per axis, which of a box's planes the ray meets first (so an empty box, its minimum above its maximum,
+	//	is never hit), and its reciprocal direction (a tiny one rather than zero, lest 0 * infinity be NaN).
+	float inverse[3];
+	int iNear[3], iFar[3];
+	for (int xyz = 0; xyz < 3; ++xyz) {
+		float component = direction[xyz];
+		if (fabsf(component) < 1e-30f)
+			component = copysignf(1e-30f, component);
+		inverse[xyz] = 1.0f / component;
+		iNear[xyz] = (component < 0.0f) ? xyz + 3 : xyz;
+		iFar[xyz]  = (component < 0.0f) ? xyz : xyz + 3;
+	}
+
+	struct Pending {
+		uint32_t	link;
+		float		distance;				// (to its box)
+	};
+	Pending stack[STACK_SIZE];
+	int numPending = 0;
+	stack[numPending++] = { 0, 0.0f };
+	bool isHit = false;
+
+	while (numPending > 0) {
+		Pending pending = stack[--numPending];
+		if (pending.distance >= hit.distance)		// (something nearer was hit since it was pushed)
+			continue;
+		if (pending.link & LEAF_BIT) {
+			uint32_t first = (pending.link & ~LEAF_BIT) >> 2, count = (pending.link & 3) + 1;
+			for (uint32_t iTriangle = first; iTriangle < first + count; ++iTriangle)
+				isHit |= intersectTriangle(triangleList[iTriangle], origin, direction, hit);
+			continue;
+		}
+
+		// All four children's slabs at once: a box is hit where the ray's farthest entry precedes its nearest exit.
+		const BVHNode& node = nodeList[pending.link];
+		alignas(16) float distances[4];
+		int hitMask = 0;
+	  #if defined(MESHBVH_SSE2)
+		__m128 entry = _mm_setzero_ps(), exit = _mm_set1_ps(hit.distance);
+		for (int xyz = 0; xyz < 3; ++xyz) {
+			__m128 start = _mm_set1_ps(origin[xyz]), scale = _mm_set1_ps(inverse[xyz]);
+			entry = _mm_max_ps(entry, _mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.bounds[iNear[xyz]]), start), scale));
+			exit  = _mm_min_ps(exit,  _mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.bounds[iFar[xyz]]), start), scale));
+		}
+		hitMask = _mm_movemask_ps(_mm_cmple_ps(entry, exit));
+		_mm_store_ps(distances, entry);
+	  #elif defined(MESHBVH_NEON)
+		float32x4_t entry = vdupq_n_f32(0.0f), exit = vdupq_n_f32(hit.distance);
+		for (int xyz = 0; xyz < 3; ++xyz) {
+			float32x4_t start = vdupq_n_f32(origin[xyz]), scale = vdupq_n_f32(inverse[xyz]);
+			entry = vmaxq_f32(entry, vmulq_f32(vsubq_f32(vld1q_f32(node.bounds[iNear[xyz]]), start), scale));
+			exit  = vminq_f32(exit,  vmulq_f32(vsubq_f32(vld1q_f32(node.bounds[iFar[xyz]]), start), scale));
+		}
+		uint32x4_t isInside = vcleq_f32(entry, exit);
+		hitMask = (vgetq_lane_u32(isInside, 0) & 1) | (vgetq_lane_u32(isInside, 1) & 2)
+				| (vgetq_lane_u32(isInside, 2) & 4) | (vgetq_lane_u32(isInside, 3) & 8);
+		vst1q_f32(distances, entry);
+	  #else
+		for (int iChild = 0; iChild < 4; ++iChild) {
+			float entry = 0.0f, exit = hit.distance;
+			for (int xyz = 0; xyz < 3; ++xyz) {
+				entry = std::max(entry, (node.bounds[iNear[xyz]][iChild] - origin[xyz]) * inverse[xyz]);
+				exit  = std::min(exit,	(node.bounds[iFar[xyz]][iChild]  - origin[xyz]) * inverse[xyz]);
+			}
+			distances[iChild] = entry;
+			hitMask |= (entry <= exit) << iChild;
+		}
+	  #endif
+
+		// Push those hit farthest first, so the nearest is visited next.
+		Pending hits[4];
+		int numHits = 0;
+		for (int iChild = 0; iChild < 4; ++iChild) {
+			if (! (hitMask & (1 << iChild)))
+				continue;
+			int iHit = numHits++;
+			for ( ; iHit > 0 && hits[iHit - 1].distance < distances[iChild]; --iHit)
+				hits[iHit] = hits[iHit - 1];
+			hits[iHit] = { node.child[iChild], distances[iChild] };
+		}
+		for (int iHit = 0; iHit < numHits; ++iHit)
+			stack[numPending++] = hits[iHit];
+	}
+	return isHit;
+}
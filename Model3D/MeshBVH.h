@@ -0,0 +1,83 @@
+//
+// MeshBVH.h
+//	Vulkan Convenience 3D Objects
+//
+// Bounding volume hierarchy over a loaded mesh's triangles, for picking:
+//	which triangle a ray (e.g. from the camera through a tap on screen, see
+//	gxCamera::screenRay) hits first, in microseconds even for meshes of
+//	millions of triangles, rather than testing every one.
+// Built with the surface area heuristic (SAH), binned: each node splits its
+//	triangles, by centroid, where the two halves' bounding boxes' areas times
+//	their triangle counts are least, i.e. where a ray is least likely to have
+//	to test many.  Big subtrees are built in parallel on the shared WorkerPool.
+// The binary tree built is then collapsed, four children per node, into one
+//	flat array in depth-first order, each node holding its children's boxes
+//	side by side so a ray tests all four at once (SSE2 or NEON) and visits
+//	those it hits nearest first, skipping any beyond the nearest hit so far.
+//	Triangles are copied out in leaf order as a corner and two edges, ready
+//	to intersect, so nothing in the mesh itself is read to pick.
+// Triangles are hit from either side, as the viewer may show backfaces.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef MeshBVH_h
+#define MeshBVH_h
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cfloat>
+
+
+struct PickHit {
+	float		distance = FLT_MAX;		// along the ray, in lengths of its direction
+	uint32_t	triangle = 0;			// (its first index is 3 * this)
+	float		u = 0.0f;				// barycentric coordinates of the hit: how much toward
+	float		v = 0.0f;				//	the triangle's second corner, and its third
+};
+
+struct alignas(16) BVHNode {		// four children, their bounds side by side:
+	float		bounds[6][4];			//	minimum x, y, z then maximum x, y, z (empty if min > max)
+	uint32_t	child[4];				// a node's index; or if LEAF_BIT, first triangle << 2 | count - 1
+};
+
+struct BVHTriangle {					// as intersected: one corner, and the two edges from it
+	float		corner[3];
+	float		edge1[3];
+	float		edge2[3];
+	uint32_t	triangle;				// (in the mesh)
+};
+
+
+class MeshBVH
+{
+public:
+	static const uint32_t MAX_LEAF_TRIANGLES = 4;
+	static const int	  SAH_BINS = 16;
+	static const int	  MAX_SAH_DEPTH = 48;		// (deeper still, halves by count: bounds the stack)
+	static const size_t	  TRIANGLES_PER_TASK = 16 * 1024;
+	static const uint32_t LEAF_BIT = 0x80000000;
+
+		// MEMBERS
+private:
+	std::vector<BVHNode>	 nodeList;			// (root first)
+	std::vector<BVHTriangle> triangleList;
+
+		// METHODS
+public:
+	// Over triangles of 32-bit 'indices' into vertices whose positions are three floats at their start.
+	void build(const uint8_t* pVertices, size_t vertexStride, const uint32_t* indices, size_t indexCount);
+	void clear();
+
+	// Nearest triangle the ray hits, if any (within 'hit.distance' as given), in the same space as the mesh.
+	bool intersect(const float origin[3], const float direction[3], PickHit& hit) const;
+
+	bool isBuilt() const				{ return ! nodeList.empty(); }
+	size_t nodeCount() const			{ return nodeList.size(); }
+	size_t triangleCount() const		{ return triangleList.size(); }
+	size_t bytes() const				{ return nodeList.size() * sizeof(BVHNode)
+												+ triangleList.size() * sizeof(BVHTriangle); }
+};
+
+#endif	// MeshBVH_h
@@ -0,0 +1,196 @@
+//
+// MeshCache.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "MeshCache.h"
+#include "FileSystem.h"
+#include "MeshCodec.h"
+#include "Hash64.h"
+#include <sys/stat.h>
+#include <cstdio>
+
+
+static const char MeshCacheMagic[4] = { 'V', 'A', 'm', 'c' };
+
+static uint64_t alignUp(uint64_t offset, uint64_t alignment) {
+	return (offset + alignment - 1) / alignment * alignment;
+}
+
+
+// e.g. ".../VulkanViewer/viking_room-3f9c0a2b7d41e6c5.meshcache" where hex is of the source's full path,
+//	so same-named models from different directories don't collide.
+//
+string MeshCache::CachePathFor(const string& sourceFullPath)
+{
+	string directory = FileSystem::AppLocalStorageDirectory();
+	if (directory.empty())
+		return "";
+
+	size_t iSlash = sourceFullPath.find_last_of("/\\");
+	string baseName = sourceFullPath.substr(iSlash == string::npos ? 0 : iSlash + 1);
+	baseName = baseName.substr(0, baseName.find_last_of('.'));
+
+	char hex[17];
+	snprintf(hex, sizeof(hex), "%016llx", (unsigned long long) Hash64(sourceFullPath.data(), sourceFullPath.size()));
+
+	return directory + baseName + "-" + hex + ".meshcache";
+}
+
+bool MeshCache::HashFile(const string& fullPath, uint64_t& hash, uint64_t& size, uint64_t& modifyTime)
+{
+	MappedFile file(fullPath);
+	if (! file.isOpen())
+		return false;
+	hash = Hash64(file.data(), file.size());
+	size = file.size();
+	modifyTime = file.mtime();
+	return true;
+}
+
+
+bool MeshCache::open(const string& sourceFullPath)
+{
+	close();
+	sourcePath = sourceFullPath;
+	cachePath = CachePathFor(sourceFullPath);
+
+	struct stat source;
+	if (cachePath.empty() || stat(sourcePath.c_str(), &source) != 0)
+		return false;
+
+	if (! mapping.open(cachePath) || mapping.size() < sizeof(MeshCacheHeader)) {
+		close();
+		return false;
+	}
+	memcpy(&header, mapping.data(), sizeof(header));
+
+	uint64_t vertexBytes = (uint64_t) header.vertexCount * header.vertexStride;
+	uint64_t indexBytes	 = (uint64_t) header.indexCount * header.indexSize;
+	bool isValid = memcmp(header.magic, MeshCacheMagic, sizeof(header.magic)) == 0
+				&& header.version == VERSION
+				&& header.sourceSize == (uint64_t) source.st_size
+				&& (header.encoding == CACHE_MESHCODEC
+					|| (header.encoding == CACHE_RAW && header.vertexBytes == vertexBytes && header.indexBytes == indexBytes))
+				&& header.vertexOffset + header.vertexBytes <= mapping.size()
+				&& header.indexOffset + header.indexBytes <= mapping.size()
+				&& (header.indexSize == sizeof(uint16_t) || header.indexSize == sizeof(uint32_t))
+				&& header.vertexCount > 0 && header.vertexStride > 0;
+	for (auto& section : header.sections)
+		isValid = isValid && section.offset + (uint64_t) section.count * section.elementSize <= mapping.size();
+
+	if (isValid && header.sourceModifyTime != (uint64_t) source.st_mtime) {
+		uint64_t hash, size, modifyTime;	// timestamp changed, but did contents?
+		isValid = HashFile(sourcePath, hash, size, modifyTime) && hash == header.sourceHash;
+		if (isValid) {
+			FILE* pFile = fopen(cachePath.c_str(), "r+b");		// if not, avoid re-hashing next time
+			if (pFile) {
+				MeshCacheHeader updated = header;
+				updated.sourceModifyTime = modifyTime;
+				fwrite(&updated, sizeof(updated), 1, pFile);
+				fclose(pFile);
+			}
+		}
+	}
+	if (! isValid)
+		close();
+	return isValid;
+}
+
+bool MeshCache::decode(void* pVertices, void* pIndices)
+{
+	return isEncoded()
+		&& MeshCodec::DecodeVertices((const uint8_t*) mapping.data() + header.vertexOffset, header.vertexBytes,
+									 header.vertexCount, header.vertexStride, (uint8_t*) pVertices)
+		&& MeshCodec::DecodeIndices((const uint8_t*) mapping.data() + header.indexOffset, header.indexBytes,
+									header.indexCount, header.indexSize, pIndices);
+}
+
+void MeshCache::close()
+{
+	mapping.close();
+	header = {};
+}
+
+
+// Write to a temporary file first, then rename it into place, so that an interrupted write (or another
+//	instance of the app loading the same model) never sees a partial cache file.
+//
+bool MeshCache::write(AttributeBits attribits, const void* pVertices, uint32_t vertexCount, uint32_t vertexStride,
+					  const void* pIndices, uint32_t indexCount, uint32_t indexSize,
+					  const MeshCacheSection* pSections, bool isEncoded)
+{
+	if (cachePath.empty())
+		cachePath = CachePathFor(sourcePath);
+
+	MeshCacheHeader newHeader = {};
+	if (cachePath.empty() || vertexCount == 0
+		|| ! HashFile(sourcePath, newHeader.sourceHash, newHeader.sourceSize, newHeader.sourceModifyTime))
+		return false;
+
+	size_t vertexBytes = (size_t) vertexCount * vertexStride;
+	size_t indexBytes  = (size_t) indexCount * indexSize;
+	vector<uint8_t> encodedVertices, encodedIndices;
+	if (isEncoded && MeshCodec::EncodeVertices((const uint8_t*) pVertices, vertexCount, vertexStride, encodedVertices)
+				  && MeshCodec::EncodeIndices(pIndices, indexCount, indexSize, encodedIndices)) {
+		newHeader.encoding = CACHE_MESHCODEC;
+		pVertices	= encodedVertices.data();
+		vertexBytes = encodedVertices.size();
+		pIndices	= encodedIndices.data();
+		indexBytes	= encodedIndices.size();
+	}
+
+	memcpy(newHeader.magic, MeshCacheMagic, sizeof(newHeader.magic));
+	newHeader.version		= VERSION;
+	newHeader.attributeBits	= attribits;
+	newHeader.vertexStride	= vertexStride;
+	newHeader.vertexCount	= vertexCount;
+	newHeader.indexCount	= indexCount;
+	newHeader.indexSize		= indexSize;
+	newHeader.vertexBytes	= vertexBytes;
+	newHeader.indexBytes	= indexBytes;
+	newHeader.vertexOffset	= alignUp(sizeof(MeshCacheHeader), DATA_ALIGNMENT);
+	newHeader.indexOffset	= alignUp(newHeader.vertexOffset + vertexBytes, DATA_ALIGNMENT);
+	uint64_t offset			= alignUp(newHeader.indexOffset + indexBytes, DATA_ALIGNMENT);
+	for (int iSection = 0; pSections && iSection < MAX_CACHE_SECTIONS; ++iSection) {
+		newHeader.sections[iSection] = { offset, pSections[iSection].count, pSections[iSection].elementSize };
+		offset = alignUp(offset + (uint64_t) pSections[iSection].count * pSections[iSection].elementSize, DATA_ALIGNMENT);
+	}
+
+	string tempPath = cachePath + ".tmp";
+	FILE* pFile = fopen(tempPath.c_str(), "wb");
+	if (! pFile) {
+		Log(ERROR, "MeshCache: can't create %s", tempPath.c_str());
+		return false;
+	}
+	static const char zeroes[DATA_ALIGNMENT] = { };
+
+	auto put = [pFile](const void* pBytes, size_t numBytes) {
+		return numBytes == 0 || fwrite(pBytes, numBytes, 1, pFile) == 1;
+	};
+	bool isOK = put(&newHeader, sizeof(newHeader))
+			 && put(zeroes, newHeader.vertexOffset - sizeof(newHeader))
+			 && put(pVertices, vertexBytes)
+			 && put(zeroes, newHeader.indexOffset - newHeader.vertexOffset - vertexBytes)
+			 && put(pIndices, indexBytes);
+	uint64_t written = newHeader.indexOffset + indexBytes;
+	for (int iSection = 0; pSections && iSection < MAX_CACHE_SECTIONS && isOK; ++iSection) {
+		size_t sectionBytes = (size_t) pSections[iSection].count * pSections[iSection].elementSize;
+		isOK = put(zeroes, newHeader.sections[iSection].offset - written)
+			&& put(pSections[iSection].pData, sectionBytes);
+		written = newHeader.sections[iSection].offset + sectionBytes;
+	}
+	isOK = (fclose(pFile) == 0) && isOK;
+
+	remove(cachePath.c_str());		// (Windows' rename won't replace an existing file)
+	if (! isOK || rename(tempPath.c_str(), cachePath.c_str()) != 0) {
+		remove(tempPath.c_str());
+		Log(ERROR, "MeshCache: FAILED writing %s", cachePath.c_str());
+		return false;
+	}
+	return true;
+}
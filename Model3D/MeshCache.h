@@ -0,0 +1,125 @@
+//
+// MeshCache.h
+//	Vulkan Convenience 3D Objects
+//
+// On-disk binary cache of a fully-loaded (parsed + welded) mesh, stored in
+//	the app's local storage directory, so subsequent loads of the same model
+//	simply memory-map it and point MeshObject directly into that mapping:
+//	no parsing, no welding, no copying.  Vertex/index data is only paged-in
+//	as it's actually touched (i.e. when uploaded to the GPU).
+// Validated against its source file by size and modification time, falling
+//	back to a content hash (Hash64) if only the timestamp differs (e.g. the
+//	asset was copied or touched, but not changed).  Any version or layout
+//	mismatch simply means a cache miss, after which it's rewritten.
+// Vertices and indices may instead be stored encoded (see MeshCodec), for
+//	a file typically a quarter to a half the size, at the cost of decoding
+//	them into memory on load rather than pointing into the mapping.
+// Files are native-endian; this cache is local to the machine writing it.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef MeshCache_h
+#define MeshCache_h
+
+#include "VerticesDynamic.h"
+#include "MappedFile.h"
+
+
+enum MeshCacheSectionID {		// optional arrays of fixed-size elements following the indices:
+	CACHED_CHUNKS,				//	MeshChunk
+	CACHED_MESHLETS,			//	Meshlet
+	CACHED_LODS,				//	MeshLOD
+	CACHED_LOD_INDICES,			//	(same type as main indices)
+	CACHED_SUBMESHES,			//	Submesh
+	CACHED_MATERIAL_COLORS,		//	float[3] per ModelMaterial
+	CACHED_NAMES,				//	char: null-terminated shape names, then each material's name and texture
+	CACHED_BOUNDS,				//	MeshBounds (one)
+	CACHED_TANGENTS,			//	VertexTangent (one per vertex, if requested)
+	CACHED_QUANTIZATION,		//	QuantizedVertexFormat and its QuantizationBudget (one, if quantized)
+	CACHED_OPTIONS,				//	(one) what else of ModelDefSpec it was loaded with, as ModelLoader defines
+	MAX_CACHE_SECTIONS = 16		// (room for more without changing header layout)
+};
+
+enum MeshCacheEncoding {		// how vertices and indices are stored:
+	CACHE_RAW,					//	as is, to be used in place
+	CACHE_MESHCODEC				//	encoded by MeshCodec, to be decoded
+};
+
+struct MeshCacheSection {		// (for writing one)
+	const void*	pData		= nullptr;
+	uint32_t	count		= 0;
+	uint32_t	elementSize	= 0;
+};
+
+struct MeshCacheHeader
+{
+	char		magic[4];			// "VAmc"
+	uint32_t	version;
+	uint64_t	sourceHash;			// Hash64 of source file's contents
+	uint64_t	sourceSize;
+	uint64_t	sourceModifyTime;
+	uint32_t	attributeBits;		// (as AttributeBits, but fixed-size)
+	uint32_t	vertexStride;		// bytes per vertex
+	uint32_t	vertexCount;
+	uint32_t	indexCount;
+	uint32_t	indexSize;			// bytes per index
+	uint32_t	encoding;			// (as MeshCacheEncoding)
+	uint64_t	vertexOffset;		// from beginning of file, all
+	uint64_t	indexOffset;		//	aligned to DATA_ALIGNMENT
+	uint64_t	vertexBytes;		// as stored: if raw, vertexCount * vertexStride
+	uint64_t	indexBytes;			//	and indexCount * indexSize
+	struct {
+		uint64_t	offset;
+		uint32_t	count;
+		uint32_t	elementSize;	// (checked against reader's, to catch layout changes)
+	}			sections[MAX_CACHE_SECTIONS];
+};
+
+
+class MeshCache
+{
+public:
+	static const uint32_t VERSION = 10;
+	static const uint32_t DATA_ALIGNMENT = 16;
+
+		// MEMBERS
+private:
+	string			sourcePath;
+	string			cachePath;
+	MappedFile		mapping;
+	MeshCacheHeader	header = {};
+
+		// METHODS
+public:
+	bool open(const string& sourceFullPath);
+	bool write(AttributeBits attribits, const void* pVertices, uint32_t vertexCount, uint32_t vertexStride,
+			   const void* pIndices, uint32_t indexCount, uint32_t indexSize,
+			   const MeshCacheSection* pSections = nullptr,		// (if given, array of MAX_CACHE_SECTIONS)
+			   bool isEncoded = false);							// (falling back to raw if it can't be)
+	bool decode(void* pVertices, void* pIndices);	// (if encoded: into vertexCount * vertexStride and
+	void close();									//	indexCount * indexSize bytes; false if corrupt)
+
+	static string CachePathFor(const string& sourceFullPath);
+	static bool	  HashFile(const string& fullPath, uint64_t& hash, uint64_t& size, uint64_t& modifyTime);
+
+		// getters (valid after open() succeeds)
+	bool			isOpen()		{ return mapping.isOpen(); }
+	AttributeBits	attributes()	{ return (AttributeBits) header.attributeBits; }
+	bool			isEncoded()		{ return header.encoding == CACHE_MESHCODEC; }
+	const void*		vertices()		{ return mapping.data() + header.vertexOffset; }	// (unless encoded)
+	uint32_t		vertexCount()	{ return header.vertexCount; }
+	uint32_t		vertexStride()	{ return header.vertexStride; }
+	const void*		indices()		{ return mapping.data() + header.indexOffset; }		// (unless encoded)
+	uint32_t		indexCount()	{ return header.indexCount; }
+	uint32_t		indexSize()		{ return header.indexSize; }
+
+	template<typename T>
+	const T* section(MeshCacheSectionID id, uint32_t& count)	// (nullptr if absent or of wrong element type)
+	{
+		count = (header.sections[id].elementSize == sizeof(T)) ? header.sections[id].count : 0;
+		return count > 0 ? (const T*) (mapping.data() + header.sections[id].offset) : nullptr;
+	}
+};
+
+#endif	// MeshCache_h
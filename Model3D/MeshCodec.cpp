@@ -0,0 +1,568 @@
+//
+// MeshCodec.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "MeshCodec.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define MESHCODEC_SSE2
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+	#define MESHCODEC_NEON
+	#include <arm_neon.h>
+#endif
+
+using std::vector;
+
+
+// Vertex stream:	uint32_t offset of each page (from start of stream), then the pages.
+//	Page:			its blocks of BLOCK_VERTICES (the last padded by repeating its last vertex).
+//	Block:			per 4 byte columns, a byte of their 2-bit modes (first column lowest), then their data.
+//
+static const size_t BLOCK_VERTICES = 16;
+
+enum ColumnMode {				// how each of a block's 16 (zigzagged) differences is packed:
+	ALL_ZERO,					//	not at all
+	TWO_BITS,					//	4 to a byte, first lowest
+	FOUR_BITS,					//	2 to a byte, first lowest
+	EIGHT_BITS					//	as is
+};
+
+static const size_t ModeBytes[4] = { 0, 4, 8, 16 };
+
+static size_t groupBytes(uint8_t modes)		// (of 4 columns' data)
+{
+	return ModeBytes[modes & 3] + ModeBytes[(modes >> 2) & 3] + ModeBytes[(modes >> 4) & 3] + ModeBytes[modes >> 6];
+}
+
+static uint8_t zigzag8(uint8_t delta)
+{
+	return (uint8_t) ((delta << 1) ^ (uint8_t) ((int8_t) delta >> 7));
+}
+
+
+static void encodePage(const uint8_t* pVertices, size_t vertexCount, size_t stride, vector<uint8_t>& encoded)
+{
+	uint8_t last[MeshCodec::MAX_VERTEX_STRIDE] = { };
+	for (size_t iBlock = 0; iBlock < vertexCount; iBlock += BLOCK_VERTICES) {
+		size_t numInBlock = std::min(BLOCK_VERTICES, vertexCount - iBlock);
+		for (size_t column = 0; column < stride; column += 4) {
+			size_t iModes = encoded.size();
+			encoded.push_back(0);
+			for (size_t k = 0; k < 4; ++k) {
+				uint8_t deltas[BLOCK_VERTICES], widest = 0;
+				uint8_t previous = last[column + k];
+				for (size_t i = 0; i < BLOCK_VERTICES; ++i) {
+					uint8_t value = pVertices[(iBlock + std::min(i, numInBlock - 1)) * stride + column + k];
+					deltas[i] = zigzag8((uint8_t) (value - previous));
+					widest |= deltas[i];
+					previous = value;
+				}
+				last[column + k] = previous;
+
+				ColumnMode mode = (widest == 0) ? ALL_ZERO : (widest < 4) ? TWO_BITS : (widest < 16) ? FOUR_BITS : EIGHT_BITS;
+				encoded[iModes] |= (uint8_t) (mode << (2 * k));
+				if (mode == TWO_BITS)
+					for (size_t i = 0; i < BLOCK_VERTICES; i += 4)
+						encoded.push_back((uint8_t) (deltas[i] | deltas[i + 1] << 2 | deltas[i + 2] << 4 | deltas[i + 3] << 6));
+				else if (mode == FOUR_BITS)
+					for (size_t i = 0; i < BLOCK_VERTICES; i += 2)
+						encoded.push_back((uint8_t) (deltas[i] | deltas[i + 1] << 4));
+				else if (mode == EIGHT_BITS)
+					encoded.insert(encoded.end(), deltas, deltas + BLOCK_VERTICES);
+			}
+		}
+	}
+}
+
+
+// Decoding: each byte column of a block is a 16-byte vector, unpacked, un-zigzagged and summed; vectors of
+//	adjacent columns are then transposed into vertices, 16 columns (a 16-byte store per vertex) at a time
+//	where the stride allows, else 4.
+//
+#if defined(MESHCODEC_SSE2)
+
+typedef __m128i Bytes16;
+
+static Bytes16 zipLow8(Bytes16 a, Bytes16 b)	{ return _mm_unpacklo_epi8(a, b); }
+static Bytes16 zipHigh8(Bytes16 a, Bytes16 b)	{ return _mm_unpackhi_epi8(a, b); }
+static Bytes16 zipLow16(Bytes16 a, Bytes16 b)	{ return _mm_unpacklo_epi16(a, b); }
+static Bytes16 zipHigh16(Bytes16 a, Bytes16 b)	{ return _mm_unpackhi_epi16(a, b); }
+static Bytes16 zipLow32(Bytes16 a, Bytes16 b)	{ return _mm_unpacklo_epi32(a, b); }
+static Bytes16 zipHigh32(Bytes16 a, Bytes16 b)	{ return _mm_unpackhi_epi32(a, b); }
+static Bytes16 zipLow64(Bytes16 a, Bytes16 b)	{ return _mm_unpacklo_epi64(a, b); }
+static Bytes16 zipHigh64(Bytes16 a, Bytes16 b)	{ return _mm_unpackhi_epi64(a, b); }
+static void store16(uint8_t* pOut, Bytes16 v)	{ _mm_storeu_si128((__m128i*) pOut, v); }
+
+static Bytes16 unpackColumn(ColumnMode mode, const uint8_t* pData)
+{
+	switch (mode) {
+		case ALL_ZERO:
+			return _mm_setzero_si128();
+		case TWO_BITS: {
+			int32_t packed;
+			memcpy(&packed, pData, sizeof(packed));
+			__m128i bytes = _mm_cvtsi32_si128(packed), mask = _mm_set1_epi8(3);
+			__m128i bits0 = _mm_and_si128(bytes, mask);
+			__m128i bits2 = _mm_and_si128(_mm_srli_epi16(bytes, 2), mask);
+			__m128i bits4 = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+			__m128i bits6 = _mm_and_si128(_mm_srli_epi16(bytes, 6), mask);
+			return _mm_unpacklo_epi16(_mm_unpacklo_epi8(bits0, bits2), _mm_unpacklo_epi8(bits4, bits6));
+		}
+		case FOUR_BITS: {
+			__m128i bytes = _mm_loadl_epi64((const __m128i*) pData), mask = _mm_set1_epi8(15);
+			return _mm_unpacklo_epi8(_mm_and_si128(bytes, mask), _mm_and_si128(_mm_srli_epi16(bytes, 4), mask));
+		}
+		default:
+			return _mm_loadu_si128((const __m128i*) pData);
+	}
+}
+
+static Bytes16 decodeColumn(ColumnMode mode, const uint8_t* pData, uint8_t& last)
+{
+	__m128i deltas = unpackColumn(mode, pData);
+	__m128i halved = _mm_and_si128(_mm_srli_epi16(deltas, 1), _mm_set1_epi8(0x7F));		// (no 8-bit shifts)
+	__m128i negate = _mm_sub_epi8(_mm_setzero_si128(), _mm_and_si128(deltas, _mm_set1_epi8(1)));
+	__m128i values = _mm_xor_si128(halved, negate);
+	values = _mm_add_epi8(values, _mm_slli_si128(values, 1));		// prefix sum: each the total of those before
+	values = _mm_add_epi8(values, _mm_slli_si128(values, 2));
+	values = _mm_add_epi8(values, _mm_slli_si128(values, 4));
+	values = _mm_add_epi8(values, _mm_slli_si128(values, 8));
+	values = _mm_add_epi8(values, _mm_set1_epi8((char) last));
+	last = (uint8_t) (_mm_extract_epi16(values, 7) >> 8);
+	return values;
+}
+
+#elif defined(MESHCODEC_NEON)
+
+typedef uint8x16_t Bytes16;
+
+static Bytes16 zipLow8(Bytes16 a, Bytes16 b)	{ return vzipq_u8(a, b).val[0]; }
+static Bytes16 zipHigh8(Bytes16 a, Bytes16 b)	{ return vzipq_u8(a, b).val[1]; }
+static Bytes16 zipLow16(Bytes16 a, Bytes16 b)	{ return vreinterpretq_u8_u16(vzipq_u16(vreinterpretq_u16_u8(a), vreinterpretq_u16_u8(b)).val[0]); }
+static Bytes16 zipHigh16(Bytes16 a, Bytes16 b)	{ return vreinterpretq_u8_u16(vzipq_u16(vreinterpretq_u16_u8(a), vreinterpretq_u16_u8(b)).val[1]); }
+static Bytes16 zipLow32(Bytes16 a, Bytes16 b)	{ return vreinterpretq_u8_u32(vzipq_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b)).val[0]); }
+static Bytes16 zipHigh32(Bytes16 a, Bytes16 b)	{ return vreinterpretq_u8_u32(vzipq_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b)).val[1]); }
+static Bytes16 zipLow64(Bytes16 a, Bytes16 b)	{ return vcombine_u8(vget_low_u8(a), vget_low_u8(b)); }
+static Bytes16 zipHigh64(Bytes16 a, Bytes16 b)	{ return vcombine_u8(vget_high_u8(a), vget_high_u8(b)); }
+static void store16(uint8_t* pOut, Bytes16 v)	{ vst1q_u8(pOut, v); }
+
+static Bytes16 unpackColumn(ColumnMode mode, const uint8_t* pData)
+{
+	switch (mode) {
+		case ALL_ZERO:
+			return vdupq_n_u8(0);
+		case TWO_BITS: {
+			uint32_t packed;
+			memcpy(&packed, pData, sizeof(packed));
+			uint8x8_t bytes = vreinterpret_u8_u32(vdup_n_u32(packed)), mask = vdup_n_u8(3);
+			uint8x8x2_t bits02 = vzip_u8(vand_u8(bytes, mask), vand_u8(vshr_n_u8(bytes, 2), mask));
+			uint8x8x2_t bits46 = vzip_u8(vand_u8(vshr_n_u8(bytes, 4), mask), vshr_n_u8(bytes, 6));
+			uint16x4x2_t quads = vzip_u16(vreinterpret_u16_u8(bits02.val[0]), vreinterpret_u16_u8(bits46.val[0]));
+			return vcombine_u8(vreinterpret_u8_u16(quads.val[0]), vreinterpret_u8_u16(quads.val[1]));
+		}
+		case FOUR_BITS: {
+			uint8x8_t bytes = vld1_u8(pData);
+			uint8x8x2_t nibbles = vzip_u8(vand_u8(bytes, vdup_n_u8(15)), vshr_n_u8(bytes, 4));
+			return vcombine_u8(nibbles.val[0], nibbles.val[1]);
+		}
+		default:
+			return vld1q_u8(pData);
+	}
+}
+
+static Bytes16 decodeColumn(ColumnMode mode, const uint8_t* pData, uint8_t& last)
+{
+	uint8x16_t deltas = unpackColumn(mode, pData), zero = vdupq_n_u8(0);
+	uint8x16_t values = veorq_u8(vshrq_n_u8(deltas, 1), vsubq_u8(zero, vandq_u8(deltas, vdupq_n_u8(1))));
+	values = vaddq_u8(values, vextq_u8(zero, values, 15));		// prefix sum: each the total of those before
+	values = vaddq_u8(values, vextq_u8(zero, values, 14));
+	values = vaddq_u8(values, vextq_u8(zero, values, 12));
+	values = vaddq_u8(values, vextq_u8(zero, values, 8));
+	values = vaddq_u8(values, vdupq_n_u8(last));
+	last = vgetq_lane_u8(values, 15);
+	return values;
+}
+
+#endif
+
+#if defined(MESHCODEC_SSE2) || defined(MESHCODEC_NEON)
+
+static const uint8_t* decodeGroup(const uint8_t* pData, uint8_t modes, uint8_t* last, Bytes16* columns)
+{
+	for (int k = 0; k < 4; ++k) {
+		ColumnMode mode = (ColumnMode) ((modes >> (2 * k)) & 3);
+		columns[k] = decodeColumn(mode, pData, last[k]);
+		pData += ModeBytes[mode];
+	}
+	return pData;
+}
+
+static void storeColumns4(const Bytes16* columns, uint8_t* pOut, size_t stride)
+{
+	Bytes16 pairs01 = zipLow8(columns[0], columns[1]), pairs01High = zipHigh8(columns[0], columns[1]);
+	Bytes16 pairs23 = zipLow8(columns[2], columns[3]), pairs23High = zipHigh8(columns[2], columns[3]);
+	uint8_t words[BLOCK_VERTICES * 4];		// (each vertex's 4 bytes)
+	store16(&words[0],	zipLow16(pairs01, pairs23));
+	store16(&words[16], zipHigh16(pairs01, pairs23));
+	store16(&words[32], zipLow16(pairs01High, pairs23High));
+	store16(&words[48], zipHigh16(pairs01High, pairs23High));
+	for (size_t i = 0; i < BLOCK_VERTICES; ++i)
+		memcpy(pOut + i * stride, &words[4 * i], 4);
+}
+
+static void storeColumns16(const Bytes16* columns, uint8_t* pOut, size_t stride)
+{
+	Bytes16 pairs[16], quads[16], octets[16];
+	for (int j = 0; j < 8; ++j) {			// pairs[j]: columns 2j,2j+1 of vertices 0-7; pairs[8 + j]: of 8-15
+		pairs[j]	 = zipLow8(columns[2 * j], columns[2 * j + 1]);
+		pairs[8 + j] = zipHigh8(columns[2 * j], columns[2 * j + 1]);
+	}
+	for (int h = 0; h < 2; ++h)				// quads[4m + j]: columns 4j-4j+3 of vertices 4m-4m+3
+		for (int j = 0; j < 4; ++j) {
+			quads[8 * h + j]	 = zipLow16(pairs[8 * h + 2 * j], pairs[8 * h + 2 * j + 1]);
+			quads[8 * h + 4 + j] = zipHigh16(pairs[8 * h + 2 * j], pairs[8 * h + 2 * j + 1]);
+		}
+	for (int m = 0; m < 4; ++m)				// octets[4m + 2h + 0/1]: columns 8h-8h+7 of vertices 4m,4m+1 / 4m+2,4m+3
+		for (int h = 0; h < 2; ++h) {
+			octets[4 * m + 2 * h]	  = zipLow32(quads[4 * m + 2 * h], quads[4 * m + 2 * h + 1]);
+			octets[4 * m + 2 * h + 1] = zipHigh32(quads[4 * m + 2 * h], quads[4 * m + 2 * h + 1]);
+		}
+	for (int m = 0; m < 4; ++m) {
+		store16(pOut + (4 * m)	   * stride, zipLow64(octets[4 * m], octets[4 * m + 2]));
+		store16(pOut + (4 * m + 1) * stride, zipHigh64(octets[4 * m], octets[4 * m + 2]));
+		store16(pOut + (4 * m + 2) * stride, zipLow64(octets[4 * m + 1], octets[4 * m + 3]));
+		store16(pOut + (4 * m + 3) * stride, zipHigh64(octets[4 * m + 1], octets[4 * m + 3]));
+	}
+}
+
+// A block's data for byte columns [column, column + numColumns), numColumns 4 or 16.
+//
+static const uint8_t* decodeColumns(const uint8_t* pData, const uint8_t* pEnd, size_t column, size_t numColumns,
+									uint8_t* last, uint8_t* pOut, size_t stride)
+{
+	Bytes16 columns[16];
+	for (size_t k = 0; k < numColumns; k += 4) {
+		if (pData >= pEnd)
+			return nullptr;
+		uint8_t modes = *pData++;
+		if ((size_t) (pEnd - pData) < groupBytes(modes))
+			return nullptr;
+		pData = decodeGroup(pData, modes, &last[column + k], &columns[k]);
+	}
+	if (numColumns == 16)
+		storeColumns16(columns, pOut + column, stride);
+	else
+		storeColumns4(columns, pOut + column, stride);
+	return pData;
+}
+
+#else
+
+static uint8_t unzigzag8(uint8_t value)
+{
+	return (uint8_t) ((value >> 1) ^ (uint8_t) -(value & 1));
+}
+
+static const uint8_t* decodeColumns(const uint8_t* pData, const uint8_t* pEnd, size_t column, size_t numColumns,
+									uint8_t* last, uint8_t* pOut, size_t stride)
+{
+	for (size_t group = column; group < column + numColumns; group += 4) {
+		if (pData >= pEnd)
+			return nullptr;
+		uint8_t modes = *pData++;
+		if ((size_t) (pEnd - pData) < groupBytes(modes))
+			return nullptr;
+		for (size_t k = 0; k < 4; ++k) {
+			ColumnMode mode = (ColumnMode) ((modes >> (2 * k)) & 3);
+			uint8_t value = last[group + k];
+			for (size_t i = 0; i < BLOCK_VERTICES; ++i) {
+				uint8_t delta = (mode == ALL_ZERO)	? 0
+							  : (mode == TWO_BITS)	? (pData[i / 4] >> (2 * (i % 4))) & 3
+							  : (mode == FOUR_BITS) ? (pData[i / 2] >> (4 * (i % 2))) & 15
+							  :						  pData[i];
+				value += unzigzag8(delta);
+				pOut[i * stride + group + k] = value;
+			}
+			last[group + k] = value;
+			pData += ModeBytes[mode];
+		}
+	}
+	return pData;
+}
+
+#endif
+
+const char* MeshCodec::DecoderName()
+{
+#if defined(MESHCODEC_SSE2)
+	return "SSE2";
+#elif defined(MESHCODEC_NEON)
+	return "NEON";
+#else
+	return "scalar";
+#endif
+}
+
+static bool decodePage(const uint8_t* pData, const uint8_t* pEnd, size_t vertexCount, size_t stride,
+					   uint8_t* pVertices)
+{
+	uint8_t last[MeshCodec::MAX_VERTEX_STRIDE] = { };
+	uint8_t partial[BLOCK_VERTICES * MeshCodec::MAX_VERTEX_STRIDE];		// (the last block, if not full)
+	for (size_t iBlock = 0; iBlock < vertexCount; iBlock += BLOCK_VERTICES) {
+		size_t numInBlock = std::min(BLOCK_VERTICES, vertexCount - iBlock);
+		uint8_t* pOut = (numInBlock == BLOCK_VERTICES) ? pVertices + iBlock * stride : partial;
+		for (size_t column = 0; column < stride; ) {
+			size_t numColumns = (column + 16 <= stride) ? 16 : 4;
+			pData = decodeColumns(pData, pEnd, column, numColumns, last, pOut, stride);
+			if (! pData)
+				return false;
+			column += numColumns;
+		}
+		if (pOut == partial)
+			memcpy(pVertices + iBlock * stride, partial, numInBlock * stride);
+	}
+	return true;
+}
+
+
+bool MeshCodec::EncodeVertices(const uint8_t* pVertices, size_t vertexCount, size_t vertexStride,
+							   vector<uint8_t>& encoded)
+{
+	if (vertexStride == 0 || vertexStride % 4 != 0 || vertexStride > MAX_VERTEX_STRIDE)
+		return false;
+	size_t numPages = (vertexCount + VERTICES_PER_PAGE - 1) / VERTICES_PER_PAGE;
+	vector<vector<uint8_t>> pages(numPages);
+	WorkerPool::Shared().parallelFor(numPages, [&](size_t iPage) {
+		size_t iBegin = iPage * VERTICES_PER_PAGE;
+		encodePage(pVertices + iBegin * vertexStride, std::min(iBegin + VERTICES_PER_PAGE, vertexCount) - iBegin,
+				   vertexStride, pages[iPage]);
+	});
+
+	encoded.assign(numPages * sizeof(uint32_t), 0);
+	for (size_t iPage = 0; iPage < numPages; ++iPage) {
+		if (encoded.size() > UINT32_MAX)
+			return false;
+		uint32_t offset = (uint32_t) encoded.size();
+		memcpy(&encoded[iPage * sizeof(uint32_t)], &offset, sizeof(offset));
+		encoded.insert(encoded.end(), pages[iPage].begin(), pages[iPage].end());
+		vector<uint8_t>().swap(pages[iPage]);
+	}
+	return true;
+}
+
+bool MeshCodec::DecodeVertices(const uint8_t* pEncoded, size_t encodedSize, size_t vertexCount, size_t vertexStride,
+							   uint8_t* pVertices)
+{
+	if (vertexStride == 0 || vertexStride % 4 != 0 || vertexStride > MAX_VERTEX_STRIDE)
+		return false;
+	size_t numPages = (vertexCount + VERTICES_PER_PAGE - 1) / VERTICES_PER_PAGE;
+	if (encodedSize < numPages * sizeof(uint32_t))
+		return false;
+	vector<uint32_t> offsets(numPages + 1);
+	memcpy(offsets.data(), pEncoded, numPages * sizeof(uint32_t));
+	offsets[numPages] = (uint32_t) std::min(encodedSize, (size_t) UINT32_MAX);
+	for (size_t iPage = 0; iPage < numPages; ++iPage)
+		if (offsets[iPage] < numPages * sizeof(uint32_t) || offsets[iPage] > offsets[iPage + 1])
+			return false;
+
+	std::atomic<bool> isValid { true };
+	WorkerPool::Shared().parallelFor(numPages, [&](size_t iPage) {
+		size_t iBegin = iPage * VERTICES_PER_PAGE;
+		if (! decodePage(pEncoded + offsets[iPage], pEncoded + offsets[iPage + 1],
+						 std::min(iBegin + VERTICES_PER_PAGE, vertexCount) - iBegin, vertexStride,
+						 pVertices + iBegin * vertexStride))
+			isValid = false;
+	});
+	return isValid;
+}
+
+
+// Index stream:	a code byte per triangle, then the variable-length values some of those call for.
+//	Code:			high nibble the edge FIFO entry (0 = newest) the triangle starts with, low nibble its third
+//					vertex: 0 the next never-seen, 1-14 a vertex FIFO entry (1 = newest), 15 a value follows;
+//					or 0xF0 if no edge matched, then three values follow.
+//	Value:			a LEB128 number, zigzagged difference from the last vertex that was a value or next
+//					(if no edge, that plus 1, 0 meaning the next never-seen).
+//
+struct IndexFIFOs {
+	uint32_t	edges[16][2] = { };		// (as the triangle that pushed it has them, reversed: so as they'd
+	uint32_t	vertices[16] = { };		//	go in a neighbor sharing that edge)
+	unsigned	numEdges = 0, numVertices = 0;
+	uint32_t	next = 0;				// (the one after the highest seen, in practice)
+	uint32_t	last = 0;
+
+	const uint32_t* edge(unsigned i)		{ return edges[(numEdges - 1 - i) & 15]; }
+	uint32_t vertex(unsigned i)				{ return vertices[(numVertices - 1 - i) & 15]; }
+	void pushEdge(uint32_t a, uint32_t b)	{ edges[numEdges & 15][0] = a;  edges[numEdges & 15][1] = b;  ++numEdges; }
+	void pushVertex(uint32_t v)				{ vertices[numVertices & 15] = v;  ++numVertices; }
+};
+
+static const unsigned NO_EDGE = 15, NEXT_VERTEX = 0, VALUE_FOLLOWS = 15, NUM_FIFO_VERTICES = 14;
+
+static void putValue(vector<uint8_t>& data, uint64_t value)
+{
+	for ( ; value >= 0x80; value >>= 7)
+		data.push_back((uint8_t) (value | 0x80));
+	data.push_back((uint8_t) value);
+}
+
+static bool getValue(const uint8_t*& pData, const uint8_t* pEnd, uint64_t& value)
+{
+	value = 0;
+	for (int shift = 0; shift < 35; shift += 7) {
+		if (pData >= pEnd)
+			return false;
+		uint8_t byte = *pData++;
+		value |= (uint64_t) (byte & 0x7F) << shift;
+		if (byte < 0x80)
+			return true;
+	}
+	return false;
+}
+
+static uint32_t zigzag32(uint32_t delta)
+{
+	return (delta << 1) ^ (uint32_t) ((int32_t) delta >> 31);
+}
+
+static uint32_t unzigzag32(uint32_t value)
+{
+	return (value >> 1) ^ (uint32_t) -(int32_t) (value & 1);
+}
+
+static uint32_t indexAt(const void* pIndices, size_t indexSize, size_t i)
+{
+	return (indexSize == sizeof(uint16_t)) ? ((const uint16_t*) pIndices)[i] : ((const uint32_t*) pIndices)[i];
+}
+
+static void setIndexAt(void* pIndices, size_t indexSize, size_t i, uint32_t index)
+{
+	if (indexSize == sizeof(uint16_t))
+		((uint16_t*) pIndices)[i] = (uint16_t) index;
+	else
+		((uint32_t*) pIndices)[i] = index;
+}
+
+bool MeshCodec::EncodeIndices(const void* pIndices, size_t indexCount, size_t indexSize, vector<uint8_t>& encoded)
+{
+	if (indexCount % 3 != 0 || (indexSize != sizeof(uint16_t) && indexSize != sizeof(uint32_t)))
+		return false;
+	size_t numTriangles = indexCount / 3;
+	encoded.assign(numTriangles, 0);
+	vector<uint8_t> values;
+	IndexFIFOs fifos;
+
+	for (size_t iTriangle = 0; iTriangle < numTriangles; ++iTriangle) {
+		uint32_t corners[3];
+		for (int i = 0; i < 3; ++i)
+			corners[i] = indexAt(pIndices, indexSize, 3 * iTriangle + i);
+
+		unsigned iEdge = 0, rotation = 0;
+		for ( ; iEdge < NO_EDGE; ++iEdge) {
+			const uint32_t* edge = fifos.edge(iEdge);
+			for (rotation = 0; rotation < 3; ++rotation)
+				if (corners[rotation] == edge[0] && corners[(rotation + 1) % 3] == edge[1])
+					break;
+			if (rotation < 3)
+				break;
+		}
+
+		if (iEdge < NO_EDGE) {
+			uint32_t a = corners[rotation], b = corners[(rotation + 1) % 3], c = corners[(rotation + 2) % 3];
+			unsigned third = VALUE_FOLLOWS;
+			if (c == fifos.next)
+				third = NEXT_VERTEX;
+			else
+				for (unsigned iVertex = 0; iVertex < NUM_FIFO_VERTICES && third == VALUE_FOLLOWS; ++iVertex)
+					if (fifos.vertex(iVertex) == c)
+						third = iVertex + 1;
+			if (third == NEXT_VERTEX || third == VALUE_FOLLOWS) {
+				if (third == VALUE_FOLLOWS)
+					putValue(values, zigzag32(c - fifos.last));
+				fifos.next = std::max(fifos.next, c + 1);
+				fifos.last = c;
+				fifos.pushVertex(c);
+			}
+			encoded[iTriangle] = (uint8_t) (iEdge << 4 | third);
+			fifos.pushEdge(c, b);
+			fifos.pushEdge(a, c);
+		} else {
+			encoded[iTriangle] = (uint8_t) (NO_EDGE << 4);
+			for (uint32_t corner : corners) {
+				putValue(values, (corner == fifos.next) ? 0 : (uint64_t) zigzag32(corner - fifos.last) + 1);
+				fifos.next = std::max(fifos.next, corner + 1);
+				fifos.last = corner;
+				fifos.pushVertex(corner);
+			}
+			fifos.pushEdge(corners[1], corners[0]);
+			fifos.pushEdge(corners[2], corners[1]);
+			fifos.pushEdge(corners[0], corners[2]);
+		}
+	}
+	encoded.insert(encoded.end(), values.begin(), values.end());
+	return true;
+}
+
+bool MeshCodec::DecodeIndices(const uint8_t* pEncoded, size_t encodedSize, size_t indexCount, size_t indexSize,
+							  void* pIndices)
+{
+	size_t numTriangles = indexCount / 3;
+	if (indexCount % 3 != 0 || encodedSize < numTriangles
+		|| (indexSize != sizeof(uint16_t) && indexSize != sizeof(uint32_t)))
+		return false;
+	const uint8_t* pValues = pEncoded + numTriangles;
+	const uint8_t* pEnd = pEncoded + encodedSize;
+	IndexFIFOs fifos;
+	uint64_t value;
+
+	for (size_t iTriangle = 0; iTriangle < numTriangles; ++iTriangle) {
+		uint8_t code = pEncoded[iTriangle];
+		unsigned iEdge = code >> 4, third = code & 15;
+		uint32_t corners[3];
+
+		if (iEdge < NO_EDGE) {
+			const uint32_t* edge = fifos.edge(iEdge);
+			uint32_t a = edge[0], b = edge[1], c;
+			if (third == NEXT_VERTEX || third == VALUE_FOLLOWS) {
+				if (third == NEXT_VERTEX)
+					c = fifos.next;
+				else if (getValue(pValues, pEnd, value))
+					c = fifos.last + unzigzag32((uint32_t) value);
+				else
+					return false;
+				fifos.next = std::max(fifos.next, c + 1);
+				fifos.last = c;
+				fifos.pushVertex(c);
+			} else
+				c = fifos.vertex(third - 1);
+			corners[0] = a;  corners[1] = b;  corners[2] = c;
+			fifos.pushEdge(c, b);
+			fifos.pushEdge(a, c);
+		} else {
+			for (uint32_t& corner : corners) {
+				if (! getValue(pValues, pEnd, value))
+					return false;
+				corner = (value == 0) ? fifos.next : fifos.last + unzigzag32((uint32_t) (value - 1));
+				fifos.next = std::max(fifos.next, corner + 1);
+				fifos.last = corner;
+				fifos.pushVertex(corner);
+			}
+			fifos.pushEdge(corners[1], corners[0]);
+			fifos.pushEdge(corners[2], corners[1]);
+			fifos.pushEdge(corners[0], corners[2]);
+		}
+		for (int i = 0; i < 3; ++i)
+			setIndexAt(pIndices, indexSize, 3 * iTriangle + i, corners[i]);
+	}
+	return true;
+}
@@ -0,0 +1,61 @@
+//
+// MeshCodec.h
+//	Vulkan Convenience 3D Objects
+//
+// Compact encoding of a mesh's vertex and index buffers, for MeshCache
+//	files (see ModelDefSpec::isCompressed): typically a quarter to a half the
+//	size of the raw buffers, and decoded at several GB/s.
+// Vertices are coded per byte of the vertex ("byte column"): each byte as
+//	the difference from the same byte of the vertex before, zigzagged so
+//	small differences either way are small numbers.  Columns are cut into
+//	blocks of 16 vertices, each block's 16 differences packed into 0, 2, 4
+//	or 8 bits apiece, whichever is the least that holds them all (a 2-bit
+//	code per column, per block, saying which).  Neighboring vertices mostly
+//	being alike, especially once MeshOptimizer has ordered them, most of
+//	these are narrow.  Decoding a block is then all 16-wide byte operations:
+//	unpacking, un-zigzagging, a prefix sum to undo the differences, and a
+//	transpose back to vertices; on SSE2 (all x86-64) or NEON (ARM64, e.g.
+//	Raspberry Pi 5), otherwise plain C++.  Vertices are also divided into
+//	pages, each coded independently, so pages decode in parallel.
+// Indices are coded per triangle, rotated (keeping winding) to start with
+//	an edge the last 15 triangles had, as one byte naming that edge and
+//	whether the third vertex is the next never-seen one (as is usual in
+//	vertex-fetch-optimized order), one of the last 14 seen, or a value that
+//	follows as a variable-length difference.  This is inherently serial,
+//	but indices are mostly a byte per triangle, so are quick to get through.
+// Strides must be a multiple of 4 bytes (as ModelLoader's always are).
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef MeshCodec_h
+#define MeshCodec_h
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+
+class MeshCodec
+{
+public:
+	// Each Encode returns false if the mesh can't be encoded (then keep it raw); each Decode, if 'encoded' is
+	//	malformed or doesn't hold as many as asked for.  Decoding needs room for vertexCount * vertexStride
+	//	or indexCount * indexSize bytes.
+	static bool EncodeVertices(const uint8_t* pVertices, size_t vertexCount, size_t vertexStride,
+							   std::vector<uint8_t>& encoded);
+	static bool DecodeVertices(const uint8_t* pEncoded, size_t encodedSize, size_t vertexCount, size_t vertexStride,
+							   uint8_t* pVertices);
+
+	static bool EncodeIndices(const void* pIndices, size_t indexCount, size_t indexSize,
+							  std::vector<uint8_t>& encoded);		// (indices are 16- or 32-bit)
+	static bool DecodeIndices(const uint8_t* pEncoded, size_t encodedSize, size_t indexCount, size_t indexSize,
+							  void* pIndices);
+
+	static const char* DecoderName();		// ("SSE2", "NEON" or "scalar")
+
+	static const size_t VERTICES_PER_PAGE = 16 * 1024;
+	static const size_t MAX_VERTEX_STRIDE = 256;
+};
+
+#endif	// MeshCodec_h
@@ -0,0 +1,486 @@
+//
+// MeshGeometry.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "MeshGeometry.h"
+#include "WorkerPool.h"
+#include "WeldTable.h"
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define MESHGEOMETRY_SSE2
+	#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)		// (not 32-bit ARM's NEON: no vector divide or square root)
+	#define MESHGEOMETRY_NEON
+	#include <arm_neon.h>
+#endif
+
+using std::vector;
+
+
+static inline float dot3(const float a[3], const float b[3]) {
+	return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static inline void cross3(const float a[3], const float b[3], float result[3]) {
+	result[0] = a[1] * b[2] - a[2] * b[1];
+	result[1] = a[2] * b[0] - a[0] * b[2];
+	result[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+static inline bool normalize3(float v[3]) {		// (false, leaving it be, if it has no length)
+	float length = sqrtf(dot3(v, v));
+	if (! (length > 0.0f))
+		return false;
+	for (int xyz = 0; xyz < 3; ++xyz)
+		v[xyz] /= length;
+	return true;
+}
+
+// Angle between two edges leaving a corner (0 if either is degenerate).
+//
+static float cornerAngle(const float a[3], const float b[3])
+{
+	float lengths = sqrtf(dot3(a, a) * dot3(b, b));
+	if (! (lengths > 0.0f))
+		return 0.0f;
+	return acosf(std::max(-1.0f, std::min(1.0f, dot3(a, b) / lengths)));
+}
+
+// The three corners' angles of triangle p0-p1-p2.
+//
+static void cornerAngles(const float* p0, const float* p1, const float* p2, float angles[3])
+{
+	float e01[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+	float e02[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+	float e12[3] = { p2[0] - p1[0], p2[1] - p1[1], p2[2] - p1[2] };
+	float e10[3] = { -e01[0], -e01[1], -e01[2] };
+	float e20[3] = { -e02[0], -e02[1], -e02[2] };
+	float e21[3] = { -e12[0], -e12[1], -e12[2] };
+	angles[0] = cornerAngle(e01, e02);
+	angles[1] = cornerAngle(e12, e10);
+	angles[2] = cornerAngle(e20, e21);
+}
+
+static size_t tasksFor(size_t count, size_t perTask)
+{
+	return (count + perTask - 1) / perTask;
+}
+
+// One triangle's normal, then the weight of it at each corner (its angle, else 1 as the normal's length is the
+//	triangle's area), each padded to four floats.
+//
+static void triangleNormal(const float* p0, const float* p1, const float* p2, NormalGeneration weighting,
+						   float normal[8])
+{
+	float e01[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+	float e02[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+	float* weights = normal + 4;
+	cross3(e01, e02, normal);		// (length twice the triangle's area)
+	weights[0] = weights[1] = weights[2] = 1.0f;
+	if (weighting == NORMALS_BY_ANGLE && normalize3(normal))
+		cornerAngles(p0, p1, p2, weights);
+	normal[3] = weights[3] = 0.0f;
+}
+
+
+#if defined(MESHGEOMETRY_SSE2)
+
+typedef __m128 Floats4;
+typedef __m128 Mask4;
+
+static Floats4 load4(const float* p)						{ return _mm_loadu_ps(p); }
+static void store4(float* p, Floats4 v)						{ _mm_storeu_ps(p, v); }
+static Floats4 splat4(float value)							{ return _mm_set1_ps(value); }
+static Floats4 add4(Floats4 a, Floats4 b)					{ return _mm_add_ps(a, b); }
+static Floats4 sub4(Floats4 a, Floats4 b)					{ return _mm_sub_ps(a, b); }
+static Floats4 mul4(Floats4 a, Floats4 b)					{ return _mm_mul_ps(a, b); }
+static Floats4 div4(Floats4 a, Floats4 b)					{ return _mm_div_ps(a, b); }
+static Floats4 sqrt4(Floats4 a)								{ return _mm_sqrt_ps(a); }
+static Floats4 min4(Floats4 a, Floats4 b)					{ return _mm_min_ps(a, b); }
+static Floats4 max4(Floats4 a, Floats4 b)					{ return _mm_max_ps(a, b); }
+static Mask4 greater4(Floats4 a, Floats4 b)					{ return _mm_cmpgt_ps(a, b); }
+static Floats4 select4(Mask4 mask, Floats4 a, Floats4 b)	{ return _mm_or_ps(_mm_and_ps(mask, a),
+																			   _mm_andnot_ps(mask, b)); }
+static void transpose4(Floats4& a, Floats4& b, Floats4& c, Floats4& d)	{ _MM_TRANSPOSE4_PS(a, b, c, d); }
+
+#elif defined(MESHGEOMETRY_NEON)
+
+typedef float32x4_t Floats4;
+typedef uint32x4_t	Mask4;
+
+static Floats4 load4(const float* p)						{ return vld1q_f32(p); }
+static void store4(float* p, Floats4 v)						{ vst1q_f32(p, v); }
+static Floats4 splat4(float value)							{ return vdupq_n_f32(value); }
+static Floats4 add4(Floats4 a, Floats4 b)					{ return vaddq_f32(a, b); }
+static Floats4 sub4(Floats4 a, Floats4 b)					{ return vsubq_f32(a, b); }
+static Floats4 mul4(Floats4 a, Floats4 b)					{ return vmulq_f32(a, b); }
+static Floats4 div4(Floats4 a, Floats4 b)					{ return vdivq_f32(a, b); }
+static Floats4 sqrt4(Floats4 a)								{ return vsqrtq_f32(a); }
+static Floats4 min4(Floats4 a, Floats4 b)					{ return vminq_f32(a, b); }
+static Floats4 max4(Floats4 a, Floats4 b)					{ return vmaxq_f32(a, b); }
+static Mask4 greater4(Floats4 a, Floats4 b)					{ return vcgtq_f32(a, b); }
+static Floats4 select4(Mask4 mask, Floats4 a, Floats4 b)	{ return vbslq_f32(mask, a, b); }
+static void transpose4(Floats4& a, Floats4& b, Floats4& c, Floats4& d)
+{
+	float32x4x2_t ab = vtrnq_f32(a, b), cd = vtrnq_f32(c, d);
+	a = vcombine_f32(vget_low_f32(ab.val[0]), vget_low_f32(cd.val[0]));
+	b = vcombine_f32(vget_low_f32(ab.val[1]), vget_low_f32(cd.val[1]));
+	c = vcombine_f32(vget_high_f32(ab.val[0]), vget_high_f32(cd.val[0]));
+	d = vcombine_f32(vget_high_f32(ab.val[1]), vget_high_f32(cd.val[1]));
+}
+
+#endif
+
+#if defined(MESHGEOMETRY_SSE2) || defined(MESHGEOMETRY_NEON)
+
+// Four points' positions, from their first three floats, as x, y and z of each.  (The fourth float is read too,
+//	so must exist: not past the end of the vertices.)
+//
+static void loadPositions4(const float* p0, const float* p1, const float* p2, const float* p3, Floats4 xyz[3])
+{
+	Floats4 w = load4(p3);
+	xyz[0] = load4(p0);
+	xyz[1] = load4(p1);
+	xyz[2] = load4(p2);
+	transpose4(xyz[0], xyz[1], xyz[2], w);
+}
+
+static Floats4 dot3of4(const Floats4 a[3], const Floats4 b[3])
+{
+	return add4(add4(mul4(a[0], b[0]), mul4(a[1], b[1])), mul4(a[2], b[2]));
+}
+
+// Arc cosine to within a few ulp (Cephes' asinf polynomial, on x or, above 0.5, on sqrt((1 - x) / 2)), as there's
+//	no vector acosf.
+//
+static Floats4 acos4(Floats4 x)
+{
+	const Floats4 zero = splat4(0.0f), half = splat4(0.5f), one = splat4(1.0f);
+	const Floats4 pi = splat4(3.14159265f), halfPi = splat4(1.57079633f);
+	Floats4 a = max4(x, sub4(zero, x));
+	Mask4 isLarge = greater4(a, half);
+	Floats4 z = select4(isLarge, mul4(half, sub4(one, a)), mul4(x, x));
+	Floats4 s = select4(isLarge, sqrt4(z), a);
+	Floats4 poly = splat4(4.2163199048e-2f);
+	poly = add4(mul4(poly, z), splat4(2.4181311049e-2f));
+	poly = add4(mul4(poly, z), splat4(4.5470025998e-2f));
+	poly = add4(mul4(poly, z), splat4(7.4953002686e-2f));
+	poly = add4(mul4(poly, z), splat4(1.6666752422e-1f));
+	Floats4 asinS = add4(mul4(mul4(poly, z), s), s);		// (of |x| if small, else of s)
+	Mask4 isNegative = greater4(zero, x);
+	Floats4 large = add4(asinS, asinS);
+	large = select4(isNegative, sub4(pi, large), large);
+	Floats4 small = select4(isNegative, add4(halfPi, asinS), sub4(halfPi, asinS));
+	return select4(isLarge, large, small);
+}
+
+// As cornerAngle, of four pairs of edges.
+//
+static Floats4 cornerAngle4(const Floats4 a[3], const Floats4 b[3])
+{
+	Floats4 lengths = sqrt4(mul4(dot3of4(a, a), dot3of4(b, b)));
+	Floats4 cosine = max4(splat4(-1.0f), min4(splat4(1.0f), div4(dot3of4(a, b), lengths)));
+	return select4(greater4(lengths, splat4(0.0f)), acos4(cosine), splat4(0.0f));
+}
+
+// As triangleNormal, of four triangles (of the 12 indices at 'corners'), stored one after another.
+//
+static void triangleNormals4(const uint8_t* pVertices, size_t vertexStride, const uint32_t* corners,
+							 NormalGeneration weighting, float* normals)
+{
+	auto position = [&](size_t iCorner) { return (const float*) (pVertices + corners[iCorner] * vertexStride); };
+	Floats4 p0[3], p1[3], p2[3];
+	loadPositions4(position(0), position(3), position(6), position(9), p0);
+	loadPositions4(position(1), position(4), position(7), position(10), p1);
+	loadPositions4(position(2), position(5), position(8), position(11), p2);
+	Floats4 e01[3], e02[3], n[3];
+	for (int xyz = 0; xyz < 3; ++xyz) {
+		e01[xyz] = sub4(p1[xyz], p0[xyz]);
+		e02[xyz] = sub4(p2[xyz], p0[xyz]);
+	}
+	n[0] = sub4(mul4(e01[1], e02[2]), mul4(e01[2], e02[1]));
+	n[1] = sub4(mul4(e01[2], e02[0]), mul4(e01[0], e02[2]));
+	n[2] = sub4(mul4(e01[0], e02[1]), mul4(e01[1], e02[0]));
+	Floats4 weights[3] = { splat4(1.0f), splat4(1.0f), splat4(1.0f) };
+	if (weighting == NORMALS_BY_ANGLE) {
+		Floats4 length = sqrt4(dot3of4(n, n));
+		Mask4 hasLength = greater4(length, splat4(0.0f));
+		for (int xyz = 0; xyz < 3; ++xyz)
+			n[xyz] = select4(hasLength, div4(n[xyz], length), n[xyz]);
+		Floats4 e12[3], e10[3], e20[3], e21[3];
+		for (int xyz = 0; xyz < 3; ++xyz) {
+			e12[xyz] = sub4(p2[xyz], p1[xyz]);
+			e10[xyz] = sub4(p0[xyz], p1[xyz]);
+			e20[xyz] = sub4(p0[xyz], p2[xyz]);
+			e21[xyz] = sub4(p1[xyz], p2[xyz]);
+		}
+		weights[0] = select4(hasLength, cornerAngle4(e01, e02), weights[0]);
+		weights[1] = select4(hasLength, cornerAngle4(e12, e10), weights[1]);
+		weights[2] = select4(hasLength, cornerAngle4(e20, e21), weights[2]);
+	}
+	Floats4 padding = splat4(0.0f), weightPadding = padding;
+	transpose4(n[0], n[1], n[2], padding);
+	transpose4(weights[0], weights[1], weights[2], weightPadding);
+	Floats4 rows[8] = { n[0], weights[0], n[1], weights[1], n[2], weights[2], padding, weightPadding };
+	for (int iRow = 0; iRow < 8; ++iRow)
+		store4(normals + 4 * iRow, rows[iRow]);
+}
+
+#endif
+
+
+// Box from per-task minima/maxima, then sphere around its center reaching the farthest vertex.
+//
+MeshBounds MeshGeometry::Bounds(const uint8_t* pVertices, size_t vertexCount, size_t vertexStride)
+{
+	MeshBounds bounds = { };
+	if (vertexCount == 0)
+		return bounds;
+	auto position = [&](size_t v) { return (const float*) (pVertices + v * vertexStride); };
+
+	WorkerPool& pool = WorkerPool::Shared();
+	size_t numTasks = tasksFor(vertexCount, VERTICES_PER_TASK);
+  #if defined(MESHGEOMETRY_SSE2) || defined(MESHGEOMETRY_NEON)
+	size_t numWhole = (vertexStride >= 4 * sizeof(float)) ? vertexCount : vertexCount - 1;	// (with a 4th float to read)
+  #endif
+	vector<MeshBounds> taskBounds(numTasks);
+	pool.parallelFor(numTasks, [&](size_t iTask) {
+		MeshBounds& box = taskBounds[iTask];
+		size_t iBegin = iTask * VERTICES_PER_TASK, iEnd = std::min(vertexCount, iBegin + VERTICES_PER_TASK);
+		memcpy(box.boundsMin, position(iBegin), sizeof(box.boundsMin));
+		memcpy(box.boundsMax, position(iBegin), sizeof(box.boundsMax));
+		size_t v = iBegin + 1;
+	  #if defined(MESHGEOMETRY_SSE2) || defined(MESHGEOMETRY_NEON)
+		size_t iWholeEnd = std::min(iEnd, numWhole);
+		if (v < iWholeEnd) {				// (a vertex at a time, four wide, the last ignored)
+			Floats4 boxMin = load4(position(v)), boxMax = boxMin;
+			for (++v; v < iWholeEnd; ++v) {
+				Floats4 p = load4(position(v));
+				boxMin = min4(boxMin, p);
+				boxMax = max4(boxMax, p);
+			}
+			float wholeMin[4], wholeMax[4];
+			store4(wholeMin, boxMin);
+			store4(wholeMax, boxMax);
+			for (int xyz = 0; xyz < 3; ++xyz) {
+				box.boundsMin[xyz] = std::min(box.boundsMin[xyz], wholeMin[xyz]);
+				box.boundsMax[xyz] = std::max(box.boundsMax[xyz], wholeMax[xyz]);
+			}
+		}
+	  #endif
+		for ( ; v < iEnd; ++v) {
+			const float* p = position(v);
+			for (int xyz = 0; xyz < 3; ++xyz) {
+				box.boundsMin[xyz] = std::min(box.boundsMin[xyz], p[xyz]);
+				box.boundsMax[xyz] = std::max(box.boundsMax[xyz], p[xyz]);
+			}
+		}
+	});
+	bounds = taskBounds[0];
+	for (const MeshBounds& box : taskBounds)
+		for (int xyz = 0; xyz < 3; ++xyz) {
+			bounds.boundsMin[xyz] = std::min(bounds.boundsMin[xyz], box.boundsMin[xyz]);
+			bounds.boundsMax[xyz] = std::max(bounds.boundsMax[xyz], box.boundsMax[xyz]);
+		}
+	for (int xyz = 0; xyz < 3; ++xyz)
+		bounds.center[xyz] = (bounds.boundsMin[xyz] + bounds.boundsMax[xyz]) * 0.5f;
+
+	vector<float> taskRadiiSquared(numTasks, 0.0f);
+	pool.parallelFor(numTasks, [&](size_t iTask) {
+		size_t iBegin = iTask * VERTICES_PER_TASK, iEnd = std::min(vertexCount, iBegin + VERTICES_PER_TASK);
+		float maxDistanceSquared = 0.0f;
+		size_t v = iBegin;
+	  #if defined(MESHGEOMETRY_SSE2) || defined(MESHGEOMETRY_NEON)
+		Floats4 center[3] = { splat4(bounds.center[0]), splat4(bounds.center[1]), splat4(bounds.center[2]) };
+		Floats4 maxima = splat4(0.0f);
+		for (size_t iWholeEnd = std::min(iEnd, numWhole); v + 4 <= iWholeEnd; v += 4) {	// (four vertices at a time)
+			Floats4 d[3];
+			loadPositions4(position(v), position(v + 1), position(v + 2), position(v + 3), d);
+			for (int xyz = 0; xyz < 3; ++xyz)
+				d[xyz] = sub4(d[xyz], center[xyz]);
+			maxima = max4(maxima, dot3of4(d, d));
+		}
+		float wholeMaxima[4];
+		store4(wholeMaxima, maxima);
+		maxDistanceSquared = *std::max_element(wholeMaxima, wholeMaxima + 4);
+	  #endif
+		for ( ; v < iEnd; ++v) {
+			const float* p = position(v);
+			float d[3] = { p[0] - bounds.center[0], p[1] - bounds.center[1], p[2] - bounds.center[2] };
+			maxDistanceSquared = std::max(maxDistanceSquared, dot3(d, d));
+		}
+		taskRadiiSquared[iTask] = maxDistanceSquared;
+	});
+	bounds.radius = sqrtf(*std::max_element(taskRadiiSquared.begin(), taskRadiiSquared.end()));
+	return bounds;
+}
+
+// Triangles' contributions to each of their corners are computed in parallel, summed per distinct position
+//	(a single pass of additions), then normalized into every vertex at that position, again in parallel.
+//
+void MeshGeometry::GenerateNormals(uint8_t* pVertices, size_t vertexCount, size_t vertexStride, int normalOffset,
+								   const uint32_t* indices, size_t indexCount, NormalGeneration weighting)
+{
+	if (weighting == NORMALS_NONE || vertexCount == 0)
+		return;
+	auto position = [&](size_t v) { return (const float*) (pVertices + v * vertexStride); };
+
+	struct Position {
+		float xyz[3];
+	};
+	WeldTable<Position> positions(vertexCount);
+	vector<uint32_t> positionOf(vertexCount);
+	bool isNew;
+	for (size_t v = 0; v < vertexCount; ++v) {
+		Position key;
+		memcpy(key.xyz, position(v), sizeof(key.xyz));
+		positionOf[v] = positions.findOrInsert(key, isNew);
+	}
+
+	WorkerPool& pool = WorkerPool::Shared();
+	size_t numTriangles = indexCount / 3;
+	vector<float> triangleNormals(8 * numTriangles);		// (as triangleNormal, four floats each so SIMD fits)
+	pool.parallelFor(tasksFor(numTriangles, TRIANGLES_PER_TASK), [&](size_t iTask) {
+		size_t iTriangle = iTask * TRIANGLES_PER_TASK, iEnd = std::min(numTriangles, iTriangle + TRIANGLES_PER_TASK);
+	  #if defined(MESHGEOMETRY_SSE2) || defined(MESHGEOMETRY_NEON)
+		for ( ; iTriangle + 4 <= iEnd; iTriangle += 4)	// (reading four floats of each position is safe: a normal follows)
+			triangleNormals4(pVertices, vertexStride, &indices[3 * iTriangle], weighting,
+							 &triangleNormals[8 * iTriangle]);
+	  #endif
+		for ( ; iTriangle < iEnd; ++iTriangle) {
+			const uint32_t* corners = &indices[3 * iTriangle];
+			triangleNormal(position(corners[0]), position(corners[1]), position(corners[2]), weighting,
+						   &triangleNormals[8 * iTriangle]);
+		}
+	});
+
+	vector<float> sums(4 * positions.size(), 0.0f);
+	for (size_t iTriangle = 0; iTriangle < numTriangles; ++iTriangle) {
+		const float* normal = &triangleNormals[8 * iTriangle];
+		const float* weights = normal + 4;
+		for (int iCorner = 0; iCorner < 3; ++iCorner) {
+			float* sum = &sums[4 * positionOf[indices[3 * iTriangle + iCorner]]];
+		  #if defined(MESHGEOMETRY_SSE2) || defined(MESHGEOMETRY_NEON)
+			store4(sum, add4(load4(sum), mul4(load4(normal), splat4(weights[iCorner]))));
+		  #else
+			for (int xyz = 0; xyz < 3; ++xyz)
+				sum[xyz] += normal[xyz] * weights[iCorner];
+		  #endif
+		}
+	}
+
+	pool.parallelFor(tasksFor(vertexCount, VERTICES_PER_TASK), [&](size_t iTask) {
+		size_t iEnd = std::min(vertexCount, (iTask + 1) * VERTICES_PER_TASK);
+		for (size_t v = iTask * VERTICES_PER_TASK; v < iEnd; ++v) {
+			float normal[3];
+			memcpy(normal, &sums[4 * positionOf[v]], sizeof(normal));
+			if (! normalize3(normal)) {			// (in no triangle, or only degenerate ones)
+				normal[0] = normal[1] = 0.0f;
+				normal[2] = 1.0f;
+			}
+			memcpy((float*) (pVertices + v * vertexStride) + normalOffset, normal, sizeof(normal));
+		}
+	});
+}
+
+// As with normals: per-corner tangent and bitangent in parallel, summed per vertex, then finished in parallel:
+//	orthogonalized against the normal (Gram-Schmidt) and given the handedness the summed bitangent implies.
+//
+void MeshGeometry::GenerateTangents(const uint8_t* pVertices, size_t vertexCount, size_t vertexStride,
+									int normalOffset, int texCoordOffset, const uint32_t* indices, size_t indexCount,
+									vector<VertexTangent>& tangents)
+{
+	tangents.assign(vertexCount, VertexTangent { { 1.0f, 0.0f, 0.0f }, 1.0f });
+	if (vertexCount == 0)
+		return;
+	auto position = [&](size_t v) { return (const float*) (pVertices + v * vertexStride); };
+	auto normal	  = [&](size_t v) { return position(v) + normalOffset; };
+	auto texCoord = [&](size_t v) { return position(v) + texCoordOffset; };
+
+	WorkerPool& pool = WorkerPool::Shared();
+	size_t numTriangles = indexCount / 3;
+	vector<float> cornerFrames(6 * 3 * numTriangles);	// (per corner: weighted tangent, weighted bitangent)
+	pool.parallelFor(tasksFor(numTriangles, TRIANGLES_PER_TASK), [&](size_t iTask) {
+		size_t iEnd = std::min(numTriangles, (iTask + 1) * TRIANGLES_PER_TASK);
+		for (size_t iTriangle = iTask * TRIANGLES_PER_TASK; iTriangle < iEnd; ++iTriangle) {
+			const uint32_t* corners = &indices[3 * iTriangle];
+			float* frames = &cornerFrames[18 * iTriangle];
+			const float* p0 = position(corners[0]);
+			const float* p1 = position(corners[1]);
+			const float* p2 = position(corners[2]);
+			const float* uv0 = texCoord(corners[0]);
+			const float* uv1 = texCoord(corners[1]);
+			const float* uv2 = texCoord(corners[2]);
+			float e01[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+			float e02[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+			float du1 = uv1[0] - uv0[0], dv1 = uv1[1] - uv0[1];
+			float du2 = uv2[0] - uv0[0], dv2 = uv2[1] - uv0[1];
+			float area = du1 * dv2 - du2 * dv1;		// (signed, in texture space)
+			if (! (fabsf(area) > 0.0f)) {
+				std::fill(frames, frames + 18, 0.0f);
+				continue;
+			}
+			float t[3], b[3];
+			for (int xyz = 0; xyz < 3; ++xyz) {
+				t[xyz] = (e01[xyz] * dv2 - e02[xyz] * dv1) / area;
+				b[xyz] = (e02[xyz] * du1 - e01[xyz] * du2) / area;
+			}
+			float angles[3];
+			cornerAngles(p0, p1, p2, angles);
+			for (int iCorner = 0; iCorner < 3; ++iCorner) {
+				const float* n = normal(corners[iCorner]);
+				float tangent[3], bitangent[3];
+				float tn = dot3(t, n), bn = dot3(b, n);
+				for (int xyz = 0; xyz < 3; ++xyz) {
+					tangent[xyz]   = t[xyz] - n[xyz] * tn;
+					bitangent[xyz] = b[xyz] - n[xyz] * bn;
+				}
+				bool isValid = normalize3(tangent) && normalize3(bitangent);
+				for (int xyz = 0; xyz < 3; ++xyz) {
+					frames[6 * iCorner + xyz]	  = isValid ? tangent[xyz] * angles[iCorner] : 0.0f;
+					frames[6 * iCorner + 3 + xyz] = isValid ? bitangent[xyz] * angles[iCorner] : 0.0f;
+				}
+			}
+		}
+	});
+
+	vector<float> sums(6 * vertexCount, 0.0f);
+	for (size_t iCorner = 0; iCorner < 3 * numTriangles; ++iCorner) {
+		float* sum = &sums[6 * indices[iCorner]];
+		for (int i = 0; i < 6; ++i)
+			sum[i] += cornerFrames[6 * iCorner + i];
+	}
+
+	pool.parallelFor(tasksFor(vertexCount, VERTICES_PER_TASK), [&](size_t iTask) {
+		size_t iEnd = std::min(vertexCount, (iTask + 1) * VERTICES_PER_TASK);
+		for (size_t v = iTask * VERTICES_PER_TASK; v < iEnd; ++v) {
+			const float* n = normal(v);
+			float* tangent = tangents[v].tangent;
+			const float* bitangent = &sums[6 * v + 3];
+			memcpy(tangent, &sums[6 * v], 3 * sizeof(float));
+			float tn = dot3(tangent, n);
+			for (int xyz = 0; xyz < 3; ++xyz)
+				tangent[xyz] -= n[xyz] * tn;
+			if (! normalize3(tangent)) {		// (no usable texCoords: any direction in the normal's plane)
+				float axis[3] = { 0.0f, 0.0f, 0.0f };
+				axis[fabsf(n[0]) < 0.9f ? 0 : 1] = 1.0f;
+				cross3(n, axis, tangent);
+				if (! normalize3(tangent)) {	// (normal itself zero)
+					tangent[0] = 1.0f;
+					tangent[1] = tangent[2] = 0.0f;
+				}
+			}
+			float nxt[3];
+			cross3(n, tangent, nxt);
+			tangents[v].handedness = (dot3(nxt, bitangent) < 0.0f) ? -1.0f : 1.0f;
+		}
+	});
+}
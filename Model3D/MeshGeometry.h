@@ -0,0 +1,71 @@
+//
+// MeshGeometry.h
+//	Vulkan Convenience 3D Objects
+//
+// What a loaded mesh's vertices imply, computed once at load (and cached
+//	with it) rather than each frame: the whole mesh's bounding box and
+//	sphere, for culling; smooth normals, for a model that came without any
+//	(instead of it being shaded flat white); and tangents, for normal mapping.
+// Normals are smoothed across all vertices sharing a position - even those
+//	kept apart by differing texCoords or colors, so UV seams don't show - with
+//	each face weighted either by its area or by its corner's angle (the latter
+//	unaffected by how a surface happens to be tessellated).
+// Tangents follow MikkTSpace's construction: per corner, the direction of
+//	increasing u projected onto the vertex's normal plane, weighted by the
+//	corner's angle, summed per vertex and normalized, with a sign for which
+//	way v runs (bitangent = handedness * cross(normal, tangent)).  Unlike
+//	MikkTSpace we don't split a vertex whose corners disagree (as at a mirror
+//	seam): it was welded on normal and texCoord, so rarely has cause to.
+// Each works over the welded vertex and index arrays in parallel, on the
+//	shared WorkerPool; bounds and normals four floats at a time on SSE2 or
+//	(AArch64) NEON, otherwise in plain C++.  Vertices are as VerticesDynamic
+//	packs them: position (three floats) first, other attributes at the float
+//	offsets given.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef MeshGeometry_h
+#define MeshGeometry_h
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+
+enum NormalGeneration {			// for a model that has no normals:
+	NORMALS_NONE,				// leave it without
+	NORMALS_BY_AREA,			// smooth, each face contributing in proportion to its area
+	NORMALS_BY_ANGLE			// smooth, each face contributing in proportion to its corner's angle
+};
+
+struct MeshBounds {
+	float	boundsMin[3];		// axis-aligned bounding box, in model space
+	float	boundsMax[3];
+	float	center[3];			// bounding sphere, centered on the box (so not the smallest,
+	float	radius;				//	but near it for most models, and cheap to find in parallel)
+};
+
+struct VertexTangent {
+	float	tangent[3];			// unit length, perpendicular to the vertex's normal
+	float	handedness;			// +1 or -1
+};
+
+
+class MeshGeometry
+{
+public:
+	static MeshBounds Bounds(const uint8_t* pVertices, size_t vertexCount, size_t vertexStride);
+
+	static void GenerateNormals(uint8_t* pVertices, size_t vertexCount, size_t vertexStride, int normalOffset,
+								const uint32_t* indices, size_t indexCount, NormalGeneration weighting);
+
+	static void GenerateTangents(const uint8_t* pVertices, size_t vertexCount, size_t vertexStride, int normalOffset,
+								 int texCoordOffset, const uint32_t* indices, size_t indexCount,
+								 std::vector<VertexTangent>& tangents);
+
+	static const size_t VERTICES_PER_TASK  = 16 * 1024;
+	static const size_t TRIANGLES_PER_TASK = 16 * 1024;
+};
+
+#endif	// MeshGeometry_h
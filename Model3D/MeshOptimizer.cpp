@@ -0,0 +1,310 @@
+//
+// MeshOptimizer.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "MeshOptimizer.h"
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+
+using std::vector;
+
+
+VertexCacheStats MeshOptimizer::AnalyzeVertexCache(const uint32_t* indices, size_t indexCount, size_t vertexCount,
+												   int cacheSize)
+{
+	VertexCacheStats stats;
+	if (indexCount < 3 || vertexCount == 0)
+		return stats;
+
+	vector<uint32_t> timeEntered(vertexCount, 0);	// FIFO simulated by timestamp: in cache if
+	uint32_t timeNow = cacheSize + 1;				//	it entered fewer than cacheSize misses ago
+	size_t numMisses = 0;
+
+	for (size_t i = 0; i < indexCount; ++i) {
+		uint32_t iVertex = indices[i];
+		if (timeNow - timeEntered[iVertex] > (uint32_t) cacheSize) {
+			timeEntered[iVertex] = timeNow++;
+			++numMisses;
+		}
+	}
+	stats.acmr = (float) numMisses / (float) (indexCount / 3);
+	stats.atvr = (float) numMisses / (float) vertexCount;
+	return stats;
+}
+
+
+// Vertex-to-triangle adjacency, compressed into one array (rather than a vector per vertex).
+//
+void MeshOptimizer::BuildAdjacency(const uint32_t* indices, size_t indexCount, size_t vertexCount,
+								   vector<uint32_t>& offsets, vector<uint32_t>& adjacent)
+{
+	size_t numTriangles = indexCount / 3;
+	offsets.assign(vertexCount + 1, 0);
+	for (size_t i = 0; i < 3 * numTriangles; ++i)
+		++offsets[indices[i] + 1];
+	for (size_t v = 0; v < vertexCount; ++v)
+		offsets[v + 1] += offsets[v];
+
+	adjacent.resize(3 * numTriangles);
+	vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+	for (uint32_t iTri = 0; iTri < numTriangles; ++iTri)
+		for (int corner = 0; corner < 3; ++corner)
+			adjacent[fill[indices[3 * iTri + corner]]++] = iTri;
+}
+
+
+// Tipsify: "fan" around one vertex at a time, emitting all its remaining triangles, then choose the next
+//	fanning vertex from among those just emitted, preferring one still in cache but with few triangles
+//	left (so it gets finished-off before being evicted).  If none qualifies, backtrack along a stack of
+//	recently-used vertices, failing that, take the next vertex (in order) with triangles remaining.
+//
+void MeshOptimizer::OptimizeVertexCache(uint32_t* indices, size_t indexCount, size_t vertexCount,
+										vector<uint32_t>* pClusterStarts, int cacheSize)
+{
+	size_t numTriangles = indexCount / 3;
+	if (pClusterStarts)
+		pClusterStarts->assign(1, 0);
+	if (numTriangles < 2 || vertexCount == 0)
+		return;
+
+	vector<uint32_t> offsets, adjacent;
+	BuildAdjacency(indices, indexCount, vertexCount, offsets, adjacent);
+	vector<uint32_t> liveCount(vertexCount);
+	for (size_t v = 0; v < vertexCount; ++v)
+		liveCount[v] = offsets[v + 1] - offsets[v];
+
+	vector<uint32_t> timeEntered(vertexCount, 0);
+	vector<bool>	 isEmitted(numTriangles, false);
+	vector<uint32_t> deadEnd;					// stack
+	vector<uint32_t> candidates;
+	vector<uint32_t> output;
+	output.reserve(3 * numTriangles);
+
+	uint32_t timeNow = cacheSize + 1;
+	size_t iCursor = 0;							// for sequential scan once dead-end stack exhausts
+	int64_t fanning = 0;
+
+	while (fanning >= 0) {
+		candidates.clear();
+		for (uint32_t iAdj = offsets[fanning]; iAdj < offsets[fanning + 1]; ++iAdj) {
+			uint32_t iTri = adjacent[iAdj];
+			if (isEmitted[iTri])
+				continue;
+			for (int corner = 0; corner < 3; ++corner) {
+				uint32_t v = indices[3 * iTri + corner];
+				output.push_back(v);
+				deadEnd.push_back(v);
+				candidates.push_back(v);
+				--liveCount[v];
+				if (timeNow - timeEntered[v] > (uint32_t) cacheSize)
+					timeEntered[v] = timeNow++;
+			}
+			isEmitted[iTri] = true;
+		}
+
+		// Next fanning vertex: best candidate still live...
+		int64_t best = -1;
+		int bestPriority = -1;
+		for (uint32_t v : candidates) {
+			if (liveCount[v] == 0)
+				continue;
+			int priority = 0;
+			if (timeNow - timeEntered[v] + 2 * liveCount[v] <= (uint32_t) cacheSize)
+				priority = timeNow - timeEntered[v];
+			if (priority > bestPriority) {
+				bestPriority = priority;
+				best = v;
+			}
+		}
+		// ...else skip the dead-end, which starts a new cluster.
+		if (best < 0) {
+			while (! deadEnd.empty() && best < 0) {
+				uint32_t v = deadEnd.back();
+				deadEnd.pop_back();
+				if (liveCount[v] > 0)
+					best = v;
+			}
+			for ( ; best < 0 && iCursor < vertexCount; ++iCursor)
+				if (liveCount[iCursor] > 0)
+					best = iCursor;
+			if (best >= 0 && pClusterStarts && output.size() / 3 > pClusterStarts->back())
+				pClusterStarts->push_back((uint32_t) (output.size() / 3));
+		}
+		fanning = best;
+	}
+	memcpy(indices, output.data(), output.size() * sizeof(uint32_t));
+}
+
+
+// Sort clusters by how "outward" they face, relative to the mesh's centroid: dot(clusterCentroid - meshCentroid,
+//	clusterNormal).  A cheap, view-independent proxy for what's likely to occlude, as in Sander et al.
+//
+void MeshOptimizer::OptimizeOverdraw(uint32_t* indices, size_t indexCount, const vector<uint32_t>& clusterStarts,
+									 const uint8_t* pVertices, size_t vertexStride)
+{
+	size_t numTriangles = indexCount / 3;
+	size_t numClusters = clusterStarts.size();
+	if (numClusters < 2)
+		return;
+
+	auto position = [&](uint32_t iVertex) {
+		return (const float*) (pVertices + iVertex * vertexStride);
+	};
+
+	struct Cluster {
+		uint32_t iFirst, iEnd;
+		float	 centroid[3] = { };
+		float	 normal[3] = { };
+		float	 area = 0.0f;
+		float	 sortKey = 0.0f;
+	};
+	vector<Cluster> clusters(numClusters);
+	float meshCentroid[3] = { }, meshArea = 0.0f;
+
+	for (size_t iCluster = 0; iCluster < numClusters; ++iCluster) {
+		Cluster& cluster = clusters[iCluster];
+		cluster.iFirst = clusterStarts[iCluster];
+		cluster.iEnd = (iCluster + 1 < numClusters) ? clusterStarts[iCluster + 1] : (uint32_t) numTriangles;
+
+		for (uint32_t iTri = cluster.iFirst; iTri < cluster.iEnd; ++iTri) {
+			const float* a = position(indices[3 * iTri]);
+			const float* b = position(indices[3 * iTri + 1]);
+			const float* c = position(indices[3 * iTri + 2]);
+			float ab[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+			float ac[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+			float n[3] = { ab[1] * ac[2] - ab[2] * ac[1],		// cross product: length is
+						   ab[2] * ac[0] - ab[0] * ac[2],		//	twice triangle's area
+						   ab[0] * ac[1] - ab[1] * ac[0] };
+			float area = 0.5f * sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+			for (int xyz = 0; xyz < 3; ++xyz) {
+				cluster.centroid[xyz] += area * (a[xyz] + b[xyz] + c[xyz]) / 3.0f;
+				cluster.normal[xyz] += n[xyz];
+			}
+			cluster.area += area;
+		}
+		for (int xyz = 0; xyz < 3; ++xyz)
+			meshCentroid[xyz] += cluster.centroid[xyz];
+		meshArea += cluster.area;
+	}
+	if (meshArea <= 0.0f)
+		return;
+	for (int xyz = 0; xyz < 3; ++xyz)
+		meshCentroid[xyz] /= meshArea;
+
+	for (Cluster& cluster : clusters) {
+		if (cluster.area <= 0.0f)
+			continue;
+		for (int xyz = 0; xyz < 3; ++xyz)
+			cluster.sortKey += (cluster.centroid[xyz] / cluster.area - meshCentroid[xyz]) * cluster.normal[xyz];
+		float normalLength = sqrtf(cluster.normal[0] * cluster.normal[0] + cluster.normal[1] * cluster.normal[1]
+								 + cluster.normal[2] * cluster.normal[2]);
+		if (normalLength > 0.0f)
+			cluster.sortKey /= normalLength;
+	}
+	std::stable_sort(clusters.begin(), clusters.end(), [](const Cluster& a, const Cluster& b) {
+		return a.sortKey > b.sortKey;
+	});
+
+	vector<uint32_t> sorted;
+	sorted.reserve(3 * numTriangles);
+	for (Cluster& cluster : clusters)
+		sorted.insert(sorted.end(), indices + 3 * cluster.iFirst, indices + 3 * cluster.iEnd);
+	memcpy(indices, sorted.data(), sorted.size() * sizeof(uint32_t));
+}
+
+
+void MeshOptimizer::OptimizeVertexFetch(uint8_t* pVertices, size_t vertexCount, size_t vertexStride,
+										uint32_t* indices, size_t indexCount)
+{
+	const uint32_t UNASSIGNED = ~0u;
+	vector<uint32_t> remap(vertexCount, UNASSIGNED);
+	uint32_t numAssigned = 0;
+
+	for (size_t i = 0; i < indexCount; ++i) {
+		uint32_t& newIndex = remap[indices[i]];
+		if (newIndex == UNASSIGNED)
+			newIndex = numAssigned++;
+		indices[i] = newIndex;
+	}
+	for (size_t v = 0; v < vertexCount; ++v)		// (any unreferenced vertices go to the end)
+		if (remap[v] == UNASSIGNED)
+			remap[v] = numAssigned++;
+
+	vector<uint8_t> original(pVertices, pVertices + vertexCount * vertexStride);
+	for (size_t v = 0; v < vertexCount; ++v)
+		memcpy(pVertices + remap[v] * vertexStride, &original[v * vertexStride], vertexStride);
+}
+
+
+// Greedy: a triangle (or group) joins the current chunk unless its new vertices would overflow it.  Since
+//	the mesh was (typically) already put in first-use order by OptimizeVertexFetch, few vertices get duplicated.
+//
+void MeshOptimizer::SplitIndexRanges(const uint8_t* pVertices, size_t vertexCount, size_t vertexStride,
+									 uint32_t* indices, size_t indexCount,
+									 vector<uint8_t>& newVertices, vector<MeshChunk>& chunks,
+									 const vector<uint32_t>* pGroupStarts, size_t maxVertices)
+{
+	newVertices.clear();
+	chunks.clear();
+	indexCount -= indexCount % 3;
+	if (indexCount == 0 || maxVertices < 3)
+		return;
+
+	vector<uint32_t> localIndex(vertexCount);		// valid only if chunkOf matches current chunk
+	vector<uint32_t> chunkOf(vertexCount, ~0u);
+	vector<uint32_t> groupOf(vertexCount, ~0u);		// (to count a group's distinct vertices)
+	vector<uint32_t> chunkVertices;					// (global indices, in chunk-local order)
+	newVertices.reserve(vertexCount * vertexStride * 9 / 8);
+
+	MeshChunk chunk = { 0, 0, 0 };
+	uint32_t iChunk = 0;
+
+	auto finishChunk = [&]() {
+		for (uint32_t iGlobal : chunkVertices)
+			newVertices.insert(newVertices.end(), pVertices + iGlobal * vertexStride,
+											 pVertices + (iGlobal + 1) * vertexStride);
+		chunks.push_back(chunk);
+		chunk.firstIndex += chunk.indexCount;
+		chunk.indexCount = 0;
+		chunk.vertexOffset += (int32_t) chunkVertices.size();
+		chunkVertices.clear();
+		++iChunk;
+	};
+
+	size_t numGroups = pGroupStarts ? pGroupStarts->size() : indexCount / 3;
+	for (size_t iGroup = 0; iGroup < numGroups; ++iGroup) {
+		size_t iBegin = pGroupStarts ? (*pGroupStarts)[iGroup] : 3 * iGroup;
+		size_t iEnd = ! pGroupStarts ? iBegin + 3
+					: (iGroup + 1 < numGroups) ? (*pGroupStarts)[iGroup + 1] : indexCount;
+
+		size_t numNew = 0;
+		for (size_t i = iBegin; i < iEnd; ++i) {
+			uint32_t v = indices[i];
+			if (chunkOf[v] != iChunk && groupOf[v] != iGroup) {
+				groupOf[v] = (uint32_t) iGroup;
+				++numNew;
+			}
+		}
+		if (chunkVertices.size() + numNew > maxVertices && chunk.indexCount > 0)
+			finishChunk();
+
+		for (size_t i = iBegin; i < iEnd; ++i) {
+			uint32_t& v = indices[i];
+			if (chunkOf[v] != iChunk) {
+				chunkOf[v] = iChunk;
+				localIndex[v] = (uint32_t) chunkVertices.size();
+				chunkVertices.push_back(v);
+			}
+			v = localIndex[v];
+		}
+		chunk.indexCount += (uint32_t) (iEnd - iBegin);
+	}
+	if (chunk.indexCount > 0)
+		finishChunk();
+}
@@ -0,0 +1,84 @@
+//
+// MeshOptimizer.h
+//	Vulkan Convenience 3D Objects
+//
+// Post-load reordering of an indexed triangle mesh so the GPU renders it
+//	faster, without changing what gets rendered.  In order of application:
+//	1. Vertex Cache: reorder triangles for post-transform vertex cache
+//		locality, using "Tipsify" (Sander, Nehab, Barczak: "Fast Triangle
+//		Reordering for Vertex Locality and Reduced Overdraw," SIGGRAPH 2007).
+//	2. Overdraw: Tipsify's output naturally breaks into clusters wherever it
+//		had to restart (no cache benefit is lost across those boundaries),
+//		so sort those clusters to draw outward-facing, outer ones first,
+//		raising the odds nearer surfaces are depth-tested-out early.
+//	3. Vertex Fetch: renumber vertices by first use, so the vertex buffer is
+//		read nearly sequentially.
+// Also, for meshes with too many vertices for 16-bit indices, splitting them
+//	into index ranges (MeshChunk) that each reference at most 64K vertices.
+// Also measures ACMR (average cache misses per triangle; ideal approaches
+//	0.5, unoptimized is often 1.5 or more) and ATVR (average transformed
+//	vertex ratio, misses per vertex; ideal 1.0) for a simulated FIFO cache.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef MeshOptimizer_h
+#define MeshOptimizer_h
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+
+// A range of a mesh's indices, each to be added to vertexOffset (as Vulkan's vkCmdDrawIndexed does)
+//	so they address at most MAX_SMALL_INDEX_VERTICES vertices, allowing them to be 16-bit.
+//
+struct MeshChunk {
+	uint32_t firstIndex;
+	uint32_t indexCount;
+	int32_t	 vertexOffset;
+};
+
+struct VertexCacheStats {
+	float acmr = 0.0f;
+	float atvr = 0.0f;
+};
+
+
+class MeshOptimizer
+{
+public:
+	static const int	CACHE_SIZE = 16;	// FIFO entries, representative of a typical post-transform cache
+	static const size_t	MAX_SMALL_INDEX_VERTICES = 65536;
+
+	static VertexCacheStats AnalyzeVertexCache(const uint32_t* indices, size_t indexCount, size_t vertexCount,
+											   int cacheSize = CACHE_SIZE);
+
+	// Optionally returns the first triangle of each cluster (for OptimizeOverdraw).
+	static void OptimizeVertexCache(uint32_t* indices, size_t indexCount, size_t vertexCount,
+									std::vector<uint32_t>* pClusterStarts = nullptr, int cacheSize = CACHE_SIZE);
+
+	// Expects vertex positions as three floats at the start of each vertex.
+	static void OptimizeOverdraw(uint32_t* indices, size_t indexCount, const std::vector<uint32_t>& clusterStarts,
+								 const uint8_t* pVertices, size_t vertexStride);
+
+	// Reorders vertex bytes in-place and remaps indices to match.
+	static void OptimizeVertexFetch(uint8_t* pVertices, size_t vertexCount, size_t vertexStride,
+									uint32_t* indices, size_t indexCount);
+
+	// Triangles using vertex v are adjacent[offsets[v] .. offsets[v + 1]).
+	static void BuildAdjacency(const uint32_t* indices, size_t indexCount, size_t vertexCount,
+							   std::vector<uint32_t>& offsets, std::vector<uint32_t>& adjacent);
+
+	// Split triangles, in order, into chunks of at most maxVertices distinct vertices each.  Vertices are
+	//	copied out into newVertices, chunk by chunk (those shared between chunks, duplicated), and indices
+	//	rewritten relative to their chunk's vertexOffset.  If given groups (by first index, e.g. meshlets)
+	//	chunks only break between them; each must fit in maxVertices.
+	static void SplitIndexRanges(const uint8_t* pVertices, size_t vertexCount, size_t vertexStride,
+								 uint32_t* indices, size_t indexCount,
+								 std::vector<uint8_t>& newVertices, std::vector<MeshChunk>& chunks,
+								 const std::vector<uint32_t>* pGroupStarts = nullptr,
+								 size_t maxVertices = MAX_SMALL_INDEX_VERTICES);
+};
+
+#endif	// MeshOptimizer_h
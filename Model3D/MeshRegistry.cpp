@@ -0,0 +1,153 @@
+//
+// MeshRegistry.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "MeshRegistry.h"
+#include "WorkerPool.h"
+#include <sys/stat.h>
+
+
+MeshRegistry& MeshRegistry::Shared()
+{
+	static MeshRegistry shared;
+	return shared;
+}
+
+// Another MeshObject gets the same vertex layout, and points at the same data, as the one first loaded.
+//
+void RegisteredMesh::fill(MeshObject& other)
+{
+	other.vertexType.initialize(loader.attributes());
+
+	other.vertices	  = mesh.vertices;
+	other.vertexCount = mesh.vertexCount;
+	other.indices	  = mesh.indices;
+	other.indexCount  = mesh.indexCount;
+	other.indexType	  = mesh.indexType;
+}
+
+// Whatever would make a different load: the file itself (by its full path and timestamp), and how it's to be loaded.
+//	(Whether it's isCached doesn't change what's loaded, so doesn't count.)
+//
+string MeshRegistry::keyFor(ModelDefSpec& modelSpec)
+{
+	string fullPath = fileSystem.ModelFileFullPath(modelSpec.filename);
+	struct stat source;
+	uint64_t modifyTime = (stat(fullPath.c_str(), &source) == 0) ? (uint64_t) source.st_mtime : 0;
+
+	return fullPath + '|' + to_string(modifyTime) + '|' + to_string(modelSpec.type)
+		 + '|' + to_string(modelSpec.weld) + to_string(modelSpec.isOptimized) + to_string(modelSpec.isSplit)
+		 + to_string(modelSpec.isClustered) + '|' + to_string(modelSpec.lodCount)
+		 + '|' + to_string(modelSpec.memoryLimitMB) + '|' + to_string(modelSpec.normals)
+		 + to_string(modelSpec.isTangentSpace) + to_string(modelSpec.isPickable)
+		 + ((modelSpec.weld != WELD_BY_TOLERANCE) ? "" : '|' + to_string(modelSpec.tolerance.position)
+		 	+ ',' + to_string(modelSpec.tolerance.normal) + ',' + to_string(modelSpec.tolerance.texCoord)
+		 	+ ',' + to_string(modelSpec.tolerance.color))
+		 + (! modelSpec.isQuantized ? "" : "|q" + to_string(modelSpec.quantization.position)
+		 	+ ',' + to_string(modelSpec.quantization.texCoord) + ',' + to_string(modelSpec.quantization.color));
+}
+
+std::shared_future<bool> MeshRegistry::loadAsync(MeshObject& mesh, ModelDefSpec modelSpec, MeshHandle& handle)
+{
+	string key = keyFor(modelSpec);
+	std::lock_guard<std::mutex> lock(mutex);
+
+	auto found = entries.find(key);
+	if (found != entries.end()) {
+		++numHits;
+		handle = found->second;
+		recentlyUsed.splice(recentlyUsed.begin(), recentlyUsed, handle->lruPosition);
+		if (! handle->isLoaded) {
+			handle->waiters.push_back({ &mesh, std::promise<bool>() });
+			return handle->waiters.back().promise.get_future().share();
+		}
+		Log(RAW, "Load: model - shared: %s", modelSpec.filename.c_str());
+		handle->fill(mesh);
+		std::promise<bool> loaded;
+		loaded.set_value(true);
+		return loaded.get_future().share();
+	}
+
+	++numMisses;
+	handle = std::make_shared<RegisteredMesh>();
+	handle->key = key;
+	entries[key] = handle;
+	recentlyUsed.push_front(handle.get());
+	handle->lruPosition = recentlyUsed.begin();
+	handle->waiters.push_back({ &mesh, std::promise<bool>() });
+	std::shared_future<bool> loaded = handle->waiters.back().promise.get_future().share();
+
+	WorkerPool::Shared().submit([this, pEntry = handle, modelSpec]() mutable {
+		bool isLoadedOK = pEntry->loader.load(pEntry->mesh, modelSpec);
+		finishLoad(std::move(pEntry), isLoadedOK);		// (so the task isn't left holding a reference)
+	});
+	trim();
+	return loaded;
+}
+
+// Runs on the loading thread: hand the mesh to everyone who asked for it meanwhile.  If it failed, forget it
+//	(so a later request tries again).
+//
+void MeshRegistry::finishLoad(MeshHandle pEntry, bool isLoadedOK)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	pEntry->isLoaded   = true;
+	pEntry->isLoadedOK = isLoadedOK;
+	if (isLoadedOK) {
+		MeshObject& mesh = pEntry->mesh;
+		size_t indexSize = (mesh.indexType == MESH_SMALL_INDEX) ? sizeof(uint16_t) : sizeof(uint32_t);
+		pEntry->numBytes = (size_t) mesh.vertexCount * pEntry->loader.vertexStride()
+						 + (size_t) mesh.indexCount * indexSize
+						 + (pEntry->loader.tangents() ? mesh.vertexCount * sizeof(VertexTangent) : 0)
+						 + pEntry->loader.bvh().bytes();
+		cachedBytes += pEntry->numBytes;
+	} else {
+		recentlyUsed.erase(pEntry->lruPosition);
+		entries.erase(pEntry->key);
+	}
+	for (auto& waiter : pEntry->waiters) {
+		if (isLoadedOK)
+			pEntry->fill(*waiter.pMesh);
+		waiter.promise.set_value(isLoadedOK);
+	}
+	pEntry->waiters.clear();
+	trim();
+}
+
+// Evict least-recently-used entries no one holds a handle to, until back under budget (mutex already locked).
+//
+void MeshRegistry::trim()
+{
+	for (auto iEntry = recentlyUsed.end(); cachedBytes > budgetBytes && iEntry != recentlyUsed.begin(); ) {
+		RegisteredMesh* pEntry = *--iEntry;
+		auto found = entries.find(pEntry->key);
+		if (! pEntry->isLoaded || found->second.use_count() > 1)		// (in use, or still loading)
+			continue;
+		cachedBytes -= pEntry->numBytes;
+		++numEvictions;
+		iEntry = recentlyUsed.erase(iEntry);
+		entries.erase(found);
+	}
+}
+
+void MeshRegistry::setBudget(size_t maxBytes)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	budgetBytes = maxBytes;
+	trim();
+}
+
+void MeshRegistry::clear()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	size_t budget = budgetBytes;
+	budgetBytes = 0;
+	trim();
+	budgetBytes = budget;
+}
@@ -0,0 +1,102 @@
+//
+// MeshRegistry.h
+//	Vulkan Convenience 3D Objects
+//
+// Process-wide cache of loaded models, so that creating another object
+//	from the same model - or re-creating one just deleted, as the viewer
+//	does each time it cycles objects - needn't read, parse and weld the file
+//	all over again.  Each model is loaded once by a ModelLoader, which the
+//	registry keeps (with everything it produced: vertices, indices, submeshes,
+//	materials, meshlets, LODs...), keyed by the file's full path and its
+//	modification time (an edited file simply becomes a different entry) along
+//	with the ModelDefSpec options that shape what's loaded.
+// Callers hold a MeshHandle while they use the mesh; the MeshObject they
+//	passed in points into the shared data, so must not outlive the handle.
+//	Entries nobody holds stay cached, least-recently used evicted first,
+//	whenever the total exceeds the byte budget (checked as loads start and
+//	finish, or the budget is set).  Entries in use are never evicted, even
+//	if that leaves the budget exceeded.
+// Loading is asynchronous, as with ModelLoader::loadAsync; a request for a
+//	model that's already loading waits for that load, rather than repeating it.
+//	GPU buffers are not shared, just the CPU-side data they're uploaded from.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef MeshRegistry_h
+#define MeshRegistry_h
+
+#include "ModelLoader.h"
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <list>
+
+
+class RegisteredMesh
+{
+	friend class MeshRegistry;
+
+	struct Waiter {
+		MeshObject*			pMesh;
+		std::promise<bool>	promise;
+	};
+
+	string				key;
+	VertexDescriptionDynamic vertexType;
+	MeshObject			mesh = { vertexType };
+	bool				isLoaded = false;
+	bool				isLoadedOK = false;
+	size_t				numBytes = 0;
+	vector<Waiter>		waiters;		// (until loaded)
+	std::list<RegisteredMesh*>::iterator lruPosition;
+
+	void fill(MeshObject& other);
+
+public:
+	ModelLoader			loader;			// (shared: only read from, once loaded)
+
+	float progress()	{ return loader.progress(); }
+	size_t bytes()		{ return numBytes; }
+};
+
+typedef std::shared_ptr<RegisteredMesh>	MeshHandle;
+
+
+class MeshRegistry
+{
+public:
+	static MeshRegistry& Shared();
+
+	static const size_t DEFAULT_BUDGET_BYTES = 256 << 20;
+
+		// MEMBERS
+private:
+	std::mutex		mutex;
+	std::unordered_map<string, MeshHandle> entries;
+	std::list<RegisteredMesh*> recentlyUsed;	// (most recent first)
+	size_t			budgetBytes = DEFAULT_BUDGET_BYTES;
+	size_t			cachedBytes = 0;
+	FileSystem		fileSystem;
+
+		// METHODS
+private:
+	string keyFor(ModelDefSpec& modelSpec);
+	void finishLoad(MeshHandle pEntry, bool isLoadedOK);
+	void trim();
+
+public:
+	// Like ModelLoader::loadAsync: the future's value says whether 'mesh' was loaded, and it mustn't be used
+	//	until then; nor after 'handle' is released.  If already loaded, the future is ready on return.
+	std::shared_future<bool> loadAsync(MeshObject& mesh, ModelDefSpec modelSpec, MeshHandle& handle);
+
+	void setBudget(size_t maxBytes);
+	void clear();							// (of all entries not in use)
+
+	size_t	numHits = 0;					// (informational; including requests awaiting another's load)
+	size_t	numMisses = 0;
+	size_t	numEvictions = 0;
+	size_t	bytesCached()	{ return cachedBytes; }
+};
+
+#endif	// MeshRegistry_h
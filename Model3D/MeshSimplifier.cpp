@@ -0,0 +1,269 @@
+//
+// MeshSimplifier.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "MeshSimplifier.h"
+#include "MeshOptimizer.h"
+#include "WeldTable.h"
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+
+using std::vector;
+
+
+// Symmetric 4x4 matrix (of plane equations' outer products) plus total area weight, so that
+//	evaluate(p) / weight is the area-weighted mean squared distance of p from the planes.
+//
+struct Quadric {
+	double a00 = 0, a01 = 0, a02 = 0, a11 = 0, a12 = 0, a22 = 0;
+	double b0 = 0, b1 = 0, b2 = 0, c = 0;
+	double weight = 0;
+
+	void addPlane(const double n[3], double d, double w) {
+		a00 += w * n[0] * n[0];	 a01 += w * n[0] * n[1];  a02 += w * n[0] * n[2];
+		a11 += w * n[1] * n[1];	 a12 += w * n[1] * n[2];  a22 += w * n[2] * n[2];
+		b0	+= w * n[0] * d;	 b1	 += w * n[1] * d;	  b2  += w * n[2] * d;
+		c	+= w * d * d;
+		weight += w;
+	}
+	void operator+=(const Quadric& q) {
+		a00 += q.a00;  a01 += q.a01;  a02 += q.a02;  a11 += q.a11;  a12 += q.a12;  a22 += q.a22;
+		b0	+= q.b0;   b1  += q.b1;	  b2  += q.b2;	 c += q.c;		weight += q.weight;
+	}
+	double evaluate(const float* p) const {
+		double x = p[0], y = p[1], z = p[2];
+		return x * (a00 * x + 2 * (a01 * y + a02 * z + b0))
+			 + y * (a11 * y + 2 * (a12 * z + b1))
+			 + z * (a22 * z + 2 * b2) + c;
+	}
+};
+
+static const double MIN_NORMAL_COSINE = 0.25;	// triangles rotating more (~75 degrees) veto a collapse, as flips
+											//	or slivers on their way to flipping
+
+struct PositionKey { float xyz[3]; };
+struct EdgeKey { uint32_t lower, higher; };
+
+struct Collapse {
+	uint32_t from, to;
+	float	 cost;
+};
+
+
+static inline void triangleNormal(const float* a, const float* b, const float* c, double n[3])
+{
+	double e1[3] = { (double) b[0] - a[0], (double) b[1] - a[1], (double) b[2] - a[2] };
+	double e2[3] = { (double) c[0] - a[0], (double) c[1] - a[1], (double) c[2] - a[2] };
+	n[0] = e1[1] * e2[2] - e1[2] * e2[1];
+	n[1] = e1[2] * e2[0] - e1[0] * e2[2];
+	n[2] = e1[0] * e2[1] - e1[1] * e2[0];
+}
+
+
+// Collapses proceed in passes: find each movable vertex's cheapest collapse, sort all by cost, then
+//	perform the cheapest ones whose neighborhoods don't overlap (so costs stay valid within a pass).
+//
+size_t MeshSimplifier::Simplify(uint32_t* destination, const uint32_t* indices, size_t indexCount,
+								const uint8_t* pVertices, size_t vertexCount, size_t vertexStride,
+								size_t targetIndexCount, float* pError)
+{
+	size_t numIndices = indexCount - indexCount % 3;
+	memcpy(destination, indices, numIndices * sizeof(uint32_t));
+	if (pError)
+		*pError = 0.0f;
+	if (numIndices <= targetIndexCount || vertexCount == 0)
+		return numIndices;
+
+	auto position = [&](uint32_t iVertex) {
+		return (const float*) (pVertices + iVertex * vertexStride);
+	};
+
+	// Vertices at the same position (wedges of a seam) share a "group" and its quadric.
+	vector<uint32_t> group(vertexCount);
+	vector<uint32_t> groupSize;
+	{	WeldTable<PositionKey> positions(vertexCount);
+		for (uint32_t v = 0; v < vertexCount; ++v) {
+			const float* p = position(v);
+			PositionKey key = { { p[0] + 0.0f, p[1] + 0.0f, p[2] + 0.0f } };	// (+0 so -0 == 0)
+			bool isNew;
+			group[v] = positions.findOrInsert(key, isNew);
+			if (isNew)
+				groupSize.push_back(0);
+			++groupSize[group[v]];
+		}
+	}
+	size_t numGroups = groupSize.size();
+
+	// Lock seams (groups of multiple vertices) and borders (edges, by position, having only one triangle).
+	vector<bool> isGroupLocked(numGroups);
+	for (size_t g = 0; g < numGroups; ++g)
+		isGroupLocked[g] = groupSize[g] > 1;
+	{	WeldTable<EdgeKey> edges(numIndices);
+		vector<uint32_t> edgeUses;
+		for (size_t i = 0; i < numIndices; i += 3)
+			for (int corner = 0; corner < 3; ++corner) {
+				uint32_t g0 = group[destination[i + corner]], g1 = group[destination[i + (corner + 1) % 3]];
+				if (g0 == g1)
+					continue;
+				bool isNew;
+				uint32_t iEdge = edges.findOrInsert(EdgeKey { std::min(g0, g1), std::max(g0, g1) }, isNew);
+				if (isNew)
+					edgeUses.push_back(0);
+				++edgeUses[iEdge];
+			}
+		for (uint32_t iEdge = 0; iEdge < (uint32_t) edgeUses.size(); ++iEdge)
+			if (edgeUses[iEdge] == 1) {
+				isGroupLocked[edges.key(iEdge).lower]  = true;
+				isGroupLocked[edges.key(iEdge).higher] = true;
+			}
+	}
+
+	vector<Quadric> quadrics(numGroups);
+	for (size_t i = 0; i < numIndices; i += 3) {
+		const float* p0 = position(destination[i]);
+		double n[3];
+		triangleNormal(p0, position(destination[i + 1]), position(destination[i + 2]), n);
+		double length = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+		if (length == 0.0)
+			continue;
+		n[0] /= length;  n[1] /= length;  n[2] /= length;
+		double d = -(n[0] * p0[0] + n[1] * p0[1] + n[2] * p0[2]);
+		for (int corner = 0; corner < 3; ++corner)
+			quadrics[group[destination[i + corner]]].addPlane(n, d, length * 0.5);
+	}
+
+	vector<uint32_t> offsets, adjacent;
+	vector<Collapse> collapses;
+	vector<Collapse> bestOf(vertexCount);		// each vertex's cheapest collapse, recomputed
+	vector<bool>	 isStale(vertexCount, true);	//	only when its neighborhood changes
+	vector<uint32_t> remap(vertexCount);
+	vector<bool>	 isGroupTouched(numGroups);
+	double maxError = 0.0;
+
+	while (numIndices > targetIndexCount) {
+		MeshOptimizer::BuildAdjacency(destination, numIndices, vertexCount, offsets, adjacent);
+
+		collapses.clear();
+		for (uint32_t v = 0; v < vertexCount; ++v) {
+			if (isGroupLocked[group[v]] || offsets[v] == offsets[v + 1])
+				continue;
+			Collapse& best = bestOf[v];
+			if (isStale[v]) {
+				best = { v, v, INFINITY };
+				for (uint32_t iAdj = offsets[v]; iAdj < offsets[v + 1]; ++iAdj) {
+					const uint32_t* triangle = &destination[3 * adjacent[iAdj]];
+					for (int corner = 0; corner < 3; ++corner) {
+						uint32_t u = triangle[corner];
+						if (group[u] == group[v])
+							continue;
+						Quadric merged = quadrics[group[v]];
+						merged += quadrics[group[u]];
+						float cost = (float) (merged.weight > 0 ? merged.evaluate(position(u)) / merged.weight : 0);
+						if (cost < best.cost)
+							best = { v, u, cost };
+					}
+				}
+				isStale[v] = false;
+			}
+			if (best.to != v)
+				collapses.push_back(best);
+		}
+		if (collapses.empty())
+			break;
+		std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+			return a.cost < b.cost;
+		});
+
+		// Each collapse removes (typically) two triangles; only take the cheaper portion of what's
+		//	needed this pass, as costs of the rest will be more accurate once recomputed.
+		size_t trianglesToRemove = (numIndices - targetIndexCount) / 3 + 1;
+		size_t iCostLimit = std::min(collapses.size() - 1, trianglesToRemove / 2 * 3 / 2);
+		float costLimit = collapses[iCostLimit].cost;
+
+		for (uint32_t v = 0; v < vertexCount; ++v)
+			remap[v] = v;
+		std::fill(isGroupTouched.begin(), isGroupTouched.end(), false);
+		size_t numRemoved = 0;
+		bool isProgress = false;
+
+		for (const Collapse& collapse : collapses) {
+			if (numRemoved >= trianglesToRemove || collapse.cost > costLimit)
+				break;
+			uint32_t v = collapse.from, u = collapse.to;
+			if (isGroupTouched[group[v]] || isGroupTouched[group[u]])
+				continue;
+
+			size_t numDegenerate = 0;			// triangles around v that collapse away
+			bool isFlipped = false;				//	or, any remaining that would turn over (or nearly)?
+			for (uint32_t iAdj = offsets[v]; iAdj < offsets[v + 1] && ! isFlipped; ++iAdj) {
+				const uint32_t* triangle = &destination[3 * adjacent[iAdj]];
+				if (group[triangle[0]] == group[u] || group[triangle[1]] == group[u] || group[triangle[2]] == group[u]) {
+					++numDegenerate;
+					continue;
+				}
+				const float* p[3];
+				for (int corner = 0; corner < 3; ++corner)
+					p[corner] = position(triangle[corner]);
+				double before[3], after[3];
+				triangleNormal(p[0], p[1], p[2], before);
+				for (int corner = 0; corner < 3; ++corner)
+					if (triangle[corner] == v)
+						p[corner] = position(u);
+				triangleNormal(p[0], p[1], p[2], after);
+				double dot = before[0] * after[0] + before[1] * after[1] + before[2] * after[2];
+				double lengths = sqrt((before[0] * before[0] + before[1] * before[1] + before[2] * before[2])
+									* (after[0] * after[0] + after[1] * after[1] + after[2] * after[2]));
+				isFlipped = dot <= MIN_NORMAL_COSINE * lengths;
+			}
+			if (isFlipped)
+				continue;
+
+			remap[v] = u;
+			quadrics[group[u]] += quadrics[group[v]];
+			for (uint32_t iAdj = offsets[v]; iAdj < offsets[v + 1]; ++iAdj)
+				for (int corner = 0; corner < 3; ++corner) {
+					uint32_t w = destination[3 * adjacent[iAdj] + corner];
+					isGroupTouched[group[w]] = true;
+					isStale[w] = true;
+				}
+			for (uint32_t iAdj = offsets[u]; iAdj < offsets[u + 1]; ++iAdj)	// (u's quadric changed)
+				for (int corner = 0; corner < 3; ++corner)
+					isStale[destination[3 * adjacent[iAdj] + corner]] = true;
+			numRemoved += numDegenerate;
+			maxError = std::max(maxError, (double) collapse.cost);
+			isProgress = true;
+		}
+		if (! isProgress)
+			break;
+
+		size_t numKept = 0;
+		for (size_t i = 0; i < numIndices; i += 3) {
+			uint32_t a = remap[destination[i]], b = remap[destination[i + 1]], c = remap[destination[i + 2]];
+			if (group[a] != group[b] && group[b] != group[c] && group[c] != group[a]) {
+				destination[numKept++] = a;
+				destination[numKept++] = b;
+				destination[numKept++] = c;
+			}
+		}
+		numIndices = numKept;
+	}
+	if (pError)
+		*pError = (float) sqrt(maxError);
+	return numIndices;
+}
+
+
+int MeshSimplifier::SelectLOD(const vector<MeshLOD>& lods, float pixelsPerUnit, float maxPixelError)
+{
+	int iSelected = -1;
+	for (int iLOD = 0; iLOD < (int) lods.size(); ++iLOD)
+		if (lods[iLOD].error * pixelsPerUnit <= maxPixelError)
+			iSelected = iLOD;
+	return iSelected;
+}
@@ -0,0 +1,52 @@
+//
+// MeshSimplifier.h
+//	Vulkan Convenience 3D Objects
+//
+// Generate lower levels-of-detail (LODs) of a mesh as alternate index buffers
+//	over its same, unchanged vertex buffer.  Uses Garland & Heckbert quadric
+//	error metrics ("Surface Simplification Using Quadric Error Metrics,"
+//	SIGGRAPH 1997) but with "half-edge" collapses - a vertex merges into an
+//	existing neighbor rather than a new optimally-placed one - which is what
+//	lets all LODs share the one vertex buffer.
+// Respects seams: vertices sharing a position but differing in normal or
+//	texture coordinate (as welding leaves them, i.e. seams) and vertices on
+//	open borders are never moved, only collapsed into, so UV islands don't
+//	smear and hard edges stay hard.  Collapses that would flip a triangle
+//	are rejected.
+// Each LOD carries its error, the largest (RMS over area) distance of its
+//	surface from the original's, in model units, so a renderer can pick the
+//	coarsest LOD whose error projects to under a pixel or so (see SelectLOD).
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef MeshSimplifier_h
+#define MeshSimplifier_h
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+
+struct MeshLOD {
+	uint32_t firstIndex;		// into the LOD index buffer
+	uint32_t indexCount;
+	float	 error;				// deviation from full-detail mesh, in model units
+};
+
+
+class MeshSimplifier
+{
+public:
+	// Writes up to indexCount indices to destination, returning how many.  May stop short of target if
+	//	locked (seam/border) vertices prevent it.  Expects positions as three floats starting each vertex.
+	static size_t Simplify(uint32_t* destination, const uint32_t* indices, size_t indexCount,
+						   const uint8_t* pVertices, size_t vertexCount, size_t vertexStride,
+						   size_t targetIndexCount, float* pError = nullptr);
+
+	// Coarsest LOD whose error appears no larger than maxPixelError, given how many pixels a model-space
+	//	unit spans at the model's distance (e.g. from gxCamera::pixelsPerUnitAt).  Returns -1 for full detail.
+	static int SelectLOD(const std::vector<MeshLOD>& lods, float pixelsPerUnit, float maxPixelError = 1.0f);
+};
+
+#endif	// MeshSimplifier_h
@@ -0,0 +1,36 @@
+//
+// MeshSink.h
+//	Vulkan Convenience 3D Objects
+//
+// Where a caller would have ModelLoader put the finished mesh, rather than
+//	keep it in its own heap arrays for the buffer code to copy from later:
+//	typically a persistently-mapped staging buffer, so that the loader's one
+//	pass over the final vertices and indices (narrowing the latter to 16 bits,
+//	if they fit) writes them straight into upload memory.
+// Only asked once the mesh's final size is known, i.e. after welding,
+//	optimizing and splitting, which all need random access to (and reading
+//	back of) what they work on, not well suited to write-combined memory.
+//	The MeshObject then points into the sink's memory, and ModelLoader frees
+//	its own copy.  Meshlets, LODs, submeshes etc. stay with the ModelLoader.
+// Called on whichever thread is loading (see ModelLoader::loadAsync).
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef MeshSink_h
+#define MeshSink_h
+
+#include <cstddef>
+
+
+class MeshSink
+{
+public:
+	virtual ~MeshSink() = default;
+
+	// Return where to write vertices and indices, vertexBytes and indexBytes long respectively
+	//	(indexBytes being 0 if there are none); or false to decline, leaving the mesh with ModelLoader.
+	virtual bool reserve(size_t vertexBytes, size_t indexBytes, void*& pVertices, void*& pIndices) = 0;
+};
+
+#endif	// MeshSink_h
@@ -0,0 +1,227 @@
+//
+// Meshlets.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "Meshlets.h"
+#include "MeshOptimizer.h"
+#include <cstring>
+#include <cmath>
+
+using std::vector;
+
+
+static inline float dot3(const float a[3], const float b[3]) {
+	return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+
+// Bounding sphere by Ritter's method (within ~5% of optimal), then normal cone from unit triangle normals.
+//
+static void computeBounds(Meshlet& meshlet, const uint32_t* indices, const vector<uint32_t>& meshletVertices,
+						  const uint8_t* pVertices, size_t vertexStride)
+{
+	auto position = [&](uint32_t iVertex) {
+		return (const float*) (pVertices + iVertex * vertexStride);
+	};
+	auto distanceSquared = [](const float* a, const float* b) {
+		float d[3] = { a[0] - b[0], a[1] - b[1], a[2] - b[2] };
+		return dot3(d, d);
+	};
+	auto farthestFrom = [&](const float* from) {
+		const float* farthest = from;
+		float maxDistanceSquared = -1.0f;
+		for (uint32_t v : meshletVertices)
+			if (distanceSquared(position(v), from) > maxDistanceSquared) {
+				maxDistanceSquared = distanceSquared(position(v), from);
+				farthest = position(v);
+			}
+		return farthest;
+	};
+
+	const float* a = farthestFrom(position(meshletVertices[0]));
+	const float* b = farthestFrom(a);
+	float radius = sqrtf(distanceSquared(a, b)) * 0.5f;
+	float center[3] = { (a[0] + b[0]) * 0.5f, (a[1] + b[1]) * 0.5f, (a[2] + b[2]) * 0.5f };
+
+	for (uint32_t v : meshletVertices) {
+		const float* p = position(v);
+		float distance = sqrtf(distanceSquared(p, center));
+		if (distance > radius) {				// grow sphere just enough to include p
+			float newRadius = (radius + distance) * 0.5f;
+			float shift = (newRadius - radius) / distance;
+			for (int xyz = 0; xyz < 3; ++xyz)
+				center[xyz] += (p[xyz] - center[xyz]) * shift;
+			radius = newRadius;
+		}
+	}
+	memcpy(meshlet.center, center, sizeof(center));
+	meshlet.radius = radius;
+
+	vector<float> normals;						// (unit, per non-degenerate triangle)
+	normals.reserve(meshlet.indexCount);
+	float axis[3] = { };
+	for (uint32_t i = meshlet.firstIndex; i < meshlet.firstIndex + meshlet.indexCount; i += 3) {
+		const float* p0 = position(indices[i]);
+		const float* p1 = position(indices[i + 1]);
+		const float* p2 = position(indices[i + 2]);
+		float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+		float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+		float n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+		float length = sqrtf(dot3(n, n));
+		if (length == 0.0f)
+			continue;
+		for (int xyz = 0; xyz < 3; ++xyz) {
+			normals.push_back(n[xyz] / length);
+			axis[xyz] += n[xyz] / length;
+		}
+	}
+	float axisLength = sqrtf(dot3(axis, axis));
+	float minDot = 1.0f;
+	if (axisLength > 0.0f) {
+		for (int xyz = 0; xyz < 3; ++xyz)
+			axis[xyz] /= axisLength;
+		for (size_t iNormal = 0; iNormal < normals.size(); iNormal += 3)
+			minDot = fminf(minDot, dot3(axis, &normals[iNormal]));
+	}
+	memcpy(meshlet.coneAxis, axis, sizeof(axis));
+
+	// Cone half-angle is acos(minDot); all triangles face away from any view direction within
+	//	(90 degrees - half-angle) of the axis, i.e. when their cosine exceeds sin(half-angle).
+	if (axisLength == 0.0f || minDot <= 0.1f)	// (nearly hemispherical or wider: useless)
+		meshlet.coneCutoff = 1.0f;
+	else
+		meshlet.coneCutoff = sqrtf(1.0f - minDot * minDot);
+}
+
+
+void MeshletBuilder::Build(uint32_t* indices, size_t indexCount, const uint8_t* pVertices, size_t vertexCount,
+						   size_t vertexStride, vector<Meshlet>& meshlets)
+{
+	meshlets.clear();
+	size_t numTriangles = indexCount / 3;
+	if (numTriangles == 0 || vertexCount == 0)
+		return;
+
+	vector<uint32_t> offsets, adjacent;
+	MeshOptimizer::BuildAdjacency(indices, indexCount, vertexCount, offsets, adjacent);
+
+	vector<bool>	 isEmitted(numTriangles, false);
+	vector<uint32_t> meshletOf(vertexCount, ~0u);		// which meshlet each vertex was last added to
+	vector<uint32_t> meshletVertices;
+	vector<uint32_t> meshletTriangles;
+	vector<uint32_t> output;
+	output.reserve(3 * numTriangles);
+	meshletVertices.reserve(MAX_VERTICES);
+	meshletTriangles.reserve(MAX_TRIANGLES);
+
+	uint32_t iMeshlet = 0;
+	size_t iScan = 0;									// first possibly-unemitted triangle
+
+	auto newVerticesIn = [&](uint32_t iTri) {
+		const uint32_t* corner = &indices[3 * iTri];
+		return (meshletOf[corner[0]] != iMeshlet)
+			 + (meshletOf[corner[1]] != iMeshlet && corner[1] != corner[0])
+			 + (meshletOf[corner[2]] != iMeshlet && corner[2] != corner[0] && corner[2] != corner[1]);
+	};
+	// Among the unemitted triangles sharing any of these vertices, the one adding fewest new vertices.
+	auto bestAdjacentTo = [&](const uint32_t* pVertex, size_t count, int64_t& best, int& bestNew) {
+		for (size_t i = 0; i < count && bestNew > 0; ++i)
+			for (uint32_t iAdj = offsets[pVertex[i]]; iAdj < offsets[pVertex[i] + 1]; ++iAdj) {
+				uint32_t iTri = adjacent[iAdj];
+				if (isEmitted[iTri])
+					continue;
+				int numNew = newVerticesIn(iTri);
+				if (numNew < bestNew) {
+					bestNew = numNew;
+					best = iTri;
+				}
+			}
+	};
+	auto finishMeshlet = [&]() {
+		Meshlet meshlet = {};
+		meshlet.firstIndex	= (uint32_t) output.size();
+		meshlet.indexCount	= 3 * (uint32_t) meshletTriangles.size();
+		meshlet.vertexCount	= (uint32_t) meshletVertices.size();
+		for (uint32_t iTri : meshletTriangles)
+			output.insert(output.end(), &indices[3 * iTri], &indices[3 * iTri + 3]);
+		computeBounds(meshlet, output.data(), meshletVertices, pVertices, vertexStride);
+		meshlets.push_back(meshlet);
+		meshletVertices.clear();
+		meshletTriangles.clear();
+		++iMeshlet;
+	};
+
+	for (size_t numEmitted = 0; numEmitted < numTriangles; ++numEmitted) {
+		int64_t best = -1;
+		int bestNew = 4;
+		if (! meshletTriangles.empty()) {				// try neighbors of latest triangle first, then of whole meshlet
+			bestAdjacentTo(&indices[3 * meshletTriangles.back()], 3, best, bestNew);
+			if (best < 0)
+				bestAdjacentTo(meshletVertices.data(), meshletVertices.size(), best, bestNew);
+		}
+		if (best < 0) {
+			while (isEmitted[iScan])
+				++iScan;
+			best = iScan;
+			bestNew = newVerticesIn((uint32_t) best);
+		}
+		if (meshletVertices.size() + bestNew > MAX_VERTICES || meshletTriangles.size() + 1 > MAX_TRIANGLES)
+			finishMeshlet();
+
+		uint32_t iTri = (uint32_t) best;
+		for (int corner = 0; corner < 3; ++corner) {
+			uint32_t v = indices[3 * iTri + corner];
+			if (meshletOf[v] != iMeshlet) {
+				meshletOf[v] = iMeshlet;
+				meshletVertices.push_back(v);
+			}
+		}
+		meshletTriangles.push_back(iTri);
+		isEmitted[iTri] = true;
+	}
+	finishMeshlet();
+
+	memcpy(indices, output.data(), output.size() * sizeof(uint32_t));
+}
+
+
+bool MeshletBuilder::IsBackfacing(const Meshlet& meshlet, const float eye[3])
+{
+	float toCenter[3] = { meshlet.center[0] - eye[0], meshlet.center[1] - eye[1], meshlet.center[2] - eye[2] };
+	return dot3(toCenter, meshlet.coneAxis) > meshlet.coneCutoff * sqrtf(dot3(toCenter, toCenter)) + meshlet.radius;
+}
+
+// Planes (a, b, c, d) with normals pointing inward, by Gribb & Hartmann: sums/differences of matrix rows.
+//	Near plane is row 2 alone, since Vulkan's clip-space depth is [0, 1] (not OpenGL's [-1, 1]).
+//
+void MeshletBuilder::FrustumPlanes(const float m[16], float planes[6][4])
+{
+	auto row = [m](int r, int c) { return m[c * 4 + r]; };
+	for (int c = 0; c < 4; ++c) {
+		planes[0][c] = row(3, c) + row(0, c);		// left
+		planes[1][c] = row(3, c) - row(0, c);		// right
+		planes[2][c] = row(3, c) + row(1, c);		// bottom (or top, depending on Y flip; either way, both)
+		planes[3][c] = row(3, c) - row(1, c);
+		planes[4][c] = row(2, c);					// near
+		planes[5][c] = row(3, c) - row(2, c);		// far
+	}
+	for (int iPlane = 0; iPlane < 6; ++iPlane) {
+		float length = sqrtf(dot3(planes[iPlane], planes[iPlane]));
+		if (length > 0.0f)
+			for (int c = 0; c < 4; ++c)
+				planes[iPlane][c] /= length;
+	}
+}
+
+bool MeshletBuilder::IsOutsideFrustum(const Meshlet& meshlet, const float planes[6][4])
+{
+	for (int iPlane = 0; iPlane < 6; ++iPlane)
+		if (dot3(planes[iPlane], meshlet.center) + planes[iPlane][3] < -meshlet.radius)
+			return true;
+	return false;
+}
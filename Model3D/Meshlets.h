@@ -0,0 +1,54 @@
+//
+// Meshlets.h
+//	Vulkan Convenience 3D Objects
+//
+// Partition a mesh's triangles into small clusters - "meshlets" - each with
+//	its own bounds, so a renderer can cull them individually (on CPU, or by
+//	uploading them for a GPU culling pass) and draw only the visible ranges,
+//	instead of a whole large mesh whenever any of it is on-screen.
+// Sized to suit mesh shaders too: at most 64 vertices and 124 triangles,
+//	the limits commonly recommended for mesh shader hardware.
+// Building reorders the index buffer so each meshlet's triangles are a
+//	contiguous range; the vertex buffer is unchanged.  Triangles are grown
+//	into each meshlet preferring ones adding fewest new vertices, keeping
+//	meshlets compact (tight spheres, narrow normal cones).
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef Meshlets_h
+#define Meshlets_h
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+
+struct Meshlet {
+	uint32_t firstIndex;		// triangles: indices[firstIndex .. firstIndex + indexCount)
+	uint32_t indexCount;
+	uint32_t vertexCount;		// distinct vertices referenced
+	float	 center[3];			// bounding sphere
+	float	 radius;
+	float	 coneAxis[3];		// normal cone: all triangles face away from an eye if
+	float	 coneCutoff;		//	dot(center - eye, axis) > cutoff * |center - eye| + radius
+};								//	(cutoff 1 means the cone is too wide to ever cull)
+
+
+class MeshletBuilder
+{
+public:
+	static const uint32_t MAX_VERTICES	= 64;
+	static const uint32_t MAX_TRIANGLES	= 124;
+
+	// Expects vertex positions as three floats at the start of each vertex.
+	static void Build(uint32_t* indices, size_t indexCount, const uint8_t* pVertices, size_t vertexCount,
+					  size_t vertexStride, std::vector<Meshlet>& meshlets);
+
+	// Culling tests, given eye position and view-projection matrix in the mesh's model space.
+	static bool IsBackfacing(const Meshlet& meshlet, const float eye[3]);
+	static void FrustumPlanes(const float viewProjection[16], float planes[6][4]);	// (column-major, as glm)
+	static bool IsOutsideFrustum(const Meshlet& meshlet, const float planes[6][4]);
+};
+
+#endif	// Meshlets_h
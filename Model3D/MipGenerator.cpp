@@ -0,0 +1,139 @@
+//
+// MipGenerator.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "MipGenerator.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define MIPGENERATOR_SSE2
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+	#define MIPGENERATOR_NEON
+	#include <arm_neon.h>
+#endif
+
+
+uint32_t MipGenerator::LevelCount(uint32_t width, uint32_t height)
+{
+	uint32_t count = 1;
+	for (uint32_t size = std::max(width, height); size > 1; size >>= 1)
+		++count;
+	return count;
+}
+
+
+// sRGB-encoded bytes to 16-bit linear light, and back (rounded in sRGB), by table.
+//
+struct SRGBTables {
+	uint16_t	toLinear[256];
+	uint8_t		fromLinear[65536];
+
+	SRGBTables() {
+		for (int value = 0; value < 256; ++value) {
+			double encoded = value / 255.0;
+			double linear = (encoded <= 0.04045) ? encoded / 12.92 : pow((encoded + 0.055) / 1.055, 2.4);
+			toLinear[value] = (uint16_t) lround(linear * 65535.0);
+		}
+		for (int value = 0; value < 65536; ++value) {
+			double linear = value / 65535.0;
+			double encoded = (linear <= 0.0031308) ? linear * 12.92 : 1.055 * pow(linear, 1.0 / 2.4) - 0.055;
+			fromLinear[value] = (uint8_t) lround(encoded * 255.0);
+		}
+	}
+};
+
+static const SRGBTables& srgbTables()
+{
+	static SRGBTables tables;		// (built once, on first use, thread-safely)
+	return tables;
+}
+
+
+// One destination row from the two source rows it covers ('pBelow' the same as 'pRow' if the image is one row
+//	high).  'isPaired' if each destination texel covers two source columns, i.e. the image is wider than one.
+//
+static void downsampleRowSRGB(const uint8_t* pRow, const uint8_t* pBelow, bool isPaired, uint32_t destWidth,
+							  uint8_t* pDest)
+{
+	const SRGBTables& tables = srgbTables();
+	size_t step = isPaired ? 4 : 0;
+	for (uint32_t x = 0; x < destWidth; ++x, pRow += 2 * step, pBelow += 2 * step, pDest += 4) {
+		for (int c = 0; c < 3; ++c) {
+			uint32_t sum = tables.toLinear[pRow[c]] + tables.toLinear[pRow[step + c]]
+						 + tables.toLinear[pBelow[c]] + tables.toLinear[pBelow[step + c]];
+			pDest[c] = tables.fromLinear[(sum + 2) >> 2];
+		}
+		pDest[3] = (pRow[3] + pRow[step + 3] + pBelow[3] + pBelow[step + 3] + 2) >> 2;		// (alpha is linear)
+	}
+}
+
+static void downsampleRowLinear(const uint8_t* pRow, const uint8_t* pBelow, bool isPaired, uint32_t destWidth,
+								uint8_t* pDest)
+{
+	uint32_t x = 0;
+	if (isPaired) {			// (four destination texels from 32 bytes of each row)
+	  #if defined(MIPGENERATOR_SSE2)
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i two  = _mm_set1_epi16(2);
+		auto averageTwo = [&](__m128i row, __m128i below) {	// 4 texels each to 2 (as 16-bit)
+			__m128i left  = _mm_add_epi16(_mm_unpacklo_epi8(row, zero), _mm_unpacklo_epi8(below, zero));
+			__m128i right = _mm_add_epi16(_mm_unpackhi_epi8(row, zero), _mm_unpackhi_epi8(below, zero));
+			__m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(left, right), _mm_unpackhi_epi64(left, right));
+			return _mm_srli_epi16(_mm_add_epi16(sum, two), 2);
+		};
+		for ( ; x + 4 <= destWidth; x += 4, pRow += 32, pBelow += 32, pDest += 16) {
+			__m128i first  = averageTwo(_mm_loadu_si128((const __m128i*) pRow),
+										_mm_loadu_si128((const __m128i*) pBelow));
+			__m128i second = averageTwo(_mm_loadu_si128((const __m128i*) (pRow + 16)),
+										_mm_loadu_si128((const __m128i*) (pBelow + 16)));
+			_mm_storeu_si128((__m128i*) pDest, _mm_packus_epi16(first, second));
+		}
+	  #elif defined(MIPGENERATOR_NEON)
+		auto averageTwo = [](uint8x16_t row, uint8x16_t below) {
+			uint16x8_t left	 = vaddl_u8(vget_low_u8(row), vget_low_u8(below));
+			uint16x8_t right = vaddl_u8(vget_high_u8(row), vget_high_u8(below));
+			uint16x8_t sum = vaddq_u16(vcombine_u16(vget_low_u16(left), vget_low_u16(right)),
+									   vcombine_u16(vget_high_u16(left), vget_high_u16(right)));
+			return vrshrn_n_u16(sum, 2);		// (rounded, as (sum + 2) >> 2)
+		};
+		for ( ; x + 4 <= destWidth; x += 4, pRow += 32, pBelow += 32, pDest += 16)
+			vst1q_u8(pDest, vcombine_u8(averageTwo(vld1q_u8(pRow), vld1q_u8(pBelow)),
+										averageTwo(vld1q_u8(pRow + 16), vld1q_u8(pBelow + 16))));
+	  #endif
+	}
+	size_t step = isPaired ? 4 : 0;
+	for ( ; x < destWidth; ++x, pRow += 2 * step, pBelow += 2 * step, pDest += 4)
+		for (int c = 0; c < 4; ++c)
+			pDest[c] = (pRow[c] + pRow[step + c] + pBelow[c] + pBelow[step + c] + 2) >> 2;
+}
+
+
+void MipGenerator::Downsample(const uint8_t* pSource, uint32_t width, uint32_t height, bool isSRGB, uint8_t* pDest)
+{
+	uint32_t destWidth = LevelSize(width, 1), destHeight = LevelSize(height, 1);
+	size_t rowsPerTask = std::max<size_t>(1, TEXELS_PER_TASK / destWidth);
+	size_t sourceStride = (size_t) width * 4;
+	if (isSRGB)
+		srgbTables();		// (built here, rather than by whichever task is first)
+
+	WorkerPool::Shared().parallelFor((destHeight + rowsPerTask - 1) / rowsPerTask, [&](size_t iTask) {
+		size_t yEnd = std::min<size_t>(destHeight, (iTask + 1) * rowsPerTask);
+		for (size_t y = iTask * rowsPerTask; y < yEnd; ++y) {
+			const uint8_t* pRow	  = pSource + 2 * y * sourceStride;
+			const uint8_t* pBelow = (height > 1) ? pRow + sourceStride : pRow;
+			uint8_t* pDestRow = pDest + y * destWidth * 4;
+			if (isSRGB)
+				downsampleRowSRGB(pRow, pBelow, width > 1, destWidth, pDestRow);
+			else
+				downsampleRowLinear(pRow, pBelow, width > 1, destWidth, pDestRow);
+		}
+	});
+}
@@ -0,0 +1,37 @@
+//
+// MipGenerator.h
+//	Vulkan Convenience 3D Objects
+//
+// Mip chain generation for 8-bit RGBA images (see TextureCache): each level
+//	half the width and height of the one before (rounding down, but at least
+//	one texel) down to 1x1, each texel the average of the 2x2 it covers, or
+//	2x1 or 1x2 once the other dimension is down to one.  (An odd last row or
+//	column is left out, as with most box-filtered mips.)
+// Color is averaged in linear light if the image is sRGB-encoded, as textures
+//	of color usually are, so mips don't darken; otherwise (e.g. normal maps)
+//	as is, 16 bytes at a time on SSE2 or NEON.  Rows are spread across the
+//	shared WorkerPool.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef MipGenerator_h
+#define MipGenerator_h
+
+#include <cstdint>
+#include <cstddef>
+
+
+class MipGenerator
+{
+public:
+	static uint32_t LevelCount(uint32_t width, uint32_t height);	// (including the image itself)
+	static uint32_t LevelSize(uint32_t size, uint32_t level)	{ return (size >> level) > 0 ? size >> level : 1; }
+
+	// Next level down from 'pSource', into LevelSize(width, 1) x LevelSize(height, 1) texels at 'pDest'.
+	static void Downsample(const uint8_t* pSource, uint32_t width, uint32_t height, bool isSRGB, uint8_t* pDest);
+
+	static const size_t TEXELS_PER_TASK = 64 * 1024;
+};
+
+#endif	// MipGenerator_h
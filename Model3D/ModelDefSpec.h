@@ -12,17 +12,53 @@
 #ifndef ModelDefSpec_h
 #define ModelDefSpec_h
 
+#include "ToleranceWelder.h"
+#include "MeshGeometry.h"
+#include "VertexQuantizer.h"
+
 enum SpecType {
 	UNSPECIFIED,
 	FONT_3D,
 	OBJ_FILE_TINY,				// use TinyOBJLoader.h
-	OBJ_FILE_FAST,				// use our own faster OBJ loader
-	OBJ_FILE = OBJ_FILE_TINY	// default to this loader
+	OBJ_FILE_FAST,				// use our own faster OBJ loader (FastObjParser.h)
+	OBJ_FILE_STREAMED,			// read through a small buffer, in bounded memory (StreamingObjLoader.h)
+	GLTF_BINARY,				// .glb, drawn straight from the mapped file when its layout allows (GlbLoader.h)
+	PLY_BINARY,					// binary .ply, as from scanners/photogrammetry (PlyLoader.h)
+	OBJ_FILE = OBJ_FILE_FAST	// default to this loader
 };
 
+enum WeldMode {					// how loader merges duplicate vertices:
+	WELD_BY_VALUE,				// when all attributes are identical (catches most)
+	WELD_BY_INDEX,				// when OBJ face corners' v/vt/vn indices are (fastest)
+	WELD_BY_TOLERANCE			// by value, then also when all are within ModelDefSpec::tolerance
+};							//	(slowest; for exports with rounding noise)
+
 struct ModelDefSpec {
 	string		filename = "";
 	SpecType	type	 = UNSPECIFIED;
+	bool		isCached = true;		// keep a binary copy (MeshCache) in local storage for quicker reloads
+	bool		isCompressed = false;	//	with vertices/indices encoded (MeshCodec): smaller on disk, but
+										//	decoded on reload rather than used straight from the file
+	WeldMode	weld	 = WELD_BY_VALUE;
+	WeldTolerance tolerance;			// (if WELD_BY_TOLERANCE)
+	bool		isOptimized = false;	// reorder for vertex cache, overdraw, and vertex fetch (MeshOptimizer)
+										//	(but not GLTF_BINARY loaded in place, presumed exported optimized)
+	bool		isSplit	 = false;		// if over 64K vertices, split into chunks with 16-bit indices
+										//	(drawn per ModelLoader::chunks(), each with its vertexOffset)
+	bool		isClustered = false;	// partition into Meshlets (ModelLoader::meshlets()) for finer culling
+	NormalGeneration normals = NORMALS_BY_ANGLE;	// how to make normals, for a model that has none
+	bool		isTangentSpace = false;	// generate per-vertex tangents (ModelLoader::tangents()) for normal
+										//	mapping, if model has normals and texCoords
+	int			lodCount = 0;			// simplified levels-of-detail to make (ModelLoader::lods()), each
+										//	having half the triangles of the one before
+	bool		isQuantized = false;	// pack vertices compactly (VertexQuantizer), per ModelLoader::quantization()
+	QuantizationBudget quantization;	//	(greatest error allowed, for each attribute to be packed)
+										// (any of isSplit/isClustered/lodCount/isTangentSpace/isQuantized,
+										//	WELD_BY_TOLERANCE, or normals to generate, keeps GLTF_BINARY
+										//	from loading in place; it's repacked instead)
+	bool		isPickable = false;		// build a BVH over its triangles (ModelLoader::bvh()) for ray picking
+	size_t		memoryLimitMB = 0;		// OBJ_FILE_STREAMED fails rather than use more than this to load
+										//	(0 = no limit); doesn't cover optimizing etc. that follows
 
 	bool isRequested() {
 		return ! filename.empty() && type != UNSPECIFIED;
@@ -10,58 +10,929 @@
 #include "ModelLoader.h"
 #include "ModelDefSpec.h"
 #include "Vertex3DTypes.h"
+#include "FastObjParser.h"
+#include "StreamingObjLoader.h"
+#include "GlbLoader.h"
+#include "PlyLoader.h"
+#include "MappedFile.h"
+#include "MeshOptimizer.h"
+#include "ToleranceWelder.h"
+#include "MeshGeometry.h"
+#include "VertexQuantizer.h"
+#include "WorkerPool.h"
+#include <chrono>
+#include <numeric>
+#include <sys/stat.h>
 
 #define TINYOBJLOADER_IMPLEMENTATION
 #include "tiny_obj_loader.h"
-#include <glm/gtx/hash.hpp>
-#include <unordered_map>
+#include "WeldTable.h"
 
 
 typedef Vertex3DNormalTextureColor	CatchAllVertexType;
 
-namespace std {
-	template<> struct hash<CatchAllVertexType> {
-		size_t operator()(CatchAllVertexType const& vertex) const {
-			auto posn = hash<vec3>()(vertex.position);
-			auto norm = hash<vec3>()(vertex.normal);
-			auto texc = hash<vec2>()(vertex.texCoord);
-			auto colr = hash<vec4>()(vertex.color);
-			return ((posn ^ (norm << 1)) >> 1) ^ (colr ^ (texc << 1));
+struct CachedQuantization {			// (budget too, as a cache quantized more loosely than asked for won't do)
+	QuantizedVertexFormat	format;
+	QuantizationBudget		budget;
+};
+
+struct CachedOptions {				// other ModelDefSpec options that change what's cached, to match on reload
+	uint32_t		weld;			//	(as WeldMode)
+	WeldTolerance	tolerance;		//	(if WELD_BY_TOLERANCE)
+	uint32_t		isOptimized;
+	uint32_t		normals;		//	(as the NormalGeneration that made them; or, if the model had its own:)
+	int32_t			lodCount;		//	as asked for, as fewer may have been made (see buildLODs)
+};
+static const uint32_t NORMALS_FROM_MODEL = ~0u;
+
+typedef std::chrono::steady_clock	Clock;
+
+static double secondsSince(Clock::time_point start)
+{
+	return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Renumber a submesh's indices 0, 1, 2... by first use, so what's optimized per submesh has arrays (e.g. Tipsify's,
+//	per vertex) as big as its own vertices, not the whole mesh's: else each of many submeshes scans them all.
+//	submeshVertices then holds the mesh's vertex for each; meshToSubmesh is the mesh's size, allocated once and
+//	left all UNASSIGNED between uses.
+//
+static const uint32_t UNASSIGNED = ~0u;
+
+static void renumberForSubmesh(uint32_t* indices, size_t indexCount,
+							   vector<uint32_t>& meshToSubmesh, vector<uint32_t>& submeshVertices)
+{
+	submeshVertices.clear();
+	for (size_t i = 0; i < indexCount; ++i) {
+		uint32_t& local = meshToSubmesh[indices[i]];
+		if (local == UNASSIGNED) {
+			local = (uint32_t) submeshVertices.size();
+			submeshVertices.push_back(indices[i]);
 		}
+		indices[i] = local;
+	}
+}
+
+static void renumberForMesh(uint32_t* indices, size_t indexCount,
+							vector<uint32_t>& meshToSubmesh, const vector<uint32_t>& submeshVertices)
+{
+	for (size_t i = 0; i < indexCount; ++i)
+		indices[i] = submeshVertices[indices[i]];
+	for (uint32_t iVertex : submeshVertices)
+		meshToSubmesh[iVertex] = UNASSIGNED;
+}
+
+// The reverse of VerticesDynamic's packing (see VertexStride), for re-adding vertices already packed.
+//
+static CatchAllVertexType unpackVertex(const uint8_t* pPacked, AttributeBits attribits)
+{
+	CatchAllVertexType vertex;
+	auto take = [&](void* pAttribute, size_t size) {
+		memcpy(pAttribute, pPacked, size);
+		pPacked += size;
 	};
+	if (attribits & Attribits[POSITION])	take(&vertex.position, sizeof(vertex.position));
+	if (attribits & Attribits[NORMAL])		take(&vertex.normal,   sizeof(vertex.normal));
+	if (attribits & Attribits[TEXCOORD])	take(&vertex.texCoord, sizeof(vertex.texCoord));
+	if (attribits & Attribits[COLOR])		take(&vertex.color,	   sizeof(vertex.color));
+	return vertex;
+}
+
+
+ModelLoader::~ModelLoader()
+{
+	if (pendingLoad.valid())		// (worker may still be writing into our members)
+		pendingLoad.wait();
+}
+
+bool ModelLoader::load(MeshObject& mesh, string nameOBJFile)
+{
+	ModelDefSpec modelSpec;
+	modelSpec.filename = nameOBJFile;
+	modelSpec.type	   = OBJ_FILE;
+	return load(mesh, modelSpec);
+}
+
+// Same as load(), but run on a WorkerPool thread; the future's value is load()'s.  Parsing, welding,
+//	optimizing and all else up to filling in the MeshObject happen there; creating its GPU buffers is
+//	still up to the caller, on its own thread, once the future is ready.  A previous load still in
+//	progress is waited for first (both would be writing to the same members).
+//
+std::shared_future<bool> ModelLoader::loadAsync(MeshObject& mesh, ModelDefSpec modelSpec, LoadProgressCallback onProgress,
+												MeshSink* pMeshSink)
+{
+	if (pendingLoad.valid())
+		pendingLoad.wait();
+	progressCallback = onProgress;
+	loadProgress = 0.0f;
+	pendingLoad = WorkerPool::Shared().submit([this, &mesh, modelSpec, pMeshSink]() {
+		return load(mesh, modelSpec, pMeshSink);
+	}).share();
+	return pendingLoad;
+}
+
+// Loads every model in the batch, the results (and each one's timings) in the batch alongside what was
+//	asked for, so in the same order.  Each of as many jobs as there are cores takes the next model not
+//	yet started until none are left, largest file first: so what's left to go at the end is small, and
+//	the one huge file isn't started last and then finished alone.  Its parser splits it into chunks on
+//	the same pool (as do welding and MeshGeometry), which cores pick up once out of models of their own.
+//	Blocks until all are done; progress is the fraction of all the files' bytes loaded so far.
+//
+bool ModelLoader::LoadMany(vector<BatchedLoad>& batch, LoadProgressCallback onProgress)
+{
+	FileSystem fileSystem;
+	vector<size_t> fileBytes(batch.size(), 0);
+	size_t totalBytes = 0;
+	for (size_t iModel = 0; iModel < batch.size(); ++iModel) {
+		struct stat source;
+		if (stat(fileSystem.ModelFileFullPath(batch[iModel].spec.filename).c_str(), &source) == 0)
+			fileBytes[iModel] = source.st_size;
+		totalBytes += fileBytes[iModel] + 1;		// (+1 so missing or empty files count toward progress)
+	}
+	vector<size_t> largestFirst(batch.size());
+	std::iota(largestFirst.begin(), largestFirst.end(), 0);
+	std::stable_sort(largestFirst.begin(), largestFirst.end(),
+					 [&](size_t a, size_t b) { return fileBytes[a] > fileBytes[b]; });
+
+	for (BatchedLoad& load : batch)
+		if (load.pLoader->pendingLoad.valid())	// (as loadAsync would)
+			load.pLoader->pendingLoad.wait();
+
+	WorkerPool& pool = WorkerPool::Shared();
+	std::atomic<size_t> iNext { 0 };
+	std::atomic<size_t> bytesDone { 0 };
+	pool.parallelFor(min<size_t>(pool.concurrency(), batch.size()), [&](size_t) {
+		for (size_t iStarted; (iStarted = iNext.fetch_add(1)) < batch.size(); ) {
+			size_t iModel = largestFirst[iStarted];
+			BatchedLoad& load = batch[iModel];
+			load.isLoaded = load.pLoader->load(*load.pMesh, load.spec, load.pSink);
+			load.timings  = load.pLoader->timings();
+			size_t bytes = bytesDone.fetch_add(fileBytes[iModel] + 1) + fileBytes[iModel] + 1;
+			if (onProgress)
+				onProgress((float) bytes / totalBytes);
+		}
+	});
+
+	return std::all_of(batch.begin(), batch.end(), [](const BatchedLoad& load) { return load.isLoaded; });
 }
 
+void ModelLoader::reportProgress(float fraction)
+{
+	loadProgress = fraction;
+	if (progressCallback)
+		progressCallback(fraction);
+}
 
-void ModelLoader::load(MeshObject& mesh, string nameOBJFile)
+// Given a MeshSink, the mesh ends up in its memory instead of ours (unless it declines).
+//
+bool ModelLoader::load(MeshObject& mesh, ModelDefSpec modelSpec, MeshSink* pMeshSink)
 {
+	Clock::time_point start = Clock::now();
+	reportProgress(0.0f);
+	pSink = pMeshSink;
 	vertices.clear();
 	indices.clear();
+	smallIndices.clear();
+	splitVertices.clear();
+	meshChunks.clear();
+	meshletList.clear();
+	lodList.clear();
+	lodIndices.clear();
+	smallLodIndices.clear();
+	pLODIndices = nullptr;
+	submeshList.clear();
+	materialList.clear();
+	shapeNameList.clear();
+	meshBounds = { };
+	meshBVH.clear();
+	tangentList.clear();
+	pTangents = nullptr;
+	quantizedVertices.clear();
+	pQuantization = nullptr;
+	decodedVertices.clear();
+	meshIndexType = MESH_LARGE_INDEX;
+	meshAttributes = 0;
+	numRedundantVertices = 0;
+	glb.close();
+	loadTimings = LoadTimings();
+	struct stat source;
+	if (stat(fileSystem.ModelFileFullPath(modelSpec.filename).c_str(), &source) == 0)
+		loadTimings.fileBytes = source.st_size;
+
+	if (modelSpec.isCached && loadCached(mesh, modelSpec)) {
+		loadTimings.isFromCache = true;
+		if (modelSpec.isPickable)
+			buildBVH(mesh);
+		deliver(mesh, vertexStride());
+		loadTimings.total = secondsSince(start);
+		reportProgress(1.0f);
+		return true;
+	}
+	reportProgress(0.05f);
+
+	AttributeBits attribits = 0;
+	WeldMode weld = (modelSpec.weld == WELD_BY_TOLERANCE) ? WELD_BY_VALUE : modelSpec.weld;	// (tolerance is after)
+	switch (modelSpec.type) {
+		case OBJ_FILE_TINY:	attribits = loadTinyObj(modelSpec.filename, weld);	break;
+		case OBJ_FILE_FAST:	attribits = loadFastObj(modelSpec.filename, weld);	break;
+		case OBJ_FILE_STREAMED:
+			attribits = loadStreamedObj(modelSpec.filename, weld, modelSpec.memoryLimitMB);
+			break;
+		case GLTF_BINARY:
+			if (loadGlbInPlace(mesh, modelSpec)) {
+				loadTimings.total = secondsSince(start);
+				reportProgress(1.0f);
+				return mesh.vertexCount > 0;
+			}
+			if (glb.isOpen())
+				attribits = loadGlb(modelSpec.filename);
+			break;
+		case PLY_BINARY:	attribits = loadPly(modelSpec.filename);	break;
+		default:
+			Log(ERROR, "Model '%s' of unsupported SpecType %d not loaded.", modelSpec.filename.c_str(), modelSpec.type);
+	}
+
+	if (attribits && modelSpec.weld == WELD_BY_TOLERANCE) {
+		Clock::time_point weldStart = Clock::now();
+		weldWithinTolerance(attribits, modelSpec.tolerance);
+		loadTimings.weld += secondsSince(weldStart);
+	}
+	uint32_t normalsMade = NORMALS_FROM_MODEL;
+	if (attribits && ! (attribits & Attribits[NORMAL]) && modelSpec.normals != NORMALS_NONE) {
+		Clock::time_point geometryStart = Clock::now();
+		attribits = addNormals(attribits, modelSpec.normals);
+		normalsMade = modelSpec.normals;
+		loadTimings.geometry += secondsSince(geometryStart);
+	}
+	if (attribits)
+		buildSubmeshes(attribits);
+	reportProgress(0.6f);
+
+	if (attribits && modelSpec.isOptimized) {
+		VertexCacheStats before, after;
+		optimize(attribits, modelSpec.isClustered, before, after);
+		Log(RAW, "      done; vertices: %d, redundant vertices culled: %d, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f",
+				 vertices.count(), numRedundantVertices, before.acmr, after.acmr, before.atvr, after.atvr);
+	} else if (attribits) {
+		if (modelSpec.isClustered)
+			buildMeshlets(attribits);
+		Log(RAW, "      done; vertices: %d, redundant vertices culled: %d", vertices.count(), numRedundantVertices);
+	}
+	reportProgress(0.8f);
+	if (submeshList.size() > 1)
+		Log(RAW, "      submeshes: %d, materials: %d", (int) submeshList.size(), (int) materialList.size());
+	if (! meshletList.empty())
+		Log(RAW, "      meshlets: %d, averaging %.1f vertices, %.1f triangles", (int) meshletList.size(),
+				 (float) numMeshletVertices() / meshletList.size(), (float) indices.size() / 3 / meshletList.size());
+
+	if (attribits && modelSpec.lodCount > 0) {
+		if (modelSpec.isSplit && vertices.count() > MeshOptimizer::MAX_SMALL_INDEX_VERTICES)
+			Log(RAW, "      LODs not generated, as mesh will be split");	// (LOD indices would span chunks)
+		else if (submeshList.size() > 1)
+			Log(RAW, "      LODs not generated, as mesh has submeshes");
+		else
+			buildLODs(attribits, modelSpec.lodCount);
+	}
+
+	if (attribits & Attribits[POSITION]) {		// (once vertices are in their final order)
+		Clock::time_point geometryStart = Clock::now();
+		meshBounds = MeshGeometry::Bounds((uint8_t*) vertices.pBytes, vertices.count(), VertexStride(attribits));
+		if (modelSpec.isTangentSpace)
+			buildTangents(attribits, modelSpec.isSplit);
+		if (modelSpec.isPickable)		// (before splitting or quantizing, while positions are floats)
+			meshBVH.build((uint8_t*) vertices.pBytes, VertexStride(attribits), indices.data(), indices.size());
+		loadTimings.geometry += secondsSince(geometryStart);
+	}
+	reportProgress(0.9f);
 
-	AttributeBits attribits = loadTinyObj(nameOBJFile);
+	bool isCaching = modelSpec.isCached && attribits;		// (then deliver after, as caching reads the mesh back)
+	setMesh(mesh, attribits, modelSpec.isSplit, ! isCaching, modelSpec.isQuantized ? &modelSpec.quantization : nullptr);
+
+	if (modelSpec.isCached && attribits && mesh.vertexCount > 0) {	// (MeshCache remembers source path from
+		MeshCacheSection sections[MAX_CACHE_SECTIONS];				//	its failed open() in loadCached() above)
+		sections[CACHED_CHUNKS]	  = { meshChunks.data(), (uint32_t) meshChunks.size(), sizeof(MeshChunk) };
+		sections[CACHED_MESHLETS] = { meshletList.data(), (uint32_t) meshletList.size(), sizeof(Meshlet) };
+		sections[CACHED_LODS]	  = { lodList.data(), (uint32_t) lodList.size(), sizeof(MeshLOD) };
+		uint32_t indexSize = (meshIndexType == MESH_SMALL_INDEX) ? sizeof(uint16_t) : sizeof(uint32_t);
+		uint32_t numLODIndices = lodList.empty() ? 0 : lodList.back().firstIndex + lodList.back().indexCount;
+		sections[CACHED_LOD_INDICES] = { pLODIndices, numLODIndices, indexSize };
+		sections[CACHED_SUBMESHES] = { submeshList.data(), (uint32_t) submeshList.size(), sizeof(Submesh) };
+		vector<float> colors;
+		string names;
+		for (const string& name : shapeNameList)
+			names.append(name).push_back('\0');
+		for (const ModelMaterial& material : materialList) {
+			colors.insert(colors.end(), material.diffuseColor, material.diffuseColor + 3);
+			names.append(material.name).push_back('\0');
+			names.append(material.diffuseTexture).push_back('\0');
+		}
+		sections[CACHED_MATERIAL_COLORS] = { colors.data(), (uint32_t) materialList.size(), 3 * sizeof(float) };
+		sections[CACHED_NAMES] = { names.data(), (uint32_t) names.size(), sizeof(char) };
+		sections[CACHED_BOUNDS] = { &meshBounds, 1, sizeof(MeshBounds) };
+		sections[CACHED_TANGENTS] = { pTangents, pTangents ? mesh.vertexCount : 0, sizeof(VertexTangent) };
+		CachedQuantization quantization = { quantizedFormat, modelSpec.quantization };
+		sections[CACHED_QUANTIZATION] = { &quantization, pQuantization ? 1u : 0u, sizeof(CachedQuantization) };
+		CachedOptions options = { (uint32_t) modelSpec.weld, modelSpec.tolerance, modelSpec.isOptimized, normalsMade,
+								  modelSpec.lodCount };
+		sections[CACHED_OPTIONS] = { &options, 1, sizeof(CachedOptions) };
+		meshCache.write(attribits, mesh.vertices, mesh.vertexCount,
+						vertexStride(), mesh.indices, mesh.indexCount, indexSize, sections, modelSpec.isCompressed);
+		deliver(mesh, vertexStride());
+	}
+	loadTimings.total = secondsSince(start);
+	reportProgress(1.0f);
+	return mesh.vertexCount > 0;
+}
+
+// Point mesh at what was loaded, using 16-bit indices if they'll fit, which halves index memory and bandwidth.
+//	If not, and splitting is requested, break the mesh into chunks (see MeshChunk) whose indices do fit.
+//	Given a budget, then pack the (final, maybe split) vertices compactly: see VertexQuantizer.
+//	If it's to go to a MeshSink, write it there directly instead, narrowing indices on the way.
+//
+void ModelLoader::setMesh(MeshObject& mesh, AttributeBits attribits, bool isSplit, bool isToSink,
+						  const QuantizationBudget* pBudget)
+{
+	uint32_t stride = VertexStride(attribits);
 
 	mesh.vertexType.initialize(attribits);
+	meshAttributes = attribits;
 
 	mesh.vertices	 = vertices.pBytes;
 	mesh.vertexCount = vertices.count();
 	mesh.indices	 = &indices[0];
 	mesh.indexCount	 = (uint32_t) indices.size();
+
+	if (mesh.vertexCount > MeshOptimizer::MAX_SMALL_INDEX_VERTICES && isSplit && stride > 0) {
+		vector<uint32_t> meshletStarts;		// (keep each meshlet within one chunk)
+		for (const Meshlet& meshlet : meshletList)
+			meshletStarts.push_back(meshlet.firstIndex);
+		MeshOptimizer::SplitIndexRanges((uint8_t*) vertices.pBytes, vertices.count(), stride,
+										indices.data(), indices.size(), splitVertices, meshChunks,
+										meshletList.empty() ? nullptr : &meshletStarts);
+		uint32_t numSplitVertices = (uint32_t) (splitVertices.size() / stride);
+		Log(RAW, "      split into %d chunks for 16-bit indices, vertices duplicated: %d",
+				 (int) meshChunks.size(), numSplitVertices - mesh.vertexCount);
+		mesh.vertices	 = splitVertices.data();
+		mesh.vertexCount = numSplitVertices;
+		vertices.clear();
+	}
+
+	if (pBudget && (attribits & Attribits[POSITION]) && mesh.vertexCount > 0) {
+		Clock::time_point geometryStart = Clock::now();
+		quantizedFormat = VertexQuantizer::Choose((uint8_t*) mesh.vertices, mesh.vertexCount, attribits,
+												  meshBounds, *pBudget);
+		VertexQuantizer::Quantize((uint8_t*) mesh.vertices, mesh.vertexCount, attribits, quantizedFormat,
+								  quantizedVertices);
+		pQuantization = &quantizedFormat;
+		Log(RAW, "      quantized: %d bytes per vertex, from %d", quantizedFormat.stride, stride);
+		mesh.vertices = quantizedVertices.data();
+		stride = quantizedFormat.stride;
+		vertices.clear();
+		vector<uint8_t>().swap(splitVertices);
+		loadTimings.geometry += secondsSince(geometryStart);
+	}
+
+	bool isSmall = mesh.vertexCount <= MeshOptimizer::MAX_SMALL_INDEX_VERTICES || ! meshChunks.empty();
+	if (isSmall) {
+		meshIndexType = MESH_SMALL_INDEX;
+		smallLodIndices.assign(lodIndices.begin(), lodIndices.end());
+		vector<uint32_t>().swap(lodIndices);
+		pLODIndices = smallLodIndices.data();
+	} else
+		pLODIndices = lodIndices.data();
+	mesh.indexType = meshIndexType;
+
+	size_t vertexBytes = (size_t) mesh.vertexCount * stride;
+	size_t indexBytes  = (size_t) mesh.indexCount * (isSmall ? sizeof(uint16_t) : sizeof(uint32_t));
+	void *pVertices, *pIndices;
+	if (isToSink && pSink && mesh.vertexCount > 0
+		&& pSink->reserve(vertexBytes, indexBytes, pVertices, pIndices)) {
+		memcpy(pVertices, mesh.vertices, vertexBytes);
+		if (isSmall)
+			std::copy(indices.begin(), indices.end(), (uint16_t*) pIndices);
+		else
+			memcpy(pIndices, indices.data(), indexBytes);
+		mesh.vertices = pVertices;
+		mesh.indices  = pIndices;
+		releaseMeshData();
+	} else if (isSmall) {
+		smallIndices.assign(indices.begin(), indices.end());
+		vector<uint32_t>().swap(indices);		// (release the 32-bit copy)
+		mesh.indices = smallIndices.data();
+	}
+}
+
+// Copy an already-final mesh (cached, in place, or just cached) to the MeshSink, if there is one and it accepts.
+//
+bool ModelLoader::deliver(MeshObject& mesh, uint32_t vertexStride)
+{
+	if (! pSink || mesh.vertexCount == 0)
+		return false;
+	size_t vertexBytes = (size_t) mesh.vertexCount * vertexStride;
+	size_t indexBytes  = (size_t) mesh.indexCount * (mesh.indexType == MESH_SMALL_INDEX ? sizeof(uint16_t) : sizeof(uint32_t));
+	void *pVertices, *pIndices;
+	if (! pSink->reserve(vertexBytes, indexBytes, pVertices, pIndices))
+		return false;
+	memcpy(pVertices, mesh.vertices, vertexBytes);
+	if (indexBytes > 0)
+		memcpy(pIndices, mesh.indices, indexBytes);
+	mesh.vertices = pVertices;
+	mesh.indices  = pIndices;
+	releaseMeshData();
+	return true;
+}
+
+void ModelLoader::releaseMeshData()		// (once the mesh lives elsewhere)
+{
+	vertices.clear();
+	vector<uint32_t>().swap(indices);
+	vector<uint16_t>().swap(smallIndices);
+	vector<uint8_t>().swap(splitVertices);
+	vector<uint8_t>().swap(quantizedVertices);
+	vector<uint8_t>().swap(decodedVertices);
+}
+
+// Merge vertices that (already welded by value) still differ by no more than rounding noise: see ToleranceWelder.
+//	Triangles left with two corners the same vertex are dropped, along with their shape/material tags.
+//
+void ModelLoader::weldWithinTolerance(AttributeBits attribits, const WeldTolerance& tolerance)
+{
+	uint32_t stride = VertexStride(attribits);
+	size_t vertexCount = vertices.count();
+	if (! (attribits & Attribits[POSITION]) || vertexCount == 0)
+		return;
+
+	WeldLayout layout;
+	int offset = 3;
+	if (attribits & Attribits[NORMAL])		{ layout.normal	  = offset;  offset += 3; }
+	if (attribits & Attribits[TEXCOORD])	{ layout.texCoord = offset;  offset += 2; }
+	if (attribits & Attribits[COLOR])		{ layout.color	  = offset; }
+
+	vector<uint32_t> remap;
+	size_t numKept = ToleranceWelder::Weld((uint8_t*) vertices.pBytes, vertexCount, stride, layout, tolerance, remap);
+	if (numKept == vertexCount) {
+		Log(RAW, "      welded within tolerance: no further vertices merged");
+		return;
+	}
+
+	vector<uint8_t> welded(vertexCount * stride);		// (VerticesDynamic only grows, so rebuild it)
+	memcpy(welded.data(), vertices.pBytes, welded.size());
+	vertices.clear();
+	vertices.setAttributes(attribits);
+	for (size_t v = 0, numPushed = 0; v < vertexCount; ++v)
+		if (remap[v] == numPushed) {
+			vertices.push_back(unpackVertex(&welded[v * stride], attribits));
+			++numPushed;
+		}
+	vertices.exactResize();
+
+	size_t numTriangles = indices.size() / 3, numKeptTriangles = 0;
+	bool isTagged = triangleShapes.size() == numTriangles;
+	for (size_t iTriangle = 0; iTriangle < numTriangles; ++iTriangle) {
+		uint32_t a = remap[indices[3 * iTriangle]], b = remap[indices[3 * iTriangle + 1]], c = remap[indices[3 * iTriangle + 2]];
+		if (a == b || b == c || c == a)
+			continue;
+		indices[3 * numKeptTriangles] = a;
+		indices[3 * numKeptTriangles + 1] = b;
+		indices[3 * numKeptTriangles + 2] = c;
+		if (isTagged) {
+			triangleShapes[numKeptTriangles]	= triangleShapes[iTriangle];
+			triangleMaterials[numKeptTriangles] = triangleMaterials[iTriangle];
+		}
+		++numKeptTriangles;
+	}
+	indices.resize(3 * numKeptTriangles);
+	if (isTagged) {
+		triangleShapes.resize(numKeptTriangles);
+		triangleMaterials.resize(numKeptTriangles);
+	}
+
+	size_t numMerged = vertexCount - numKept;
+	numRedundantVertices += (int) numMerged;
+	Log(RAW, "      welded within tolerance: %zu more vertices merged, saving %.1f KB; %zu degenerate triangles dropped",
+			 numMerged, numMerged * stride / 1024.0, numTriangles - numKeptTriangles);
+}
+
+// For a model that came without normals: repack its vertices with room for them (VerticesDynamic having no way
+//	to add an attribute in place), then generate them.  Done before optimizing, which must see the final layout.
+//
+AttributeBits ModelLoader::addNormals(AttributeBits attribits, NormalGeneration weighting)
+{
+	if (! (attribits & Attribits[POSITION]))
+		return attribits;
+	uint32_t stride = VertexStride(attribits);
+	size_t vertexCount = vertices.count();
+	vector<uint8_t> packed(vertexCount * stride);
+	memcpy(packed.data(), vertices.pBytes, packed.size());
+
+	AttributeBits withNormals = attribits | Attribits[NORMAL];
+	vertices.clear();
+	vertices.setAttributes(withNormals);
+	for (size_t v = 0; v < vertexCount; ++v)
+		vertices.push_back(unpackVertex(&packed[v * stride], attribits));
+	vertices.exactResize();
+
+	MeshGeometry::GenerateNormals((uint8_t*) vertices.pBytes, vertexCount, VertexStride(withNormals),
+								  3, indices.data(), indices.size(), weighting);	// (normal follows position)
+	Log(RAW, "      normals generated, weighted by %s", (weighting == NORMALS_BY_ANGLE) ? "angle" : "area");
+	return withNormals;
+}
+
+// Tangents are per vertex, so are made once vertices are in their final order; but not if the mesh will be
+//	split, which re-lays vertices out per chunk.
+//
+void ModelLoader::buildTangents(AttributeBits attribits, bool isSplit)
+{
+	if (! (attribits & Attribits[NORMAL]) || ! (attribits & Attribits[TEXCOORD]))
+		Log(RAW, "      tangents not generated, as mesh lacks normals or texCoords");
+	else if (isSplit && vertices.count() > MeshOptimizer::MAX_SMALL_INDEX_VERTICES)
+		Log(RAW, "      tangents not generated, as mesh will be split");
+	else {
+		MeshGeometry::GenerateTangents((uint8_t*) vertices.pBytes, vertices.count(), VertexStride(attribits),
+									   3, 6, indices.data(), indices.size(), tangentList);	// (normal, texCoord
+		pTangents = tangentList.data();														//	follow position)
+	}
+}
+
+// Picking BVH for a mesh that's already final (from cache, or in place), so may be quantized, have 16-bit
+//	indices, or be split: positions read back as floats, and indices widened, and offset per chunk.  (A mesh
+//	loaded afresh builds its BVH earlier, from the vertices and indices as welded.)
+//
+void ModelLoader::buildBVH(MeshObject& mesh)
+{
+	if (! (meshAttributes & Attribits[POSITION]) || mesh.indexCount == 0)
+		return;
+	const uint8_t* pVertices = (const uint8_t*) mesh.vertices;
+	uint32_t stride = vertexStride();
+	vector<uint8_t> dequantized;
+	if (pQuantization) {
+		VertexQuantizer::Dequantize(pVertices, mesh.vertexCount, meshAttributes, *pQuantization, dequantized);
+		pVertices = dequantized.data();
+		stride = VertexStride(meshAttributes);
+	}
+	vector<uint32_t> wideIndices(mesh.indexCount);
+	if (meshIndexType == MESH_SMALL_INDEX)
+		std::copy((const uint16_t*) mesh.indices, (const uint16_t*) mesh.indices + mesh.indexCount, wideIndices.begin());
+	else
+		memcpy(wideIndices.data(), mesh.indices, mesh.indexCount * sizeof(uint32_t));
+	for (const MeshChunk& chunk : meshChunks)
+		for (uint32_t iIndex = chunk.firstIndex; iIndex < chunk.firstIndex + chunk.indexCount; ++iIndex)
+			wideIndices[iIndex] += chunk.vertexOffset;
+	meshBVH.build(pVertices, stride, wideIndices.data(), wideIndices.size());
+}
+
+// Group triangles by shape and material, as tagged by the parser.  There's always at least one Submesh
+//	(so a renderer needn't special-case its absence) and one shape name (if unnamed, as is any streamed).
+//
+void ModelLoader::buildSubmeshes(AttributeBits attribits)
+{
+	if (attribits & Attribits[POSITION])
+		SubmeshBuilder::Build(indices.data(), indices.size(), triangleShapes, triangleMaterials,
+							  (uint8_t*) vertices.pBytes, VertexStride(attribits), submeshList);
+	if (shapeNameList.empty())
+		shapeNameList.push_back("");
+	vector<uint32_t>().swap(triangleShapes);
+	vector<int32_t>().swap(triangleMaterials);
+}
+
+vector<Submesh> ModelLoader::submeshRanges()	// (whole mesh as one, if no submeshes)
+{
+	if (! submeshList.empty())
+		return submeshList;
+	Submesh whole = {};
+	whole.indexCount = (uint32_t) indices.size();
+	whole.materialID = -1;
+	return { whole };
+}
+
+// Reorder triangles for vertex cache, then overdraw (or into meshlets instead), then renumber vertices into
+//	first-use order.  Done before caching, so a cached mesh is already optimized.  Triangles are only
+//	reordered within their submesh (numbered on its own, if there are several).
+//
+void ModelLoader::optimize(AttributeBits attribits, bool isClustered, VertexCacheStats& before, VertexCacheStats& after)
+{
+	uint8_t*  pVertices	  = (uint8_t*) vertices.pBytes;
+	size_t	  vertexCount = vertices.count();
+	uint32_t  stride	  = VertexStride(attribits);
+	uint32_t* pIndices	  = indices.data();
+	size_t	  indexCount  = indices.size();
+
+	before = MeshOptimizer::AnalyzeVertexCache(pIndices, indexCount, vertexCount);
+
+	vector<Submesh> ranges = submeshRanges();
+	vector<uint32_t> meshToSubmesh(ranges.size() > 1 ? vertexCount : 0, UNASSIGNED), submeshVertices;
+	for (const Submesh& submesh : ranges) {
+		uint32_t* pRange = pIndices + submesh.firstIndex;
+		vector<uint32_t> clusterStarts;
+		if (ranges.size() > 1) {
+			renumberForSubmesh(pRange, submesh.indexCount, meshToSubmesh, submeshVertices);
+			MeshOptimizer::OptimizeVertexCache(pRange, submesh.indexCount, submeshVertices.size(), &clusterStarts);
+			renumberForMesh(pRange, submesh.indexCount, meshToSubmesh, submeshVertices);
+		} else
+			MeshOptimizer::OptimizeVertexCache(pRange, submesh.indexCount, vertexCount, &clusterStarts);
+		if (! isClustered && (attribits & Attribits[POSITION]))	// (position, if present, is always first attribute)
+			MeshOptimizer::OptimizeOverdraw(pRange, submesh.indexCount, clusterStarts, pVertices, stride);
+	}
+	if (isClustered)
+		buildMeshlets(attribits);
+	MeshOptimizer::OptimizeVertexFetch(pVertices, vertexCount, stride, pIndices, indexCount);
+
+	after = MeshOptimizer::AnalyzeVertexCache(pIndices, indexCount, vertexCount);
+}
+
+// Meshlets are built from the cache-optimized triangle order, so each stays cache-friendly inside.
+//	(OptimizeVertexFetch leaves triangle order, thus meshlet index ranges, unchanged.)  Built per
+//	submesh, so none straddles two, and each culls (and draws) with its submesh's material.  If there are
+//	several, each is numbered on its own (as in optimize) with its vertices' positions copied alongside.
+//
+void ModelLoader::buildMeshlets(AttributeBits attribits)
+{
+	meshletList.clear();
+	if (! (attribits & Attribits[POSITION]))
+		return;
+	const uint8_t* pVertices = (uint8_t*) vertices.pBytes;
+	uint32_t stride = VertexStride(attribits);
+	vector<Submesh> ranges = submeshRanges();
+	vector<uint32_t> meshToSubmesh(ranges.size() > 1 ? vertices.count() : 0, UNASSIGNED), submeshVertices;
+	vector<float> positions;
+	vector<Meshlet> submeshMeshlets;
+	for (const Submesh& submesh : ranges) {
+		uint32_t* pRange = &indices[submesh.firstIndex];
+		if (ranges.size() > 1) {
+			renumberForSubmesh(pRange, submesh.indexCount, meshToSubmesh, submeshVertices);
+			positions.resize(3 * submeshVertices.size());
+			for (size_t iLocal = 0; iLocal < submeshVertices.size(); ++iLocal)
+				memcpy(&positions[3 * iLocal], pVertices + submeshVertices[iLocal] * stride, 3 * sizeof(float));
+			MeshletBuilder::Build(pRange, submesh.indexCount, (uint8_t*) positions.data(), submeshVertices.size(),
+								  3 * sizeof(float), submeshMeshlets);
+			renumberForMesh(pRange, submesh.indexCount, meshToSubmesh, submeshVertices);
+		} else
+			MeshletBuilder::Build(pRange, submesh.indexCount, pVertices, vertices.count(), stride, submeshMeshlets);
+		for (Meshlet& meshlet : submeshMeshlets) {
+			meshlet.firstIndex += submesh.firstIndex;
+			meshletList.push_back(meshlet);
+		}
+	}
+}
+
+uint32_t ModelLoader::numMeshletVertices()
+{
+	uint32_t numVertices = 0;
+	for (const Meshlet& meshlet : meshletList)
+		numVertices += meshlet.vertexCount;
+	return numVertices;
+}
+
+// Each LOD is simplified from the full-detail mesh (not the previous LOD) so its error is measured against
+//	the original, then re-optimized for vertex cache.  Stops early if simplification stalls, which it can
+//	when most vertices are locked (lots of seams or borders).
+//
+void ModelLoader::buildLODs(AttributeBits attribits, int lodCount)
+{
+	if (! (attribits & Attribits[POSITION]))
+		return;
+	const uint8_t* pVertices = (uint8_t*) vertices.pBytes;
+	size_t vertexCount = vertices.count();
+	size_t previousCount = indices.size();
+	string triangleCounts;
+
+	for (int iLOD = 0; iLOD < lodCount; ++iLOD) {
+		size_t target = (indices.size() >> (iLOD + 1)) / 3 * 3;
+		size_t firstIndex = lodIndices.size();
+		lodIndices.resize(firstIndex + indices.size());
+
+		float error;
+		size_t count = MeshSimplifier::Simplify(&lodIndices[firstIndex], indices.data(), indices.size(),
+												pVertices, vertexCount, VertexStride(attribits), target, &error);
+		if (count == 0 || count > previousCount * 9 / 10) {
+			lodIndices.resize(firstIndex);
+			break;
+		}
+		lodIndices.resize(firstIndex + count);
+		MeshOptimizer::OptimizeVertexCache(&lodIndices[firstIndex], count, vertexCount);
+
+		lodList.push_back({ (uint32_t) firstIndex, (uint32_t) count, error });
+		triangleCounts += (triangleCounts.empty() ? "" : ", ") + to_string(count / 3);
+		previousCount = count;
+	}
+	pLODIndices = lodIndices.data();
+	if (! lodList.empty())
+		Log(RAW, "      LODs: %d, triangles: %s", (int) lodList.size(), triangleCounts.c_str());
+}
+
+// Warm start: point the mesh straight into the memory-mapped cache file, which stays
+//	mapped for as long as this ModelLoader lives (or until its next load).
+//
+bool ModelLoader::loadCached(MeshObject& mesh, ModelDefSpec& modelSpec)
+{
+	string fullPath = fileSystem.ModelFileFullPath(modelSpec.filename);
+	if (! meshCache.open(fullPath))
+		return false;
+	uint32_t numCachedChunks, numCachedMeshlets, numCachedLODs, numCachedLODIndices;
+	const MeshChunk* pChunks   = meshCache.section<MeshChunk>(CACHED_CHUNKS, numCachedChunks);
+	const Meshlet*	 pMeshlets = meshCache.section<Meshlet>(CACHED_MESHLETS, numCachedMeshlets);
+	const MeshLOD*	 pLODs	   = meshCache.section<MeshLOD>(CACHED_LODS, numCachedLODs);
+	if (meshCache.indexSize() == sizeof(uint16_t))
+		pLODIndices = meshCache.section<uint16_t>(CACHED_LOD_INDICES, numCachedLODIndices);
+	else
+		pLODIndices = meshCache.section<uint32_t>(CACHED_LOD_INDICES, numCachedLODIndices);
+	bool hasLODIndices = numCachedLODs == 0
+						 || numCachedLODIndices >= pLODs[numCachedLODs - 1].firstIndex + pLODs[numCachedLODs - 1].indexCount;
+	uint32_t numCachedSubmeshes, numCachedMaterials, numNameChars;
+	const Submesh*	pSubmeshes = meshCache.section<Submesh>(CACHED_SUBMESHES, numCachedSubmeshes);
+	const float*	pColors = (const float*) meshCache.section<float[3]>(CACHED_MATERIAL_COLORS, numCachedMaterials);
+	const char*		pNames = meshCache.section<char>(CACHED_NAMES, numNameChars);
+	uint32_t numCachedBounds, numCachedTangents, numCachedQuantizations;
+	const MeshBounds*	 pBounds = meshCache.section<MeshBounds>(CACHED_BOUNDS, numCachedBounds);
+	const VertexTangent* pCachedTangents = meshCache.section<VertexTangent>(CACHED_TANGENTS, numCachedTangents);
+	const CachedQuantization* pCachedQuantization = meshCache.section<CachedQuantization>(CACHED_QUANTIZATION,
+																						  numCachedQuantizations);
+	bool isQuantized = numCachedQuantizations == 1;
+	uint32_t numCachedOptions;
+	const CachedOptions* pCachedOptions = meshCache.section<CachedOptions>(CACHED_OPTIONS, numCachedOptions);
+	bool isWeldedAsAsked = numCachedOptions == 1 && pCachedOptions->weld == (uint32_t) modelSpec.weld
+						   && (modelSpec.weld != WELD_BY_TOLERANCE
+							   || ! memcmp(&pCachedOptions->tolerance, &modelSpec.tolerance, sizeof(WeldTolerance)));
+	bool isOptimizedAsAsked = numCachedOptions == 1 && (pCachedOptions->isOptimized != 0) == modelSpec.isOptimized;
+	bool hasLODsAsAsked = numCachedOptions == 1 && pCachedOptions->lodCount == modelSpec.lodCount && hasLODIndices;
+	AttributeBits cachedAttributes = meshCache.attributes();
+	bool areNormalsAsAsked = ! (cachedAttributes & Attribits[NORMAL]) ? modelSpec.normals == NORMALS_NONE
+							 : numCachedOptions == 1 && (pCachedOptions->normals == NORMALS_FROM_MODEL
+														 || pCachedOptions->normals == (uint32_t) modelSpec.normals);
+	const QuantizationBudget& budget = modelSpec.quantization;
+	bool isQuantizedAsAsked = isQuantized ? modelSpec.isQuantized
+										   && ! memcmp(&pCachedQuantization->budget, &budget, sizeof(budget))
+										  : ! modelSpec.isQuantized;
+	bool isTangentSpace = modelSpec.isTangentSpace && (cachedAttributes & Attribits[NORMAL])
+						  && (cachedAttributes & Attribits[TEXCOORD]) && numCachedChunks == 0;	// (see buildTangents)
+	vector<string> names;
+	for (const char* pName = pNames; pName < pNames + numNameChars; pName += names.back().size() + 1)
+		names.push_back(string(pName, strnlen(pName, pNames + numNameChars - pName)));
+	if (meshCache.vertexStride() != (isQuantized ? pCachedQuantization->format.stride : VertexStride(cachedAttributes))
+		|| ! isQuantizedAsAsked || ! isWeldedAsAsked || ! isOptimizedAsAsked || ! areNormalsAsAsked
+		|| ! hasLODsAsAsked || meshCache.isEncoded() != modelSpec.isCompressed
+		|| (numCachedChunks > 0 && ! modelSpec.isSplit)				// (caller expects one unsplit mesh)
+		|| (numCachedMeshlets == 0 && modelSpec.isClustered)		// (or wants meshlets that weren't made)
+		|| (isTangentSpace && numCachedTangents != meshCache.vertexCount())
+		|| numCachedBounds != 1 || numCachedSubmeshes == 0 || names.size() < 1 + 2 * numCachedMaterials) {
+		pLODIndices = nullptr;
+		meshCache.close();
+		return false;
+	}
+	Log(RAW, "Load: model - cached: %s", fullPath.c_str());
+
+	mesh.vertexType.initialize(meshCache.attributes());
+	meshAttributes = meshCache.attributes();
+
+	mesh.vertices	 = (void*) meshCache.vertices();	// (read-only memory! buffer code only copies from it)
+	mesh.vertexCount = meshCache.vertexCount();
+	mesh.indices	 = (void*) meshCache.indices();
+	mesh.indexCount	 = meshCache.indexCount();
+
+	if (meshCache.isEncoded()) {
+		Clock::time_point decodeStart = Clock::now();
+		decodedVertices.resize((size_t) mesh.vertexCount * meshCache.vertexStride());
+		if (meshCache.indexSize() == sizeof(uint16_t)) {
+			smallIndices.resize(mesh.indexCount);
+			mesh.indices = smallIndices.data();
+		} else {
+			indices.resize(mesh.indexCount);
+			mesh.indices = indices.data();
+		}
+		mesh.vertices = decodedVertices.data();
+		if (! meshCache.decode(mesh.vertices, mesh.indices)) {
+			Log(RAW, "      corrupt; reloading");
+			releaseMeshData();
+			pLODIndices = nullptr;
+			meshCache.close();
+			return false;
+		}
+		loadTimings.parse += secondsSince(decodeStart);
+	}
+
+	meshIndexType	 = (meshCache.indexSize() == sizeof(uint16_t)) ? MESH_SMALL_INDEX : MESH_LARGE_INDEX;
+	mesh.indexType	 = meshIndexType;
+	meshChunks.assign(pChunks, pChunks + numCachedChunks);
+	meshletList.assign(pMeshlets, pMeshlets + numCachedMeshlets);
+	lodList.assign(pLODs, pLODs + numCachedLODs);
+	submeshList.assign(pSubmeshes, pSubmeshes + numCachedSubmeshes);
+	meshBounds = *pBounds;
+	if (isTangentSpace)
+		pTangents = pCachedTangents;
+	if (isQuantized)
+		pQuantization = &pCachedQuantization->format;
+	size_t numShapes = names.size() - 2 * numCachedMaterials;
+	shapeNameList.assign(names.begin(), names.begin() + numShapes);
+	for (uint32_t iMaterial = 0; iMaterial < numCachedMaterials; ++iMaterial) {
+		ModelMaterial material;
+		material.name			= names[numShapes + 2 * iMaterial];
+		material.diffuseTexture = names[numShapes + 2 * iMaterial + 1];
+		memcpy(material.diffuseColor, &pColors[3 * iMaterial], sizeof(material.diffuseColor));
+		materialList.push_back(material);
+	}
+
+	Log(RAW, "      done; vertices: %d, indices: %d (from cache)", mesh.vertexCount, mesh.indexCount);
+	return true;
+}
+
+// Zero-copy: point the mesh straight into the mapped .glb, as loadCached() does its cache file, when
+//	GlbLoader finds its layout matches ours and nothing requested would rewrite it (which the file is
+//	read-only for).  There's nothing to cache either, reloading being no slower than from a MeshCache.
+//
+bool ModelLoader::loadGlbInPlace(MeshObject& mesh, ModelDefSpec& modelSpec)
+{
+	string fullPath = fileSystem.ModelFileFullPath(modelSpec.filename);
+	Log(RAW, "Load: model - file: %s  (glTF binary)", fullPath.c_str());
+
+	GlbInPlaceMesh view;
+	if (! glb.open(fullPath))
+		Log(RAW, "      FAILED! " + glb.failure);
+	else if (modelSpec.isClustered || modelSpec.lodCount > 0)
+		Log(RAW, "      repacking, as meshlets/LODs were requested");
+	else if (modelSpec.weld == WELD_BY_TOLERANCE)
+		Log(RAW, "      repacking, as welding within tolerance was requested");
+	else if (modelSpec.isTangentSpace)
+		Log(RAW, "      repacking, as tangents were requested");
+	else if (modelSpec.isQuantized)
+		Log(RAW, "      repacking, as quantizing was requested");
+	else if (! glb.viewInPlace(view))
+		Log(RAW, "      repacking, as " + glb.failure);
+	else if (! (view.attribits & Attribits[NORMAL]) && modelSpec.normals != NORMALS_NONE)
+		Log(RAW, "      repacking, as normals are to be generated");
+	else if (modelSpec.isSplit && view.vertexCount > MeshOptimizer::MAX_SMALL_INDEX_VERTICES)
+		Log(RAW, "      repacking, as mesh will be split");
+	else {
+		mesh.vertexType.initialize(view.attribits);
+		meshAttributes = view.attribits;
+
+		mesh.vertices	 = (void*) view.pVertices;	// (read-only memory! buffer code only copies from it)
+		mesh.vertexCount = view.vertexCount;
+		mesh.indices	 = (void*) view.pIndices;
+		mesh.indexCount	 = view.indexCount;
+
+		meshIndexType	 = (view.indexSize == sizeof(uint16_t)) ? MESH_SMALL_INDEX : MESH_LARGE_INDEX;
+		mesh.indexType	 = meshIndexType;
+		submeshList		 = std::move(view.submeshes);
+		shapeNameList	 = glb.shapeNames;
+		glb.readMaterials(materialList);
+		if (view.attribits & Attribits[POSITION])
+			meshBounds = MeshGeometry::Bounds((const uint8_t*) view.pVertices, view.vertexCount,
+											  VertexStride(view.attribits));
+
+		if (glb.numPrimitivesSkipped > 0)
+			Log(RAW, "      skipped %zu non-triangle primitives", glb.numPrimitivesSkipped);
+		if (submeshList.size() > 1)
+			Log(RAW, "      submeshes: %d, materials: %d", (int) submeshList.size(), (int) materialList.size());
+		Log(RAW, "      done; vertices: %d, indices: %d (in place)", mesh.vertexCount, mesh.indexCount);
+		if (modelSpec.isPickable)
+			buildBVH(mesh);
+		deliver(mesh, VertexStride(view.attribits));
+		return true;
+	}
+	return false;
+}
+
+// Bytes per vertex as VerticesDynamic packs them: only the attributes present, each sized as in CatchAllVertexType.
+//
+uint32_t ModelLoader::VertexStride(AttributeBits attribits)
+{
+	return ((attribits & Attribits[POSITION]) ? sizeof(CatchAllVertexType::position) : 0)
+		 + ((attribits & Attribits[NORMAL])	  ? sizeof(CatchAllVertexType::normal)	 : 0)
+		 + ((attribits & Attribits[TEXCOORD]) ? sizeof(CatchAllVertexType::texCoord) : 0)
+		 + ((attribits & Attribits[COLOR])	  ? sizeof(CatchAllVertexType::color)	 : 0);
+}
+
+uint32_t ModelLoader::vertexStride()
+{
+	return pQuantization ? pQuantization->stride : VertexStride(meshAttributes);
 }
 
 MeshIndexType ModelLoader::indexType()
 {
-	return indexTypeTinyObj();
+	return meshIndexType;
 }
 
 
-// LOADER-IMPLEMENTATION-SPECIFIC (currently only supported: tiny_obj_loader)
+// LOADER-IMPLEMENTATION-SPECIFIC (currently supported: tiny_obj_loader, our FastObjParser, StreamingObjLoader,
+//								   GlbLoader, PlyLoader)
+
+
+static AttributeBits assembleVertices(VerticesDynamic& vertices, vector<uint32_t>& indices,
+									  tinyobj::attrib_t& tiny, vector<tinyobj::shape_t>& shapes,
+									  string& nameOBJFile, WeldMode weldMode, int& numRedundantVertices,
+									  vector<string>& shapeNames, vector<uint32_t>& triangleShapes,
+									  vector<int32_t>& triangleMaterials);
 
+static void loadMaterials(FastObjParser& parser, const string& directory, vector<tinyobj::shape_t>& shapes,
+						  vector<ModelMaterial>& materialList);
 
-MeshIndexType ModelLoader::indexTypeTinyObj()
+static string directoryOf(const string& fullPath)
 {
-	return MESH_LARGE_INDEX;	// tiny_obj_loader always returns 32-bit indices
+	size_t iSlash = fullPath.find_last_of("/\\");
+	return (iSlash == string::npos) ? "" : fullPath.substr(0, iSlash + 1);
 }
 
-AttributeBits ModelLoader::loadTinyObj(string nameOBJFile)
+AttributeBits ModelLoader::loadTinyObj(string nameOBJFile, WeldMode weldMode)
 {
 	tinyobj::attrib_t tiny;
 	vector<tinyobj::shape_t> shapes;
@@ -72,77 +943,382 @@ AttributeBits ModelLoader::loadTinyObj(string nameOBJFile)
 	const char* charPath = fullPath.c_str();
 	Log(RAW, "Load: model - file: %s", charPath);
 
-	if (!tinyobj::LoadObj(&tiny, &shapes, &materials, &warn, &err, charPath)) {
+	Clock::time_point start = Clock::now();
+	string directory = directoryOf(fullPath);
+	if (!tinyobj::LoadObj(&tiny, &shapes, &materials, &warn, &err, charPath, directory.c_str())) {
 		Log(RAW, "      FAILED! err \"" + err + "\" warn: " + warn);
 		return 0;
 	}
+	for (const auto& tinyMaterial : materials) {
+		ModelMaterial material;
+		material.name			= tinyMaterial.name;
+		material.diffuseTexture = tinyMaterial.diffuse_texname;
+		memcpy(material.diffuseColor, tinyMaterial.diffuse, sizeof(material.diffuseColor));
+		materialList.push_back(material);
+	}
+	loadTimings.parse = secondsSince(start);
 
-	// Whatever arrays tinyobj::attrib_t returns (which are non-empty) determines both
-	//	which Vertex Type and shaders to use.  (wait, see related note at end of file)
-	AttributeBits tinybits = ((! tiny.vertices.empty())	 ? Attribits[POSITION] : 0)
-						   | ((! tiny.normals.empty())	 ? Attribits[NORMAL]   : 0)
-						   | ((! tiny.texcoords.empty()) ? Attribits[TEXCOORD] : 0)
-						   | ((! tiny.colors.empty())	 ? Attribits[COLOR]    : 0);
+	start = Clock::now();
+	AttributeBits attribits = assembleVertices(vertices, indices, tiny, shapes, nameOBJFile, weldMode,
+											   numRedundantVertices, shapeNameList, triangleShapes, triangleMaterials);
+	if (! pSink)
+		vertices.exactResize();		// (else it's soon copied out to the sink and freed anyway)
+	loadTimings.weld = secondsSince(start);
+	return attribits;
+}
 
-	vertices.setAttributes(tinybits);
+AttributeBits ModelLoader::loadFastObj(string nameOBJFile, WeldMode weldMode)
+{
+	tinyobj::attrib_t tiny;
+	vector<tinyobj::shape_t> shapes;
+
+	string fullPath = fileSystem.ModelFileFullPath(nameOBJFile);
+	Log(RAW, "Load: model - file: %s  (fast)", fullPath.c_str());
+
+	Clock::time_point start = Clock::now();
+	MappedFile file(fullPath);
+	if (! file.isOpen()) {
+		Log(RAW, "      FAILED! can't open/map file, or it's empty");
+		return 0;
+	}
+	FastObjParser parser;
+	if (! parser.parse(file.data(), file.size(), tiny, shapes)) {
+		Log(RAW, "      FAILED! no vertex data found in %zu bytes", file.size());
+		return 0;
+	}
+	if (parser.numLinesSkipped > 0)
+		Log(RAW, "      skipped %zu malformed lines", parser.numLinesSkipped);
 
-	std::unordered_map<CatchAllVertexType, uint32_t> uniqueVertices = {};
-	int numRedundantVertices = 0;
+	loadMaterials(parser, directoryOf(fullPath), shapes, materialList);
+	loadTimings.parse = secondsSince(start);
+
+	start = Clock::now();
+	AttributeBits attribits = assembleVertices(vertices, indices, tiny, shapes, nameOBJFile, weldMode,
+											   numRedundantVertices, shapeNameList, triangleShapes, triangleMaterials);
+	if (! pSink)
+		vertices.exactResize();		// (else it's soon copied out to the sink and freed anyway)
+	loadTimings.weld = secondsSince(start);
+	return attribits;
+}
 
+// Read the OBJ's 'mtllib' (if any) and point faces' material_ids, which index the parser's materialNames,
+//	at materialList instead.  A material used but not defined (or library missing) gets a default entry.
+//
+static void loadMaterials(FastObjParser& parser, const string& directory, vector<tinyobj::shape_t>& shapes,
+						  vector<ModelMaterial>& materialList)
+{
+	if (! parser.materialLibrary.empty()) {
+		MappedFile file(directory + parser.materialLibrary);
+		if (file.isOpen())
+			parser.parseMaterials(file.data(), file.size(), materialList);
+		else
+			Log(RAW, "      material library '%s' not found", parser.materialLibrary.c_str());
+	}
+	vector<int> materialIDs;
+	for (const string& name : parser.materialNames) {
+		auto pFound = std::find_if(materialList.begin(), materialList.end(),
+								   [&](const ModelMaterial& material) { return material.name == name; });
+		materialIDs.push_back((int) (pFound - materialList.begin()));
+		if (pFound == materialList.end()) {
+			materialList.emplace_back();
+			materialList.back().name = name;
+		}
+	}
+	for (auto& shape : shapes)
+		for (int& materialID : shape.mesh.material_ids)
+			if (materialID >= 0)
+				materialID = materialIDs[materialID];
+}
+
+// Welds and packs vertices as it parses, without tinyobj-style intermediate arrays (see StreamingObjLoader.h).
+//
+AttributeBits ModelLoader::loadStreamedObj(string nameOBJFile, WeldMode weldMode, size_t memoryLimitMB)
+{
+	string fullPath = fileSystem.ModelFileFullPath(nameOBJFile);
+	Log(RAW, "Load: model - file: %s  (streamed)", fullPath.c_str());
+
+	Clock::time_point start = Clock::now();
+	StreamingObjLoader loader(memoryLimitMB * 1024 * 1024);
+	AttributeBits attribits = loader.load(fullPath, weldMode, vertices, indices);
+	loadTimings.parse = secondsSince(start);
+	if (! attribits) {
+		Log(RAW, "      FAILED! " + loader.failure);
+		return 0;
+	}
+	if (loader.numLinesSkipped > 0)
+		Log(RAW, "      skipped %zu malformed lines", loader.numLinesSkipped);
+	Log(RAW, "      peak loading memory: %zu MB", loader.peakMemory / (1024 * 1024));
+	numRedundantVertices = loader.numRedundantVertices;
+	return attribits;
+}
+
+// Converts into our vertex layout whatever loadGlbInPlace() couldn't use as-is (opening the file itself
+//	if called directly).
+//
+AttributeBits ModelLoader::loadGlb(string nameGLBFile)
+{
+	if (! glb.isOpen()) {
+		string fullPath = fileSystem.ModelFileFullPath(nameGLBFile);
+		Log(RAW, "Load: model - file: %s  (glTF binary)", fullPath.c_str());
+		if (! glb.open(fullPath)) {
+			Log(RAW, "      FAILED! " + glb.failure);
+			return 0;
+		}
+	}
+	Clock::time_point start = Clock::now();
+	AttributeBits attribits = glb.repack(vertices, indices, triangleShapes, triangleMaterials);
+	loadTimings.parse = secondsSince(start);
+	if (! attribits) {
+		Log(RAW, "      FAILED! " + glb.failure);
+		vertices.clear();
+		indices.clear();
+		return 0;
+	}
+	if (glb.numPrimitivesSkipped > 0)
+		Log(RAW, "      skipped %zu non-triangle primitives", glb.numPrimitivesSkipped);
+	shapeNameList = glb.shapeNames;
+	glb.readMaterials(materialList);
+	glb.close();
+	numRedundantVertices = 0;
+	return attribits;
+}
+
+// Vertices come already shared by index, so as with glTF there's no welding (nor, in PLY, any submeshes).
+//
+AttributeBits ModelLoader::loadPly(string namePLYFile)
+{
+	string fullPath = fileSystem.ModelFileFullPath(namePLYFile);
+	Log(RAW, "Load: model - file: %s  (binary PLY)", fullPath.c_str());
+
+	Clock::time_point start = Clock::now();
+	PlyLoader loader;
+	AttributeBits attribits = loader.load(fullPath, vertices, indices);
+	loadTimings.parse = secondsSince(start);
+	if (! attribits) {
+		Log(RAW, "      FAILED! " + loader.failure);
+		return 0;
+	}
+	if (loader.numFacesSkipped > 0)
+		Log(RAW, "      skipped %zu faces with bad vertex indices", loader.numFacesSkipped);
+	numRedundantVertices = 0;
+	return attribits;
+}
+
+
+// Check once, up front, that every face corner's indices are in range, so assembly needn't (per corner, per
+//	attribute).  Taken as unsigned, an absent (-1) index is out of range too, so the check is just a running max
+//	of each column: branch-free, which the compiler vectorizes.  Only if some are out of range (rare, and only in
+//	broken files) is there a second pass, redirecting them to a default element appended to that attribute's
+//	array: zeros, or white for colors.  Colors, indexed as positions are, are padded with white to match them.
+//
+static void validateCorners(tinyobj::attrib_t& tiny, vector<tinyobj::shape_t>& shapes, string& nameOBJFile)
+{
+	bool hasNormals = ! tiny.normals.empty(), hasTexCoords = ! tiny.texcoords.empty(), hasColors = ! tiny.colors.empty();
+	if (hasColors && tiny.colors.size() != tiny.vertices.size())
+		tiny.colors.resize(tiny.vertices.size(), 1.0f);
+
+	uint32_t numPositions = (uint32_t) (tiny.vertices.size() / 3),
+			 numNormals	  = (uint32_t) (tiny.normals.size() / 3),
+			 numTexCoords = (uint32_t) (tiny.texcoords.size() / 2);
+	uint32_t maxPosition = 0, maxNormal = 0, maxTexCoord = 0;
 	for (const auto& shape : shapes) {
-		for (const auto& index : shape.mesh.indices) {
-			CatchAllVertexType vertex = {};
-
-			if (! tiny.vertices.empty()) {
-				int iVec3 = 3 * index.vertex_index;
-				if (iVec3 < tiny.vertices.size())
-					vertex.position = { tiny.vertices[iVec3 + 0], tiny.vertices[iVec3 + 1], tiny.vertices[iVec3 + 2] };
-				else if (iVec3 == tiny.vertices.size())
-					Log(ERROR, "TinyObj.vertices exceed %d! Model '%s' truncated.\n", iVec3, nameOBJFile.c_str());
-			} else
-				Log(ERROR, "Model '%s' contains no vertex data (may be corrupt) so won't appear.\n");
-
-			if (! tiny.normals.empty()) {
-				int iVec3 = 3 * index.normal_index;
-				if (iVec3 < tiny.normals.size())
-					vertex.normal = { tiny.normals[iVec3 + 0], tiny.normals[iVec3 + 1], tiny.normals[iVec3 + 2] };
-				else if (iVec3 == tiny.normals.size())
-					Log(ERROR, "TinyObj.normals exceed %d! Model '%s' truncated.\n", iVec3, nameOBJFile.c_str());
-			}
+		const tinyobj::index_t* pCorner = shape.mesh.indices.data();
+		size_t numCorners = shape.mesh.indices.size();
+		for (size_t iCorner = 0; iCorner < numCorners; ++iCorner) {
+			maxPosition = max(maxPosition, (uint32_t) pCorner[iCorner].vertex_index);
+			maxNormal	= max(maxNormal,   (uint32_t) pCorner[iCorner].normal_index);
+			maxTexCoord = max(maxTexCoord, (uint32_t) pCorner[iCorner].texcoord_index);
+		}
+	}
+	bool badPositions = maxPosition >= numPositions,
+		 badNormals	  = hasNormals && maxNormal >= numNormals,
+		 badTexCoords = hasTexCoords && maxTexCoord >= numTexCoords;
+	if (! badPositions && ! badNormals && ! badTexCoords)
+		return;
 
-			if (! tiny.texcoords.empty()) {
-				int iVec2 = 2 * index.texcoord_index;
-				if (iVec2 < tiny.texcoords.size())
-					vertex.texCoord = { tiny.texcoords[iVec2 + 0], tiny.texcoords[iVec2 + 1] };
-				else if (iVec2 == tiny.texcoords.size())
-					Log(ERROR, "TinyObj.texcoords exceed %d! Model '%s' truncated.\n", iVec2, nameOBJFile.c_str());
-			}
+	if (badPositions) {
+		tiny.vertices.insert(tiny.vertices.end(), 3, 0.0f);
+		if (hasColors)
+			tiny.colors.insert(tiny.colors.end(), 3, 1.0f);
+	}
+	if (badNormals)
+		tiny.normals.insert(tiny.normals.end(), 3, 0.0f);
+	if (badTexCoords)
+		tiny.texcoords.insert(tiny.texcoords.end(), 2, 0.0f);
+
+	size_t numBadCorners = 0;	// (not counting absent normals/texcoords, which are legitimately -1)
+	auto redirect = [&](int& index, uint32_t count) {
+		if ((uint32_t) index >= count) {
+			numBadCorners += (index >= 0);
+			index = (int) count;
+		}
+	};
+	for (auto& shape : shapes)
+		for (auto& corner : shape.mesh.indices) {
+			if (badPositions)	redirect(corner.vertex_index,	numPositions);
+			if (badNormals)		redirect(corner.normal_index,	numNormals);
+			if (badTexCoords)	redirect(corner.texcoord_index, numTexCoords);
+		}
+	if (numBadCorners > 0)
+		Log(ERROR, "Model '%s' has %zu face corner indices beyond its vertex data (may be truncated); "
+				   "they default to zero (or white).\n", nameOBJFile.c_str(), numBadCorners);
+}
 
-			if (! tiny.colors.empty()) {	// Keep in mind that while our vertex.color is a 'Vec4', tiny.colors are 'Vec3's!
-				int iVec3 = 3 * index.vertex_index;
-				if (iVec3 < tiny.colors.size())
-					vertex.color = { tiny.colors[iVec3 + 0], tiny.colors[iVec3 + 1], tiny.colors[iVec3 + 2], 1.0f };
-				else {
-					if (iVec3 == tiny.colors.size())
-						Log(ERROR, "TinyObj.color %d exceeded colors array %lu! Rest default to white...\n", iVec3);
-					goto otherwise_white;
+// Assembly of face corners into vertices, generated for each combination of attributes present (positions being
+//	required), so the per-corner loop carries no tests of which are, and writes only those: copying them straight
+//	into a packed vertex laid out as VerticesDynamic stores it.  Welding by value then hashes just those bytes,
+//	and compares them against the vertex buffer itself, rather than against a copy of each whole vertex.
+//
+template<bool HAS_NORMAL, bool HAS_TEXCOORD, bool HAS_COLOR>
+struct CornerAssembler
+{
+	static const size_t NUM_FLOATS = 3 + (HAS_NORMAL ? 3 : 0) + (HAS_TEXCOORD ? 2 : 0) + (HAS_COLOR ? 4 : 0);
+
+	static void pack(const tinyobj::attrib_t& tiny, const tinyobj::index_t& index, float* pPacked)
+	{
+		const float* position = &tiny.vertices[3 * index.vertex_index];
+		*pPacked++ = position[0];  *pPacked++ = position[1];  *pPacked++ = position[2];
+		if constexpr (HAS_NORMAL) {
+			const float* normal = &tiny.normals[3 * index.normal_index];
+			*pPacked++ = normal[0];  *pPacked++ = normal[1];  *pPacked++ = normal[2];
+		}
+		if constexpr (HAS_TEXCOORD) {
+			const float* texCoord = &tiny.texcoords[2 * index.texcoord_index];
+			*pPacked++ = texCoord[0];  *pPacked++ = texCoord[1];
+		}
+		if constexpr (HAS_COLOR) {	// (while our vertex.color is a 'Vec4', tiny.colors are 'Vec3's)
+			const float* color = &tiny.colors[3 * index.vertex_index];
+			*pPacked++ = color[0];  *pPacked++ = color[1];  *pPacked++ = color[2];  *pPacked++ = 1.0f;
+		}
+	}
+
+	static CatchAllVertexType unpack(const float* pPacked)		// (for VerticesDynamic, which packs only these)
+	{
+		CatchAllVertexType vertex;
+		vertex.position = { pPacked[0], pPacked[1], pPacked[2] };
+		pPacked += 3;
+		if constexpr (HAS_NORMAL) {
+			vertex.normal = { pPacked[0], pPacked[1], pPacked[2] };
+			pPacked += 3;
+		}
+		if constexpr (HAS_TEXCOORD) {
+			vertex.texCoord = { pPacked[0], pPacked[1] };
+			pPacked += 2;
+		}
+		if constexpr (HAS_COLOR)
+			vertex.color = { pPacked[0], pPacked[1], pPacked[2], pPacked[3] };
+		return vertex;
+	}
+
+	template<WeldMode WELD_MODE>
+	static void assemble(VerticesDynamic& vertices, vector<uint32_t>& indices, const tinyobj::attrib_t& tiny,
+						 const vector<tinyobj::shape_t>& shapes, size_t expectedUnique, int& numRedundantVertices)
+	{
+		WeldTable<tinyobj::index_t> uniqueCorners(WELD_MODE == WELD_BY_INDEX ? expectedUnique : 0);
+		WeldIndex					uniqueVertices(WELD_MODE == WELD_BY_VALUE ? expectedUnique : 0);
+		float packed[NUM_FLOATS];
+
+		for (const auto& shape : shapes)
+			for (const auto& index : shape.mesh.indices) {
+				bool isNew;
+				uint32_t iVertex;
+
+				if constexpr (WELD_MODE == WELD_BY_INDEX) {
+					iVertex = uniqueCorners.findOrInsert(index, isNew);
+					if (isNew) {
+						pack(tiny, index, packed);
+						vertices.push_back(unpack(packed));
+					}
+				} else {
+					pack(tiny, index, packed);
+					iVertex = uniqueVertices.findOrInsert(Hash64(packed, sizeof(packed)), [&](uint32_t iExisting) {
+						return memcmp((uint8_t*) vertices.pBytes + iExisting * sizeof(packed), packed, sizeof(packed)) == 0;
+					}, isNew);
+					if (isNew)
+						vertices.push_back(unpack(packed));
 				}
-			} else { otherwise_white:
-				vertex.color = { 1.0f, 1.0f, 1.0f, 1.0f };
-			}
+				if (! isNew)
+					++numRedundantVertices;
 
-			if (uniqueVertices.count(vertex) == 0) {
-				uniqueVertices[vertex] = static_cast<uint32_t>(vertices.count());
-				vertices.push_back(vertex);
-			} else {
-				++numRedundantVertices;
+				indices.push_back(iVertex);
 			}
+	}
+
+	static void assemble(WeldMode weldMode, VerticesDynamic& vertices, vector<uint32_t>& indices,
+						 const tinyobj::attrib_t& tiny, const vector<tinyobj::shape_t>& shapes,
+						 size_t expectedUnique, int& numRedundantVertices)
+	{
+		if (weldMode == WELD_BY_INDEX)
+			assemble<WELD_BY_INDEX>(vertices, indices, tiny, shapes, expectedUnique, numRedundantVertices);
+		else
+			assemble<WELD_BY_VALUE>(vertices, indices, tiny, shapes, expectedUnique, numRedundantVertices);
+	}
+};
+
+typedef void (*AssembleCorners)(WeldMode, VerticesDynamic&, vector<uint32_t>&, const tinyobj::attrib_t&,
+								const vector<tinyobj::shape_t>&, size_t, int&);
 
-			indices.push_back(uniqueVertices[vertex]);
+static const AssembleCorners CornerAssemblers[8] = {	// indexed by [hasNormals][hasTexCoords][hasColors]
+	CornerAssembler<false, false, false>::assemble,		CornerAssembler<false, false, true>::assemble,
+	CornerAssembler<false, true,  false>::assemble,		CornerAssembler<false, true,  true>::assemble,
+	CornerAssembler<true,  false, false>::assemble,		CornerAssembler<true,  false, true>::assemble,
+	CornerAssembler<true,  true,  false>::assemble,		CornerAssembler<true,  true,  true>::assemble
+};
+
+// Whichever parser filled the tinyobj-style attribute arrays and per-shape
+//	index lists, dereference each face corner into a vertex, weld
+//	identical ones together, and build the index buffer referencing them.
+// Welding is either by vertex VALUE (all attributes bitwise identical) or by
+//	the corner's INDEX triplet (v/vt/vn) - the latter much cheaper, since only
+//	12 bytes get hashed and duplicates never need their vertex assembled.
+//
+// Also tags each triangle with its shape (same-named shapes being one) and material, for SubmeshBuilder.
+//
+static AttributeBits assembleVertices(VerticesDynamic& vertices, vector<uint32_t>& indices,
+									  tinyobj::attrib_t& tiny, vector<tinyobj::shape_t>& shapes,
+									  string& nameOBJFile, WeldMode weldMode, int& numRedundantVertices,
+									  vector<string>& shapeNames, vector<uint32_t>& triangleShapes,
+									  vector<int32_t>& triangleMaterials)
+{
+	numRedundantVertices = 0;
+	if (tiny.vertices.empty()) {
+		Log(ERROR, "Model '%s' contains no vertex data (may be corrupt) so won't appear.\n", nameOBJFile.c_str());
+		return 0;
+	}
+	validateCorners(tiny, shapes, nameOBJFile);
+
+	// Whatever arrays tinyobj::attrib_t returns (which are non-empty) determines both
+	//	which Vertex Type and shaders to use.  (wait, see related note at end of file)
+	bool hasNormals = ! tiny.normals.empty(), hasTexCoords = ! tiny.texcoords.empty(), hasColors = ! tiny.colors.empty();
+	AttributeBits tinybits = Attribits[POSITION]
+						   | (hasNormals   ? Attribits[NORMAL]	 : 0)
+						   | (hasTexCoords ? Attribits[TEXCOORD] : 0)
+						   | (hasColors	   ? Attribits[COLOR]	 : 0);
+
+	vertices.setAttributes(tinybits);
+
+	size_t numCorners = 0;
+	for (const auto& shape : shapes)
+		numCorners += shape.mesh.indices.size();
+	indices.reserve(numCorners);
+	triangleShapes.reserve(numCorners / 3);
+	triangleMaterials.reserve(numCorners / 3);
+
+	for (const auto& shape : shapes) {
+		auto pFound = std::find(shapeNames.begin(), shapeNames.end(), shape.name);
+		uint32_t shapeID = (uint32_t) (pFound - shapeNames.begin());
+		if (pFound == shapeNames.end())
+			shapeNames.push_back(shape.name);
+		const auto& materialIDs = shape.mesh.material_ids;
+		for (size_t iFace = 0; iFace < shape.mesh.indices.size() / 3; ++iFace) {
+			triangleShapes.push_back(shapeID);
+			triangleMaterials.push_back(iFace < materialIDs.size() ? materialIDs[iFace] : -1);
 		}
 	}
-	vertices.exactResize();
-	Log(RAW, "      done; vertices: %d, redundant vertices culled: %d", vertices.count(), numRedundantVertices);
+
+	size_t expectedUnique = numCorners / 2;		// (typically fewer: a smooth mesh shares each vertex ~6 ways)
+	CornerAssemblers[4 * hasNormals + 2 * hasTexCoords + hasColors](weldMode, vertices, indices, tiny, shapes,
+																	expectedUnique, numRedundantVertices);
 	return tinybits;
 }
 
@@ -154,7 +1330,8 @@ What we don't do ("yet" anyway) is programmatically apply a Vertex Shader to mat
  critical must-have.  The Vertex Shader HAS TO match the format of the Vertex Buffer provided to it.  So:
 TODO: Unless DrawableSpec.shaders is specified, automatically choose/apply Shaders to match the Vertex format.
 	  Obviously if the DrawableSpec *does* supply these, it will override.
-Also, the Model's OBJ file may indicate, specifically name, a texure file.  So:
+Also, the Model's OBJ file may indicate, specifically name, a texure file.  These are now read from its .mtl
+ (see materials(), and each Submesh's materialID) so a renderer can bind each once per batch of submeshes.  But:
 TODO: If the OBJ references a Texture File that DrawableSpec.textures does not, add to that array and open it.
 	  Thus a user can use an OBJ file without having to look inside it in order to specify these things.
 These two additions may become required once users can import and select an OBJ via GUI from the web.
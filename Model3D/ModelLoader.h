@@ -4,6 +4,20 @@
 //
 // Encapsulate loading of a 3D model into a MeshObject, which
 //	describes vertex layout, vertex buffer, and possibly index buffer.
+// May load in the background (loadAsync) on the shared WorkerPool, so
+//	the render loop needn't stall; the mesh must not be used (or this
+//	ModelLoader reused) until the returned future is ready.
+// A whole scene's worth of models may be loaded at once (LoadMany), as many
+//	at a time as there are cores, biggest files first; a file big enough to
+//	be split across cores by its parser is, as cores come free of the rest.
+// May also write the finished vertices and indices straight into memory the
+//	caller provides, such as a mapped staging buffer (see MeshSink).
+// Bounds, and normals or tangents if needed, are computed as part of
+//	loading (see MeshGeometry), so are never left to do per frame.
+// If quantized, the mesh's vertices are packed per quantization() rather
+//	than mesh.vertexType (which still describes them unpacked, as floats).
+// If pickable, a BVH over its triangles (see MeshBVH) is built as it loads,
+//	from cache or not, for rays to be cast against it (e.g. from a tap).
 //
 // Created 9/20/23 by Tadd Jensen
 //	© 0000 (uncopyrighted; use at will)
@@ -14,23 +28,146 @@
 #include "VerticesDynamic.h"
 #include "FileSystem.h"
 #include "MeshObject.h"
+#include "ModelDefSpec.h"
+#include "MeshCache.h"
+#include "MeshOptimizer.h"
+#include "Meshlets.h"
+#include "MeshSimplifier.h"
+#include "Submeshes.h"
+#include "MeshGeometry.h"
+#include "MeshBVH.h"
+#include "GlbLoader.h"
+#include "MeshSink.h"
+#include <future>
+#include <atomic>
+#include <functional>
+
+
+typedef std::function<void(float fraction)>	LoadProgressCallback;	// (called on loading thread)
+
+struct LoadTimings {			// seconds taken by latest load, for benchmarking
+	double	parse	 = 0.0;		// reading the file into attribute arrays (if streamed, welding too;
+							//	if cached and compressed, decoding)
+	double	weld	 = 0.0;		// assembling/welding vertices, building the index buffer
+	double	geometry = 0.0;		// generating normals and tangents, finding bounds (MeshGeometry), quantizing,
+							//	building a picking BVH
+	double	total	 = 0.0;		// everything, including optimizing and caching
+	size_t	fileBytes = 0;		// (of the source file, whether or not loaded from cache)
+	bool	isFromCache = false;	// (MeshCache was up to date, so nothing was parsed)
+};
+
+class ModelLoader;
+
+struct BatchedLoad {			// one model of a LoadMany batch
+	ModelDefSpec	spec;
+	MeshObject*		pMesh;			// (as for load: filled in, and points into its loader)
+	ModelLoader*	pLoader;		// (one per model, kept as long as the mesh is used)
+	MeshSink*		pSink = nullptr;
+	bool			isLoaded = false;	// load's result, and timings of it
+	LoadTimings		timings;
+};
 
 
 class ModelLoader
 {
 	VerticesDynamic	 vertices;
 	vector<uint32_t> indices;
+	vector<uint16_t> smallIndices;	// (indices narrowed, when they fit)
+	vector<uint8_t>	 splitVertices;	// (vertices re-laid-out per chunk, if split)
+	vector<uint8_t>	 decodedVertices;	// (from a compressed MeshCache)
+	vector<MeshChunk> meshChunks;
+	vector<Meshlet>	 meshletList;
+	vector<MeshLOD>	 lodList;
+	vector<uint32_t> lodIndices;		// (all LODs' indices, end to end)
+	vector<uint16_t> smallLodIndices;
+	const void*		 pLODIndices = nullptr;	// (whichever of above, or into cache)
+	vector<Submesh>	 submeshList;
+	vector<ModelMaterial> materialList;
+	vector<string>	 shapeNameList;
+	MeshBounds		 meshBounds = { };
+	MeshBVH			 meshBVH;
+	vector<VertexTangent> tangentList;
+	const VertexTangent* pTangents = nullptr;	// (tangentList's, or into cache)
+	vector<uint8_t>	 quantizedVertices;
+	QuantizedVertexFormat quantizedFormat;
+	const QuantizedVertexFormat* pQuantization = nullptr;	// (&quantizedFormat, or into cache)
+	vector<uint32_t> triangleShapes;	// (per triangle as parsed, until submeshes are built)
+	vector<int32_t>	 triangleMaterials;
+	MeshIndexType	 meshIndexType = MESH_LARGE_INDEX;
+	AttributeBits	 meshAttributes = 0;
 
 	FileSystem		 fileSystem;
+	MeshCache		 meshCache;		// (keeps cache file mapped while mesh points into it)
+	GlbLoader		 glb;			// (likewise a .glb loaded in place)
+	MeshSink*		 pSink = nullptr;	// (during load, if caller gave one)
+
+	int				 numRedundantVertices = 0;
+	LoadTimings		 loadTimings;
+
+	std::shared_future<bool> pendingLoad;
+	std::atomic<float>	 loadProgress { 0.0f };
+	LoadProgressCallback progressCallback;
+
+	bool loadCached(MeshObject& mesh, ModelDefSpec& modelSpec);
+	void setMesh(MeshObject& mesh, AttributeBits attribits, bool isSplit, bool isToSink,
+				 const QuantizationBudget* pBudget = nullptr);
+	bool deliver(MeshObject& mesh, uint32_t vertexStride);
+	void releaseMeshData();
+	void optimize(AttributeBits attribits, bool isClustered, VertexCacheStats& before, VertexCacheStats& after);
+	void weldWithinTolerance(AttributeBits attribits, const WeldTolerance& tolerance);
+	AttributeBits addNormals(AttributeBits attribits, NormalGeneration weighting);
+	void buildTangents(AttributeBits attribits, bool isSplit);
+	void buildBVH(MeshObject& mesh);
+	void buildSubmeshes(AttributeBits attribits);
+	vector<Submesh> submeshRanges();
+	void buildMeshlets(AttributeBits attribits);
+	uint32_t numMeshletVertices();
+	void buildLODs(AttributeBits attribits, int lodCount);
+	void reportProgress(float fraction);
+	bool loadGlbInPlace(MeshObject& mesh, ModelDefSpec& modelSpec);
 
 public:
-	void load(MeshObject& mesh, string nameOBJFile);
-	MeshIndexType indexType();
+	~ModelLoader();
+
+	bool load(MeshObject& mesh, string nameOBJFile);	// (uses default loader for OBJ_FILE)
+	bool load(MeshObject& mesh, ModelDefSpec modelSpec, MeshSink* pMeshSink = nullptr);
+	std::shared_future<bool> loadAsync(MeshObject& mesh, ModelDefSpec modelSpec,
+									   LoadProgressCallback onProgress = nullptr, MeshSink* pMeshSink = nullptr);
+	static bool LoadMany(vector<BatchedLoad>& batch, LoadProgressCallback onProgress = nullptr);	// (all loaded OK?)
+	float progress()	{ return loadProgress; }	// 0 to 1, of latest load
+	const LoadTimings& timings()		{ return loadTimings; }
+	int redundantVertices()				{ return numRedundantVertices; }	// (culled by welding)
+	MeshIndexType indexType();					// (also set in mesh.indexType by load)
+	AttributeBits attributes()			{ return meshAttributes; }	// (as mesh.vertexType was initialized with)
+	const vector<MeshChunk>& chunks()	{ return meshChunks; }	// (empty unless mesh was split)
+	const vector<Meshlet>& meshlets()	{ return meshletList; }	// (empty unless clustered; if also split,
+																//	meshlet's chunk holds its firstIndex)
+	const vector<MeshLOD>& lods()		{ return lodList; }		// (empty unless requested; index
+	const void* lodIndexData()			{ return pLODIndices; }	//	type matches indexType()
+	const vector<Submesh>& submeshes()	{ return submeshList; }	// (at least one; sorted by material;
+	const vector<ModelMaterial>& materials() { return materialList; }	//	if split, may span chunks)
+	const vector<string>& shapeNames()	{ return shapeNameList; }
+	const MeshBounds& bounds()			{ return meshBounds; }		// (of whole mesh)
+	const MeshBVH& bvh()				{ return meshBVH; }			// (unbuilt unless pickable)
+	const VertexTangent* tangents()		{ return pTangents; }		// (one per mesh vertex; null unless
+																	//	requested, and not if split)
+	const QuantizedVertexFormat* quantization()	{ return pQuantization; }	// (null unless quantized)
+	uint32_t vertexStride();			// (of mesh.vertices as loaded: quantized, or VertexStride(attributes()))
+
+	static uint32_t VertexStride(AttributeBits attribits);
+
+	// LOADER-IMPLEMENTATION-SPECIFIC (currently supported: tiny_obj_loader, our FastObjParser, StreamingObjLoader,
+	//								   GlbLoader, PlyLoader)
+
+	AttributeBits loadTinyObj(string nameOBJFile, WeldMode weldMode = WELD_BY_VALUE);
+
+	AttributeBits loadFastObj(string nameOBJFile, WeldMode weldMode = WELD_BY_VALUE);
+
+	AttributeBits loadStreamedObj(string nameOBJFile, WeldMode weldMode = WELD_BY_VALUE, size_t memoryLimitMB = 0);
 
-	// LOADER-IMPLEMENTATION-SPECIFIC (currently only supported: tiny_obj_loader)
+	AttributeBits loadGlb(string nameGLBFile);		// (repacked; see loadGlbInPlace for the zero-copy route)
 
-	AttributeBits loadTinyObj(string nameOBJFile);
-	MeshIndexType indexTypeTinyObj();
+	AttributeBits loadPly(string namePLYFile);
 };
 
 #endif	// ModelLoader_h
@@ -0,0 +1,154 @@
+//
+// ObjTextParsing.h
+//	Vulkan Convenience 3D Objects
+//
+// Low-level pieces of Wavefront OBJ text parsing shared by our OBJ loaders
+//	(FastObjParser, StreamingObjLoader): whitespace/line stepping and number
+//	parsing that's bounded by an 'end' pointer rather than a terminating null,
+//	since text is parsed in place, from a mapped file or a read buffer.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef ObjTextParsing_h
+#define ObjTextParsing_h
+
+#include <cstdint>
+#include <cstring>		// for memchr
+#include <limits>
+#include <algorithm>
+#include <string>
+
+
+// NUMBER PARSING - locale-free, bounded by 'end' (mapped text isn't null-terminated)
+
+static inline bool isDigit(char c)		{ return (unsigned) (c - '0') < 10; }
+static inline bool isBlank(char c)		{ return c == ' ' || c == '\t'; }
+static inline bool isEndOfLine(char c)	{ return c == '\n' || c == '\r' || c == '#'; }
+
+static inline void skipBlanks(const char*& p, const char* end) {
+	while (p < end && isBlank(*p))
+		++p;
+}
+
+static inline const char* nextLine(const char* p, const char* end) {
+	const char* pNewline = (const char*) memchr(p, '\n', end - p);
+	return pNewline ? pNewline + 1 : end;
+}
+
+// A name or filename argument: everything to end of line (or comment), less surrounding blanks.
+//
+static inline std::string restOfLine(const char* p, const char* end) {
+	skipBlanks(p, end);
+	const char* pEnd = p;
+	while (pEnd < end && ! isEndOfLine(*pEnd))
+		++pEnd;
+	while (pEnd > p && isBlank(pEnd[-1]))
+		--pEnd;
+	return std::string(p, pEnd);
+}
+
+// True if line at p starts with 'keyword' followed by a blank, in which case p is advanced past it.
+//
+static inline bool isKeyword(const char*& p, const char* end, const char* keyword, size_t length) {
+	if ((size_t) (end - p) <= length || memcmp(p, keyword, length) != 0 || ! isBlank(p[length]))
+		return false;
+	p += length + 1;
+	return true;
+}
+
+static const double PowersOf10[] = {
+	1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Accumulate up to 19 significant digits exactly into an integer, then apply the decimal exponent
+//	once, using exactly-representable powers of ten.  Plenty precise for 32-bit float results.
+//
+static inline bool parseFloat(const char*& p, const char* end, float& value)
+{
+	skipBlanks(p, end);
+
+	bool isNegative = false;
+	if (p < end && (*p == '-' || *p == '+'))
+		isNegative = (*p++ == '-');
+
+	uint64_t mantissa = 0;
+	int exponent = 0, numSignificant = 0;
+	const char* pDigits = p;
+
+	for ( ; p < end && isDigit(*p); ++p)
+		if (numSignificant < 19) {
+			mantissa = mantissa * 10 + (*p - '0');
+			if (mantissa) ++numSignificant;
+		} else
+			++exponent;
+
+	if (p < end && *p == '.')
+		for (++p; p < end && isDigit(*p); ++p)
+			if (numSignificant < 19) {
+				mantissa = mantissa * 10 + (*p - '0');
+				if (mantissa) ++numSignificant;
+				--exponent;
+			}
+
+	if (p == pDigits || (p == pDigits + 1 && *pDigits == '.'))
+		return false;		// no digits at all
+
+	if (p < end && (*p == 'e' || *p == 'E')) {
+		const char* pExponent = ++p;
+		bool isNegativeExp = false;
+		if (p < end && (*p == '-' || *p == '+'))
+			isNegativeExp = (*p++ == '-');
+		int exp = 0;
+		for ( ; p < end && isDigit(*p); ++p)
+			if (exp < 1000) exp = exp * 10 + (*p - '0');
+		if (p == pExponent || ! isDigit(p[-1]))
+			return false;
+		exponent += isNegativeExp ? -exp : exp;
+	}
+
+	double result = (double) mantissa;
+	if (mantissa != 0) {
+		if (exponent < -350 || exponent > 350)
+			result = (exponent < 0) ? 0.0 : std::numeric_limits<double>::infinity();
+		else if (exponent < 0) {
+			for ( ; exponent < -22; exponent += 22)
+				result /= 1e22;
+			result /= PowersOf10[-exponent];
+		} else {
+			for ( ; exponent > 22; exponent -= 22)
+				result *= 1e22;
+			result *= PowersOf10[exponent];
+		}
+	}
+	value = (float) (isNegative ? -result : result);
+	return true;
+}
+
+static inline bool parseInt(const char*& p, const char* end, int& value)
+{
+	bool isNegative = false;
+	if (p < end && (*p == '-' || *p == '+'))
+		isNegative = (*p++ == '-');
+	const char* pDigits = p;
+	int64_t result = 0;
+	for ( ; p < end && isDigit(*p); ++p)
+		if (result < INT32_MAX) result = result * 10 + (*p - '0');
+	if (p == pDigits)
+		return false;
+	value = (int) (isNegative ? -result : std::min<int64_t>(result, INT32_MAX));
+	return true;
+}
+
+// OBJ indices are 1-based, or if negative, relative to the number of elements defined so far.
+//	Zero is invalid, as is anything resolving outside of the file; these map to -1, same as
+//	tinyobj's "not specified" that downstream assembly already treats as absent.
+//
+static inline int resolveIndex(int index, size_t numSoFar)
+{
+	int64_t resolved = (index > 0) ? (int64_t) index - 1 : (int64_t) numSoFar + index;
+	return (index == 0 || resolved < 0) ? -1 : (int) resolved;
+}
+
+#endif	// ObjTextParsing_h
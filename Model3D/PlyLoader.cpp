@@ -0,0 +1,422 @@
+//
+// PlyLoader.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "PlyLoader.h"
+#include "Vertex3DTypes.h"
+#include "MappedFile.h"
+#include "WorkerPool.h"
+#include <sstream>
+#include <atomic>
+
+
+enum PlyType { PLY_NONE, PLY_INT8, PLY_UINT8, PLY_INT16, PLY_UINT16, PLY_INT32, PLY_UINT32, PLY_FLOAT32, PLY_FLOAT64 };
+
+struct PlyProperty {
+	string	name;
+	PlyType	type	  = PLY_NONE;	// (of list's items, if a list)
+	PlyType	countType = PLY_NONE;	// (list only)
+	size_t	offset	  = 0;			// within record, if the element is fixed-size
+};
+
+struct PlyElement {
+	string				name;
+	size_t				count	  = 0;
+	vector<PlyProperty>	properties;
+	size_t				fixedSize = 0;	// bytes per record, or 0 if any property is a list
+};
+
+struct PlyField {				// where one vertex property goes in our vertex
+	int		attribute;
+	int		component;
+	const PlyProperty* pProperty;
+};
+
+struct FaceChunk {
+	const uint8_t*	pFirst;		// first face's record
+	size_t			numFaces;
+	size_t			firstIndex;	// (into output indices)
+};
+
+typedef Vertex3DNormalTextureColor	CatchAllVertexType;
+
+
+static PlyType typeNamed(const string& name)
+{
+	if (name == "char"	 || name == "int8")		return PLY_INT8;
+	if (name == "uchar"	 || name == "uint8")	return PLY_UINT8;
+	if (name == "short"	 || name == "int16")	return PLY_INT16;
+	if (name == "ushort" || name == "uint16")	return PLY_UINT16;
+	if (name == "int"	 || name == "int32")	return PLY_INT32;
+	if (name == "uint"	 || name == "uint32")	return PLY_UINT32;
+	if (name == "float"	 || name == "float32")	return PLY_FLOAT32;
+	if (name == "double" || name == "float64")	return PLY_FLOAT64;
+	return PLY_NONE;
+}
+
+static size_t sizeOf(PlyType type)
+{
+	static const size_t Sizes[] = { 0, 1, 1, 2, 2, 4, 4, 4, 8 };
+	return Sizes[type];
+}
+
+// Unaligned load, byte order reversed if the file's differs from ours (which compilers turn into bswap).
+//
+template<typename T>
+static inline T load(const uint8_t* p, bool isSwapped)
+{
+	T value;
+	if (isSwapped) {
+		uint8_t reversed[sizeof(T)];
+		for (size_t i = 0; i < sizeof(T); ++i)
+			reversed[i] = p[sizeof(T) - 1 - i];
+		memcpy(&value, reversed, sizeof(T));
+	} else
+		memcpy(&value, p, sizeof(T));
+	return value;
+}
+
+static inline double readScalar(const uint8_t* p, PlyType type, bool isSwapped)
+{
+	switch (type) {
+		case PLY_INT8:		return (int8_t) *p;
+		case PLY_UINT8:		return *p;
+		case PLY_INT16:		return load<int16_t>(p, isSwapped);
+		case PLY_UINT16:	return load<uint16_t>(p, isSwapped);
+		case PLY_INT32:		return load<int32_t>(p, isSwapped);
+		case PLY_UINT32:	return load<uint32_t>(p, isSwapped);
+		case PLY_FLOAT32:	return load<float>(p, isSwapped);
+		case PLY_FLOAT64:	return load<double>(p, isSwapped);
+		default:			return 0.0;
+	}
+}
+
+static inline int64_t readInteger(const uint8_t* p, PlyType type, bool isSwapped)
+{
+	switch (type) {
+		case PLY_INT8:		return (int8_t) *p;
+		case PLY_UINT8:		return *p;
+		case PLY_INT16:		return load<int16_t>(p, isSwapped);
+		case PLY_UINT16:	return load<uint16_t>(p, isSwapped);
+		case PLY_INT32:		return load<int32_t>(p, isSwapped);
+		case PLY_UINT32:	return load<uint32_t>(p, isSwapped);
+		default:			return (int64_t) readScalar(p, type, isSwapped);
+	}
+}
+
+static float normalizedColor(double value, PlyType type)
+{
+	switch (type) {
+		case PLY_UINT8:		return (float) (value / 255.0);
+		case PLY_UINT16:	return (float) (value / 65535.0);
+		default:			return (float) value;
+	}
+}
+
+static bool isLittleEndianHost()
+{
+	uint16_t probe = 1;
+	return *(uint8_t*) &probe == 1;
+}
+
+// Step over one record, bounds-checked (nullptr if it runs past end), noting one list's count if asked.
+//
+static const uint8_t* skipRecord(const uint8_t* p, const uint8_t* end, const PlyElement& element, bool isSwapped,
+								 const PlyProperty* pCountedList = nullptr, int64_t* pCount = nullptr)
+{
+	if (element.fixedSize > 0)
+		return ((size_t) (end - p) >= element.fixedSize) ? p + element.fixedSize : nullptr;
+	for (const PlyProperty& property : element.properties) {
+		size_t size = sizeOf(property.type);
+		if (property.countType != PLY_NONE) {
+			size_t countSize = sizeOf(property.countType);
+			if ((size_t) (end - p) < countSize)
+				return nullptr;
+			int64_t count = readInteger(p, property.countType, isSwapped);
+			if (count < 0 || (uint64_t) count > (size_t) (end - p - countSize) / size)
+				return nullptr;
+			if (&property == pCountedList)
+				*pCount = count;
+			p += countSize + count * size;
+		} else {
+			if ((size_t) (end - p) < size)
+				return nullptr;
+			p += size;
+		}
+	}
+	return p;
+}
+
+
+static bool parseHeader(const char* pText, const char* end, vector<PlyElement>& elements, bool& isBigEndian,
+						const char*& pData, string& failure)
+{
+	const char* pEndHeader = nullptr;
+	for (const char* p = pText; p + 10 <= end && ! pEndHeader; ++p)
+		if (*p == '\n' && memcmp(p + 1, "end_header", 10) == 0)
+			pEndHeader = p + 11;
+	if (! pEndHeader || memcmp(pText, "ply", 3) != 0) {
+		failure = "not a PLY file";
+		return false;
+	}
+	while (pEndHeader < end && *pEndHeader != '\n')
+		++pEndHeader;
+	pData = pEndHeader + 1;		// (past "end_header\n", or "\r\n")
+
+	std::istringstream header(string(pText, pEndHeader));
+	string line, keyword;
+	bool hasFormat = false;
+	while (std::getline(header, line)) {
+		std::istringstream words(line);
+		words >> keyword;
+		if (keyword == "format") {
+			string format;
+			words >> format;
+			if (format == "ascii") {
+				failure = "ASCII PLY not supported";
+				return false;
+			}
+			isBigEndian = (format == "binary_big_endian");
+			hasFormat = isBigEndian || format == "binary_little_endian";
+		} else if (keyword == "element") {
+			elements.emplace_back();
+			words >> elements.back().name >> elements.back().count;
+		} else if (keyword == "property" && ! elements.empty()) {
+			PlyProperty property;
+			string typeName, countTypeName, itemTypeName;
+			words >> typeName;
+			if (typeName == "list") {
+				words >> countTypeName >> itemTypeName;
+				property.countType = typeNamed(countTypeName);
+				property.type	   = typeNamed(itemTypeName);
+				if (property.countType == PLY_NONE)
+					property.type = PLY_NONE;
+			} else
+				property.type = typeNamed(typeName);
+			words >> property.name;
+			if (property.type == PLY_NONE) {
+				failure = "unknown type in: " + line;
+				return false;
+			}
+			elements.back().properties.push_back(property);
+		}
+	}
+	if (! hasFormat) {
+		failure = "no recognized format line";
+		return false;
+	}
+	for (PlyElement& element : elements) {
+		for (PlyProperty& property : element.properties) {
+			property.offset = element.fixedSize;
+			element.fixedSize += sizeOf(property.type);
+		}
+		for (PlyProperty& property : element.properties)
+			if (property.countType != PLY_NONE)
+				element.fixedSize = 0;
+	}
+	return true;
+}
+
+// Which vertex properties we use, and where each goes.  Position required; other attributes only if complete.
+//
+static AttributeBits mapVertexFields(const PlyElement& element, vector<PlyField>& fields)
+{
+	static const struct { int attribute; int numComponents; const char* names[3][4]; } Attributes[] = {
+		{ POSITION,	3, { { "x", "y", "z" } } },
+		{ NORMAL,	3, { { "nx", "ny", "nz" } } },
+		{ TEXCOORD,	2, { { "u", "v" }, { "s", "t" }, { "texture_u", "texture_v" } } },
+		{ COLOR,	4, { { "red", "green", "blue", "alpha" } } },
+	};
+	AttributeBits attribits = 0;
+	for (const auto& attribute : Attributes)
+		for (const auto& names : attribute.names) {
+			vector<PlyField> found;
+			for (int component = 0; component < attribute.numComponents && names[0]; ++component)
+				for (const PlyProperty& property : element.properties)
+					if (names[component] && property.name == names[component] && property.countType == PLY_NONE)
+						found.push_back({ attribute.attribute, component, &property });
+			int numRequired = (attribute.attribute == COLOR) ? 3 : attribute.numComponents;	// (alpha optional)
+			if (names[0] && (int) found.size() >= numRequired) {
+				fields.insert(fields.end(), found.begin(), found.end());
+				attribits |= Attribits[attribute.attribute];
+				break;
+			}
+		}
+	return (attribits & Attribits[POSITION]) ? attribits : 0;
+}
+
+static void extractVertex(const uint8_t* pRecord, const vector<PlyField>& fields, bool isSwapped,
+						  CatchAllVertexType& vertex)
+{
+	memset((void*) &vertex, 0, sizeof(vertex));
+	vertex.color = { 1.0f, 1.0f, 1.0f, 1.0f };
+	float* destinations[NUM_ATTRIBUTES] = { &vertex.position.x, &vertex.normal.x, &vertex.texCoord.x, &vertex.color.x };
+	for (const PlyField& field : fields) {
+		double value = readScalar(pRecord + field.pProperty->offset, field.pProperty->type, isSwapped);
+		destinations[field.attribute][field.component] = (field.attribute == COLOR)
+													   ? normalizedColor(value, field.pProperty->type) : (float) value;
+	}
+}
+
+
+AttributeBits PlyLoader::load(const string& fullPath, VerticesDynamic& vertices, vector<uint32_t>& indices)
+{
+	MappedFile file(fullPath);
+	if (! file.isOpen()) {
+		failure = "can't open/map file, or it's empty";
+		return 0;
+	}
+	vector<PlyElement> elements;
+	bool isBigEndian = false;
+	const char* pData;
+	if (! parseHeader(file.data(), file.end(), elements, isBigEndian, pData, failure))
+		return 0;
+	bool isSwapped = (isBigEndian == isLittleEndianHost());
+
+	// Locate the vertex and face elements' records, stepping over any others.
+	const uint8_t* p   = (const uint8_t*) pData;
+	const uint8_t* end = (const uint8_t*) file.end();
+	const PlyElement* pVertexElement = nullptr;
+	const PlyElement* pFaceElement	 = nullptr;
+	const uint8_t* pVertexRecords = nullptr;
+	vector<FaceChunk> chunks;
+	size_t numIndices = 0;
+	for (const PlyElement& element : elements) {
+		if (element.name == "vertex" && ! pVertexElement) {
+			if (element.fixedSize == 0 || element.count > UINT32_MAX) {
+				failure = "vertex element has list properties, or too many vertices";
+				return 0;
+			}
+			pVertexElement = &element;
+			pVertexRecords = p;
+		}
+		const PlyProperty* pIndexList = nullptr;
+		if (element.name == "face" && ! pFaceElement)
+			for (const PlyProperty& property : element.properties)
+				if (property.countType != PLY_NONE && (property.name == "vertex_indices" || property.name == "vertex_index"))
+					pIndexList = &property;
+		if (pIndexList)
+			pFaceElement = &element;
+		if (element.fixedSize > 0 && ! pIndexList) {
+			if (element.count > (size_t) (end - p) / element.fixedSize) {
+				failure = "file truncated in element " + element.name;
+				return 0;
+			}
+			p += element.count * element.fixedSize;
+			continue;
+		}
+		// The one sequential pass over faces: just corner counts, noting each chunk's start.
+		for (size_t iRecord = 0; iRecord < element.count; ++iRecord) {
+			if (pIndexList && iRecord % FACES_PER_CHUNK == 0)
+				chunks.push_back({ p, min(size_t(FACES_PER_CHUNK), element.count - iRecord), numIndices });
+			int64_t numCorners = 0;
+			p = skipRecord(p, end, element, isSwapped, pIndexList, &numCorners);
+			if (! p) {
+				failure = "file truncated in element " + element.name;
+				return 0;
+			}
+			if (numCorners >= 3)
+				numIndices += 3 * (numCorners - 2);
+		}
+	}
+
+	vector<PlyField> fields;
+	AttributeBits attribits = pVertexElement ? mapVertexFields(*pVertexElement, fields) : 0;
+	if (! attribits || ! pFaceElement || numIndices == 0) {
+		failure = ! attribits ? "no vertex positions" : "no faces";
+		return 0;
+	}
+
+	WorkerPool& pool = WorkerPool::Shared();
+
+	// Vertices, extracted in parallel a batch at a time, then appended in order.
+	size_t vertexCount = pVertexElement->count;
+	size_t stride	   = pVertexElement->fixedSize;
+	vertices.setAttributes(attribits);
+	vector<CatchAllVertexType> batch(min(vertexCount, size_t(VERTICES_PER_BATCH)));
+	const size_t VERTICES_PER_TASK = 4096;
+	for (size_t iFirst = 0; iFirst < vertexCount; iFirst += batch.size()) {
+		size_t numInBatch = min(batch.size(), vertexCount - iFirst);
+		pool.parallelFor((numInBatch + VERTICES_PER_TASK - 1) / VERTICES_PER_TASK, [&](size_t iTask) {
+			size_t iEnd = min(numInBatch, (iTask + 1) * VERTICES_PER_TASK);
+			for (size_t i = iTask * VERTICES_PER_TASK; i < iEnd; ++i)
+				extractVertex(pVertexRecords + (iFirst + i) * stride, fields, isSwapped, batch[i]);
+		});
+		for (size_t i = 0; i < numInBatch; ++i)
+			vertices.push_back(batch[i]);
+	}
+	vector<CatchAllVertexType>().swap(batch);
+	vertices.exactResize();
+
+	// Faces, each chunk fan-triangulating into its own range of indices.  A bad face's triangles are
+	//	marked (rather than left out, which would shift everything after) and squeezed out afterward.
+	const uint32_t BAD_INDEX = UINT32_MAX;
+	indices.resize(numIndices);
+	std::atomic<size_t> numBadFaces { 0 };
+	numChunks = chunks.size();
+	pool.parallelFor(chunks.size(), [&](size_t iChunk) {
+		const FaceChunk& chunk = chunks[iChunk];
+		const uint8_t* pRecord = chunk.pFirst;
+		uint32_t* pOut = &indices[chunk.firstIndex];
+		size_t numBad = 0;
+		for (size_t iFace = 0; iFace < chunk.numFaces; ++iFace) {
+			const uint8_t* pNext = skipRecord(pRecord, end, *pFaceElement, isSwapped);
+			const uint8_t* pList = pRecord;
+			for (const PlyProperty& property : pFaceElement->properties) {
+				size_t countSize = sizeOf(property.countType);
+				int64_t count = (countSize > 0) ? readInteger(pList, property.countType, isSwapped) : 1;
+				if (property.name != "vertex_indices" && property.name != "vertex_index") {
+					pList += countSize + count * sizeOf(property.type);
+					continue;
+				}
+				const uint8_t* pItems = pList + countSize;
+				size_t itemSize = sizeOf(property.type);
+				bool isBad = (count < 3);
+				uint32_t first = 0, previous = 0;
+				for (int64_t iCorner = 0; iCorner < count; ++iCorner) {
+					int64_t index = readInteger(pItems + iCorner * itemSize, property.type, isSwapped);
+					isBad |= (index < 0 || (uint64_t) index >= vertexCount);
+					uint32_t corner = (uint32_t) index;
+					if (iCorner == 0)
+						first = corner;
+					else if (iCorner >= 2) {
+						pOut[0] = first;
+						pOut[1] = previous;
+						pOut[2] = corner;
+						pOut += 3;
+					}
+					previous = corner;
+				}
+				if (isBad) {
+					++numBad;
+					if (count >= 3)
+						std::fill(pOut - 3 * (count - 2), pOut, BAD_INDEX);
+				}
+				break;
+			}
+			pRecord = pNext;
+		}
+		numBadFaces += numBad;
+	});
+	numFacesSkipped = numBadFaces;
+	if (numFacesSkipped > 0) {
+		size_t iOut = 0;
+		for (size_t i = 0; i < indices.size(); i += 3)
+			if (indices[i] != BAD_INDEX)
+				for (int corner = 0; corner < 3; ++corner)
+					indices[iOut++] = indices[i + corner];
+		indices.resize(iOut);
+		indices.shrink_to_fit();
+	}
+	if (indices.empty()) {
+		failure = "no valid faces";
+		vertices.clear();
+		return 0;
+	}
+	return attribits;
+}
@@ -0,0 +1,47 @@
+//
+// PlyLoader.h
+//	Vulkan Convenience 3D Objects
+//
+// Binary PLY loading (see SpecType PLY_BINARY), as scanners and photogrammetry
+//	tools write: far smaller than the same mesh as OBJ text, and nothing to
+//	parse but the header.  The file is memory-mapped; either endianness is
+//	read, big-endian byte-swapped as each value is extracted.
+// Vertex properties x/y/z, nx/ny/nz, u/v (or s/t, texture_u/texture_v) and
+//	red/green/blue/alpha (integer types normalized) become the same
+//	AttributeBits-driven VerticesDynamic layout the OBJ loaders produce, only
+//	the attributes present; any other properties are ignored.  Vertices are
+//	extracted across the shared WorkerPool a batch at a time, then appended.
+//	PLY vertices are already shared by index, so there's no welding.
+// Faces (list property vertex_indices, or vertex_index) are fan-triangulated
+//	across the WorkerPool too.  Records being variable-length, one quick
+//	sequential pass reads only each face's corner count, noting where each
+//	chunk of faces begins and how many triangles precede it; each chunk then
+//	writes its indices directly into place.  Faces with a corner out of range
+//	(or fewer than three) are dropped.  Other elements (edges etc.) are skipped.
+//	ASCII PLY isn't supported.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef PlyLoader_h
+#define PlyLoader_h
+
+#include "VerticesDynamic.h"
+
+
+class PlyLoader
+{
+public:
+	// Fills vertices/indices, returning the attributes the vertices have, or 0 if nothing loaded
+	//	(file unreadable, not binary PLY, or without vertex positions or faces; see 'failure').
+	AttributeBits load(const string& fullPath, VerticesDynamic& vertices, vector<uint32_t>& indices);
+
+	size_t	numFacesSkipped	= 0;
+	size_t	numChunks		= 0;	// (informational) degree of parallelism used for faces
+	string	failure;
+
+	static const size_t FACES_PER_CHUNK	   = 64 * 1024;
+	static const size_t VERTICES_PER_BATCH = 256 * 1024;	// (bounds the extracted-but-unappended copy)
+};
+
+#endif	// PlyLoader_h
@@ -0,0 +1,574 @@
+//
+// PngDecoder.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "PngDecoder.h"
+#include "VulkanPlatform.h"		// for Log, std::vector etc.
+#include <cstring>
+#include <cstdlib>
+
+
+// INFLATE (zlib, RFC 1950/1951)
+
+static const int FAST_BITS = 10;		// codes this short decode with one table lookup
+
+struct HuffmanTable {
+	uint16_t	fast[1 << FAST_BITS];	// (symbol << 4 | code length), by the code's next bits; 0 if longer
+	uint32_t	maxCode[17];			// per length: one past its last code, left-justified in 16 bits
+	uint16_t	firstCode[16];
+	uint16_t	firstSymbol[16];		// (index into symbols)
+	uint16_t	symbols[288];			// sorted by code
+
+	bool build(const uint8_t* lengths, int count);
+};
+
+static uint32_t reverseBits(uint32_t bits, int length)
+{
+	uint32_t reversed = 0;
+	for (int i = 0; i < length; ++i, bits >>= 1)
+		reversed = (reversed << 1) | (bits & 1);
+	return reversed;
+}
+
+// Canonical codes, as deflate defines them: shorter codes first, and in order of symbol within a length.
+//	False if there are more codes than lengths allow (incomplete sets are legal, e.g. a single distance).
+//
+bool HuffmanTable::build(const uint8_t* lengths, int count)
+{
+	int numOfLength[16] = { };
+	for (int symbol = 0; symbol < count; ++symbol)
+		++numOfLength[lengths[symbol]];
+	numOfLength[0] = 0;
+
+	int nextCode[16], nextSymbol[16];
+	int code = 0, iSymbol = 0;
+	for (int length = 1; length < 16; ++length) {
+		nextCode[length]	= firstCode[length]	  = code;
+		nextSymbol[length]	= firstSymbol[length] = iSymbol;
+		code += numOfLength[length];
+		if (code > (1 << length))
+			return false;
+		maxCode[length] = code << (16 - length);
+		code <<= 1;
+		iSymbol += numOfLength[length];
+	}
+	maxCode[16] = 0x10000;		// (sentinel)
+
+	memset(fast, 0, sizeof(fast));
+	for (int symbol = 0; symbol < count; ++symbol) {
+		int length = lengths[symbol];
+		if (length == 0)
+			continue;
+		int symbolCode = nextCode[length]++;
+		symbols[nextSymbol[length]++] = symbol;
+		if (length <= FAST_BITS)	// (bits arrive least-significant first, so the table is indexed by them reversed)
+			for (uint32_t index = reverseBits(symbolCode, length); index < (1 << FAST_BITS); index += 1 << length)
+				fast[index] = (uint16_t) (symbol << 4 | length);
+	}
+	return true;
+}
+
+struct BitReader {
+	const uint8_t*	p;
+	const uint8_t*	pEnd;
+	uint64_t		bits	   = 0;
+	int				numBits	   = 0;
+	size_t			numPadding = 0;		// zero bytes fed in past the end
+
+	BitReader(const uint8_t* pBegin, const uint8_t* pFinish) : p(pBegin), pEnd(pFinish)	{ }
+
+	void refill() {
+		if (pEnd - p >= 8) {
+			uint64_t word;
+			memcpy(&word, p, sizeof(word));		// (little-endian, as are all our platforms)
+			bits |= word << numBits;
+			p += (63 - numBits) >> 3;
+			numBits |= 56;
+		} else
+			while (numBits <= 56) {
+				uint64_t byte = (p < pEnd) ? *p++ : (++numPadding, 0);
+				bits |= byte << numBits;
+				numBits += 8;
+			}
+	}
+	uint32_t take(int count) {		// (up to 32 bits)
+		if (numBits < count)
+			refill();
+		uint32_t value = (uint32_t) (bits & ((1ull << count) - 1));
+		bits >>= count;
+		numBits -= count;
+		return value;
+	}
+	bool isOverrun()	{ return numPadding * 8 > (size_t) numBits; }	// (read into the padding)
+
+	void alignToByte()	{ take(numBits & 7); }
+	bool rewind() {			// (give back whole bytes buffered, so p is where reading left off)
+		size_t numBytes = numBits / 8;
+		if (numBytes < numPadding)
+			return false;
+		p -= numBytes - numPadding;
+		bits = 0;
+		numBits = 0;
+		numPadding = 0;
+		return true;
+	}
+};
+
+static int decodeSymbol(BitReader& in, const HuffmanTable& table)
+{
+	if (in.numBits < 16)
+		in.refill();
+	int entry = table.fast[in.bits & ((1 << FAST_BITS) - 1)];
+	if (entry != 0) {
+		in.bits >>= entry & 15;
+		in.numBits -= entry & 15;
+		return entry >> 4;
+	}
+	uint32_t code = reverseBits((uint32_t) (in.bits & 0xFFFF), 16);
+	int length = FAST_BITS + 1;
+	while (code >= table.maxCode[length])
+		++length;
+	if (length >= 16)
+		return -1;
+	int iSymbol = table.firstSymbol[length] + (int) (code >> (16 - length)) - table.firstCode[length];
+	if (iSymbol >= 288)
+		return -1;
+	in.bits >>= length;
+	in.numBits -= length;
+	return table.symbols[iSymbol];
+}
+
+static const uint16_t LengthBase[29]	= { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+											35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const uint8_t  LengthExtra[29]	= { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+											3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const uint16_t DistanceBase[30]	= { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385,
+											513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static const uint8_t  DistanceExtra[30]	= { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7,
+											8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+static const uint8_t  CodeLengthOrder[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+static bool readDynamicTables(BitReader& in, HuffmanTable& literals, HuffmanTable& distances)
+{
+	int numLiterals	 = in.take(5) + 257;
+	int numDistances = in.take(5) + 1;
+	int numCodeLengths = in.take(4) + 4;
+	uint8_t codeLengthLengths[19] = { };
+	for (int i = 0; i < numCodeLengths; ++i)
+		codeLengthLengths[CodeLengthOrder[i]] = in.take(3);
+	HuffmanTable codeLengths;
+	if (! codeLengths.build(codeLengthLengths, 19))
+		return false;
+
+	uint8_t lengths[288 + 32];
+	for (int i = 0; i < numLiterals + numDistances; ) {
+		int symbol = decodeSymbol(in, codeLengths);
+		if (symbol < 0 || in.isOverrun())
+			return false;
+		if (symbol < 16) {
+			lengths[i++] = symbol;
+			continue;
+		}
+		int repeated = 0, count;
+		if (symbol == 16) {
+			if (i == 0)
+				return false;
+			repeated = lengths[i - 1];
+			count = 3 + in.take(2);
+		} else if (symbol == 17)
+			count = 3 + in.take(3);
+		else
+			count = 11 + in.take(7);
+		if (i + count > numLiterals + numDistances)
+			return false;
+		memset(&lengths[i], repeated, count);
+		i += count;
+	}
+	return literals.build(lengths, numLiterals) && distances.build(&lengths[numLiterals], numDistances);
+}
+
+static bool buildFixedTables(HuffmanTable& literals, HuffmanTable& distances)
+{
+	uint8_t lengths[288];
+	memset(&lengths[0],	  8, 144);
+	memset(&lengths[144], 9, 112);
+	memset(&lengths[256], 7, 24);
+	memset(&lengths[280], 8, 8);
+	uint8_t distanceLengths[30];
+	memset(distanceLengths, 5, 30);
+	return literals.build(lengths, 288) && distances.build(distanceLengths, 30);
+}
+
+// Into exactly outSize bytes: anything else - short, long or malformed - is an error.
+//
+static bool inflate(const uint8_t* pIn, size_t inSize, uint8_t* pOut, size_t outSize)
+{
+	if (inSize < 2 || (pIn[0] & 0x0F) != 8 || ((pIn[0] << 8) | pIn[1]) % 31 != 0 || (pIn[1] & 0x20))
+		return false;		// (not deflate, bad header check, or needs a preset dictionary)
+
+	BitReader in(pIn + 2, pIn + inSize);
+	HuffmanTable literals, distances;
+	uint8_t* pWrite = pOut;
+	uint8_t* pOutEnd = pOut + outSize;
+	for (bool isFinal = false; ! isFinal; ) {
+		isFinal = in.take(1);
+		int type = in.take(2);
+		if (type == 0) {
+			in.alignToByte();
+			if (! in.rewind() || in.pEnd - in.p < 4)
+				return false;
+			uint16_t length		 = in.p[0] | in.p[1] << 8;
+			uint16_t notLength	 = in.p[2] | in.p[3] << 8;
+			in.p += 4;
+			if (length != (uint16_t) ~notLength || length > in.pEnd - in.p || length > pOutEnd - pWrite)
+				return false;
+			memcpy(pWrite, in.p, length);
+			pWrite += length;
+			in.p += length;
+			continue;
+		}
+		if (type == 3
+			|| ! (type == 1 ? buildFixedTables(literals, distances) : readDynamicTables(in, literals, distances)))
+			return false;
+
+		for (;;) {
+			int symbol = decodeSymbol(in, literals);
+			if (symbol < 256) {
+				if (symbol < 0 || pWrite == pOutEnd)
+					return false;
+				*pWrite++ = symbol;
+				continue;
+			}
+			if (symbol == 256)
+				break;
+			symbol -= 257;
+			if (symbol >= 29)
+				return false;
+			size_t length = LengthBase[symbol] + in.take(LengthExtra[symbol]);
+			int distanceSymbol = decodeSymbol(in, distances);
+			if (distanceSymbol < 0 || distanceSymbol >= 30)
+				return false;
+			size_t distance = DistanceBase[distanceSymbol] + in.take(DistanceExtra[distanceSymbol]);
+			if (distance > (size_t) (pWrite - pOut) || length > (size_t) (pOutEnd - pWrite))
+				return false;
+			const uint8_t* pFrom = pWrite - distance;
+			if (distance >= length)
+				memcpy(pWrite, pFrom, length);
+			else
+				for (size_t i = 0; i < length; ++i)		// (overlapping: repeats what it's writing)
+					pWrite[i] = pFrom[i];
+			pWrite += length;
+		}
+		if (in.isOverrun())
+			return false;
+	}
+	return pWrite == pOutEnd;
+}
+
+
+// PNG
+
+enum PngColorType { PNG_GREY = 0, PNG_RGB = 2, PNG_PALETTE = 3, PNG_GREY_ALPHA = 4, PNG_RGBA = 6 };
+
+struct PngHeader {
+	uint32_t	width, height;
+	int			bitDepth;
+	int			colorType;
+	int			channels;
+	bool		isInterlaced;
+};
+
+struct PngTransparency {		// from PLTE and tRNS
+	uint8_t		palette[256][4];
+	int			numColors = 0;
+	bool		hasKey	  = false;	// (grey or RGB value meaning transparent, at the image's bit depth)
+	uint16_t	key[3]	  = { };
+};
+
+static uint32_t bigEndian32(const uint8_t* p)	{ return (uint32_t) p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3]; }
+static uint16_t bigEndian16(const uint8_t* p)	{ return (uint16_t) (p[0] << 8 | p[1]); }
+
+static const uint8_t PngSignature[8] = { 137, 'P', 'N', 'G', '\r', '\n', 26, '\n' };
+
+struct Adam7Pass { uint32_t x0, y0, dx, dy; };
+static const Adam7Pass Adam7Passes[7] = { { 0, 0, 8, 8 }, { 4, 0, 8, 8 }, { 0, 4, 4, 8 }, { 2, 0, 4, 4 },
+										  { 0, 2, 2, 4 }, { 1, 0, 2, 2 }, { 0, 1, 1, 2 } };
+static const Adam7Pass WholeImage = { 0, 0, 1, 1 };
+
+static uint32_t passWidth(const Adam7Pass& pass, uint32_t width)	{ return width > pass.x0 ? (width - pass.x0 + pass.dx - 1) / pass.dx : 0; }
+static uint32_t passHeight(const Adam7Pass& pass, uint32_t height)	{ return height > pass.y0 ? (height - pass.y0 + pass.dy - 1) / pass.dy : 0; }
+
+static size_t rowBytes(const PngHeader& header, uint32_t width)
+{
+	return ((size_t) width * header.channels * header.bitDepth + 7) / 8;
+}
+
+static inline uint8_t paeth(int a, int b, int c)		// (left, above, above-left)
+{
+	int pa = abs(b - c), pb = abs(a - c), pc = abs(a + b - 2 * c);
+	return (pa <= pb && pa <= pc) ? a : (pb <= pc) ? b : c;
+}
+
+// In place, given the row above already unfiltered (for the first row, zeros).  The first pixel's
+//	bytes, having nothing to their left, are handled apart so the main loops needn't check.
+//
+static bool unfilterRow(uint8_t* pRow, const uint8_t* pAbove, size_t numBytes, size_t bytesPerPixel, int filter)
+{
+	size_t first = min(bytesPerPixel, numBytes);
+	switch (filter) {
+		case 0:	break;
+		case 1:	for (size_t i = bytesPerPixel; i < numBytes; ++i)
+					pRow[i] += pRow[i - bytesPerPixel];
+				break;
+		case 2:	for (size_t i = 0; i < numBytes; ++i)
+					pRow[i] += pAbove[i];
+				break;
+		case 3:	for (size_t i = 0; i < first; ++i)
+					pRow[i] += pAbove[i] >> 1;
+				for (size_t i = bytesPerPixel; i < numBytes; ++i)
+					pRow[i] += (pRow[i - bytesPerPixel] + pAbove[i]) >> 1;
+				break;
+		case 4:	for (size_t i = 0; i < first; ++i)
+					pRow[i] += pAbove[i];
+				for (size_t i = bytesPerPixel; i < numBytes; ++i)
+					pRow[i] += paeth(pRow[i - bytesPerPixel], pAbove[i], pAbove[i - bytesPerPixel]);
+				break;
+		default:
+			return false;
+	}
+	return true;
+}
+
+// One unfiltered row's pixels to RGBA8, every 'step' texels along the output row.  False if a palette
+//	index is out of range.
+//
+static bool expandRow(const uint8_t* pRow, uint32_t count, const PngHeader& header, const PngTransparency& transparency,
+					  uint8_t* pOut, size_t step)
+{
+	int depth = header.bitDepth;
+	if (depth == 8 && header.colorType == PNG_RGBA && step == 1) {		// (the usual cases, quickly)
+		memcpy(pOut, pRow, (size_t) count * 4);
+		return true;
+	}
+	if (depth == 8 && header.colorType == PNG_RGB && ! transparency.hasKey) {
+		for (uint32_t x = 0; x < count; ++x, pRow += 3, pOut += 4 * step) {
+			pOut[0] = pRow[0];
+			pOut[1] = pRow[1];
+			pOut[2] = pRow[2];
+			pOut[3] = 255;
+		}
+		return true;
+	}
+	auto sample = [&](size_t iSample) -> uint32_t {		// (at the image's bit depth)
+		if (depth == 8)
+			return pRow[iSample];
+		if (depth == 16)
+			return bigEndian16(&pRow[2 * iSample]);
+		size_t bit = iSample * depth;
+		return (pRow[bit / 8] >> (8 - depth - bit % 8)) & ((1 << depth) - 1);
+	};
+	auto to8Bits = [&](uint32_t value) -> uint8_t {
+		return (depth == 16) ? value >> 8 : (depth == 8) ? value : value * 255 / ((1 << depth) - 1);
+	};
+
+	for (uint32_t x = 0; x < count; ++x, pOut += 4 * step) {
+		size_t iSample = (size_t) x * header.channels;
+		switch (header.colorType) {
+			case PNG_GREY: {
+				uint32_t grey = sample(iSample);
+				pOut[0] = pOut[1] = pOut[2] = to8Bits(grey);
+				pOut[3] = (transparency.hasKey && grey == transparency.key[0]) ? 0 : 255;
+				break;
+			}
+			case PNG_GREY_ALPHA:
+				pOut[0] = pOut[1] = pOut[2] = to8Bits(sample(iSample));
+				pOut[3] = to8Bits(sample(iSample + 1));
+				break;
+			case PNG_RGB: {
+				uint32_t r = sample(iSample), g = sample(iSample + 1), b = sample(iSample + 2);
+				pOut[0] = to8Bits(r);
+				pOut[1] = to8Bits(g);
+				pOut[2] = to8Bits(b);
+				pOut[3] = (transparency.hasKey && r == transparency.key[0] && g == transparency.key[1]
+												&& b == transparency.key[2]) ? 0 : 255;
+				break;
+			}
+			case PNG_RGBA:
+				for (int c = 0; c < 4; ++c)
+					pOut[c] = to8Bits(sample(iSample + c));
+				break;
+			case PNG_PALETTE: {
+				uint32_t index = sample(iSample);
+				if ((int) index >= transparency.numColors)
+					return false;
+				memcpy(pOut, transparency.palette[index], 4);
+				break;
+			}
+		}
+	}
+	return true;
+}
+
+static bool readHeader(const uint8_t* pData, uint32_t length, PngHeader& header)
+{
+	if (length != 13)
+		return false;
+	header.width		= bigEndian32(pData);
+	header.height		= bigEndian32(pData + 4);
+	header.bitDepth		= pData[8];
+	header.colorType	= pData[9];
+	header.isInterlaced	= pData[12] == 1;
+	int depth = header.bitDepth;
+	switch (header.colorType) {
+		case PNG_GREY:		 header.channels = 1;  break;
+		case PNG_RGB:		 header.channels = 3;  break;
+		case PNG_PALETTE:	 header.channels = 1;  break;
+		case PNG_GREY_ALPHA: header.channels = 2;  break;
+		case PNG_RGBA:		 header.channels = 4;  break;
+		default:			 return false;
+	}
+	bool isDepthValid = (header.colorType == PNG_GREY) ? (depth == 1 || depth == 2 || depth == 4 || depth == 8 || depth == 16)
+					  : (header.colorType == PNG_PALETTE) ? (depth == 1 || depth == 2 || depth == 4 || depth == 8)
+					  : (depth == 8 || depth == 16);
+	return isDepthValid && pData[10] == 0 && pData[11] == 0 && pData[12] <= 1
+		&& header.width > 0 && header.height > 0
+		&& header.width <= PngDecoder::MAX_DIMENSION && header.height <= PngDecoder::MAX_DIMENSION;
+}
+
+
+bool PngDecoder::Decode(const uint8_t* pFile, size_t fileSize, vector<uint8_t>& rgba, uint32_t& width, uint32_t& height,
+						bool* pHasAlpha)
+{
+	if (fileSize < sizeof(PngSignature) || memcmp(pFile, PngSignature, sizeof(PngSignature)) != 0) {
+		Log(ERROR, "PNG: not a PNG file");
+		return false;
+	}
+	PngHeader header = { };
+	PngTransparency transparency;
+	vector<uint8_t> compressed;
+	const uint8_t* pOnlyIDAT = nullptr;		// (if just one, as is usual, inflate straight from the file)
+	size_t onlyIDATSize = 0;
+	int numIDATs = 0;
+	bool hasHeader = false, hasEnd = false;
+
+	for (const uint8_t* p = pFile + sizeof(PngSignature); ! hasEnd; ) {
+		if (pFile + fileSize - p < 12) {
+			Log(ERROR, "PNG: truncated");
+			return false;
+		}
+		uint32_t length = bigEndian32(p);
+		const uint8_t* pType = p + 4;
+		const uint8_t* pData = p + 8;
+		if (length > (size_t) (pFile + fileSize - pData) - 4) {
+			Log(ERROR, "PNG: truncated");
+			return false;
+		}
+		p = pData + length + 4;		// (skipping CRC)
+
+		if (memcmp(pType, "IHDR", 4) == 0) {
+			if (! readHeader(pData, length, header)) {
+				Log(ERROR, "PNG: unsupported or invalid header");
+				return false;
+			}
+			hasHeader = true;
+		} else if (! hasHeader) {
+			Log(ERROR, "PNG: missing header");
+			return false;
+		} else if (memcmp(pType, "PLTE", 4) == 0) {
+			if (length % 3 != 0 || length > 3 * 256) {
+				Log(ERROR, "PNG: invalid palette");
+				return false;
+			}
+			transparency.numColors = length / 3;
+			for (int i = 0; i < transparency.numColors; ++i) {
+				memcpy(transparency.palette[i], &pData[3 * i], 3);
+				transparency.palette[i][3] = 255;
+			}
+		} else if (memcmp(pType, "tRNS", 4) == 0) {
+			if (header.colorType == PNG_PALETTE)
+				for (uint32_t i = 0; i < length && i < 256; ++i)
+					transparency.palette[i][3] = pData[i];
+			else if (header.colorType == PNG_GREY && length == 2) {
+				transparency.hasKey = true;
+				transparency.key[0] = bigEndian16(pData);
+			} else if (header.colorType == PNG_RGB && length == 6) {
+				transparency.hasKey = true;
+				for (int c = 0; c < 3; ++c)
+					transparency.key[c] = bigEndian16(&pData[2 * c]);
+			}
+		} else if (memcmp(pType, "IDAT", 4) == 0) {
+			if (numIDATs++ == 0) {
+				pOnlyIDAT = pData;
+				onlyIDATSize = length;
+			} else {
+				if (numIDATs == 2)
+					compressed.assign(pOnlyIDAT, pOnlyIDAT + onlyIDATSize);
+				compressed.insert(compressed.end(), pData, pData + length);
+			}
+		} else if (memcmp(pType, "IEND", 4) == 0)
+			hasEnd = true;
+		else if (! (pType[0] & 0x20)) {		// (lowercase first letter means safe to ignore)
+			Log(ERROR, "PNG: unknown critical chunk '%.4s'", (const char*) pType);
+			return false;
+		}
+	}
+	if (numIDATs == 0 || (header.colorType == PNG_PALETTE && transparency.numColors == 0)) {
+		Log(ERROR, "PNG: no image data%s", numIDATs ? " (or palette)" : "");
+		return false;
+	}
+
+	// Inflate every pass (or the one whole image) at once, then unfilter and expand each pass's rows.
+	vector<Adam7Pass> passes;
+	if (header.isInterlaced)
+		passes.assign(Adam7Passes, Adam7Passes + 7);
+	else
+		passes.push_back(WholeImage);
+	size_t rawSize = 0;
+	for (const Adam7Pass& pass : passes)
+		if (passWidth(pass, header.width) > 0)
+			rawSize += passHeight(pass, header.height) * (1 + rowBytes(header, passWidth(pass, header.width)));
+
+	vector<uint8_t> raw(rawSize);
+	bool isInflated = (numIDATs == 1) ? inflate(pOnlyIDAT, onlyIDATSize, raw.data(), raw.size())
+									  : inflate(compressed.data(), compressed.size(), raw.data(), raw.size());
+	if (! isInflated) {
+		Log(ERROR, "PNG: image data corrupt");
+		return false;
+	}
+
+	width  = header.width;
+	height = header.height;
+	rgba.resize((size_t) width * height * 4);
+	size_t bytesPerPixel = max(1, header.channels * header.bitDepth / 8);
+	uint8_t* pRaw = raw.data();
+	vector<uint8_t> zeros(rowBytes(header, width));		// (as the row above the first)
+	for (const Adam7Pass& pass : passes) {
+		uint32_t passW = passWidth(pass, width), passH = passHeight(pass, height);
+		if (passW == 0)
+			continue;
+		size_t numBytes = rowBytes(header, passW);
+		const uint8_t* pPrevious = zeros.data();
+		for (uint32_t y = 0; y < passH; ++y, pRaw += 1 + numBytes) {
+			uint8_t* pRow = pRaw + 1;
+			uint8_t* pOut = &rgba[(((size_t) pass.y0 + y * pass.dy) * width + pass.x0) * 4];
+			if (! unfilterRow(pRow, pPrevious, numBytes, bytesPerPixel, pRaw[0])
+				|| ! expandRow(pRow, passW, header, transparency, pOut, pass.dx)) {
+				Log(ERROR, "PNG: image data corrupt");
+				return false;
+			}
+			pPrevious = pRow;
+		}
+	}
+
+	if (pHasAlpha) {
+		*pHasAlpha = false;
+		for (size_t i = 3; i < rgba.size() && ! *pHasAlpha; i += 4)
+			*pHasAlpha = rgba[i] != 255;
+	}
+	return true;
+}
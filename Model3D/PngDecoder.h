@@ -0,0 +1,37 @@
+//
+// PngDecoder.h
+//	Vulkan Convenience 3D Objects
+//
+// Self-contained PNG decoding (zlib inflate included) to 8-bit RGBA, for
+//	preparing textures off the render thread (see TextureCache), without
+//	depending on the platform's image library.  Handles every standard PNG:
+//	greyscale, RGB, palette, each with or without alpha (or tRNS), at any
+//	bit depth (16-bit is narrowed to 8), interlaced or not.  Checksums are
+//	not verified: files are trusted to be intact, but malformed or truncated
+//	ones fail cleanly rather than overrun.
+// One image decodes on one thread (inflating is inherently serial), so
+//	decode several at a time to use more cores.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef PngDecoder_h
+#define PngDecoder_h
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+
+class PngDecoder
+{
+public:
+	// False (having logged why) if not a PNG file, or a malformed one.
+	static bool Decode(const uint8_t* pFile, size_t fileSize,
+					   std::vector<uint8_t>& rgba, uint32_t& width, uint32_t& height,
+					   bool* pHasAlpha = nullptr);		// (whether any texel isn't opaque)
+
+	static const uint32_t MAX_DIMENSION = 16384;
+};
+
+#endif	// PngDecoder_h
@@ -0,0 +1,354 @@
+//
+// StreamingObjLoader.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "StreamingObjLoader.h"
+#include "Vertex3DTypes.h"
+#include "ObjTextParsing.h"
+#include "WeldTable.h"
+#include <cstdio>
+#include <cstring>
+
+
+typedef Vertex3DNormalTextureColor	CatchAllVertexType;		// (as ModelLoader's)
+
+static const size_t MEGABYTE = 1024 * 1024;
+
+
+// Hands out a file's contents as runs of whole lines, read through one fixed-size buffer.  A line
+//	not fitting in the buffer is discarded (and counted) rather than growing the buffer.
+//
+class LineReader
+{
+	FILE*		 pFile = nullptr;
+	vector<char> buffer;
+	size_t		 numBuffered = 0;
+	size_t		 iUnconsumed = 0;		// (start of partial line to carry over)
+	bool		 isEOF		 = false;
+	bool		 isDiscarding = false;
+
+public:
+	size_t numLinesTooLong = 0;
+
+	LineReader(size_t bufferSize)	: buffer(bufferSize)	{ }
+	~LineReader()	{ if (pFile) fclose(pFile); }
+
+	bool open(const string& fullPath)
+	{
+		pFile = fopen(fullPath.c_str(), "rb");
+		return pFile != nullptr;
+	}
+
+	void restart()
+	{
+		rewind(pFile);
+		numBuffered = iUnconsumed = 0;
+		isEOF = isDiscarding = false;
+		numLinesTooLong = 0;
+	}
+
+	bool next(const char*& begin, const char*& end)
+	{
+		for (;;) {
+			numBuffered -= iUnconsumed;
+			memmove(buffer.data(), buffer.data() + iUnconsumed, numBuffered);
+			iUnconsumed = 0;
+			if (! isEOF) {
+				size_t numWanted = buffer.size() - numBuffered;
+				size_t numRead = fread(buffer.data() + numBuffered, 1, numWanted, pFile);
+				isEOF = numRead < numWanted;
+				numBuffered += numRead;
+			}
+			if (numBuffered == 0)
+				return false;
+
+			const char* pData = buffer.data();
+			if (isDiscarding) {
+				const char* pNewline = (const char*) memchr(pData, '\n', numBuffered);
+				if (pNewline) {
+					iUnconsumed = pNewline + 1 - pData;
+					isDiscarding = false;
+				} else
+					numBuffered = 0;
+				continue;
+			}
+			size_t iEnd = numBuffered;
+			if (! isEOF) {
+				while (iEnd > 0 && pData[iEnd - 1] != '\n')
+					--iEnd;
+				if (iEnd == 0) {
+					++numLinesTooLong;
+					isDiscarding = true;
+					numBuffered = 0;
+					continue;
+				}
+			}
+			begin = pData;
+			end	  = pData + iEnd;
+			iUnconsumed = iEnd;
+			return true;
+		}
+	}
+};
+
+
+static size_t countFields(const char* p, const char* end)
+{
+	size_t numFields = 0;
+	for (skipBlanks(p, end); p < end && ! isEndOfLine(*p); skipBlanks(p, end)) {
+		++numFields;
+		while (p < end && ! isBlank(*p) && ! isEndOfLine(*p))
+			++p;
+	}
+	return numFields;
+}
+
+// Pack as VerticesDynamic does (see ModelLoader::VertexStride) so welding can compare against the vertex buffer.
+//
+static void packVertex(const CatchAllVertexType& vertex, AttributeBits attribits, uint8_t* pPacked)
+{
+	auto put = [&](const void* pAttribute, size_t size) {
+		memcpy(pPacked, pAttribute, size);
+		pPacked += size;
+	};
+	if (attribits & Attribits[POSITION])	put(&vertex.position, sizeof(vertex.position));
+	if (attribits & Attribits[NORMAL])		put(&vertex.normal,	  sizeof(vertex.normal));
+	if (attribits & Attribits[TEXCOORD])	put(&vertex.texCoord, sizeof(vertex.texCoord));
+	if (attribits & Attribits[COLOR])		put(&vertex.color,	  sizeof(vertex.color));
+}
+
+struct CornerKey {
+	int position, texCoord, normal;
+};
+
+
+AttributeBits StreamingObjLoader::load(const string& fullPath, WeldMode weldMode,
+									   VerticesDynamic& vertices, vector<uint32_t>& indices)
+{
+	peakMemory = numLinesSkipped = 0;
+	numRedundantVertices = 0;
+	failure.clear();
+
+	LineReader reader(READ_BUFFER_BYTES);
+	if (! reader.open(fullPath)) {
+		failure = "can't open file";
+		return 0;
+	}
+	const char* begin;
+	const char* end;
+
+	// PASS 1: count
+	size_t numPositions = 0, numNormals = 0, numTexCoords = 0, numCorners = 0;
+	bool hasColors = false;
+	while (reader.next(begin, end))
+		for (const char* p = begin; p < end; p = nextLine(p, end)) {
+			skipBlanks(p, end);
+			if (end - p < 2)
+				continue;
+			if (p[0] == 'v') {
+				if (isBlank(p[1])) {
+					++numPositions;
+					hasColors |= countFields(p + 2, end) >= 6;		// (x y z r g b)
+				}
+				else if (p[1] == 'n')	++numNormals;
+				else if (p[1] == 't')	++numTexCoords;
+			} else if (p[0] == 'f' && isBlank(p[1])) {
+				size_t numFields = countFields(p + 2, end);
+				if (numFields >= 3)
+					numCorners += 3 * (numFields - 2);
+			}
+		}
+	if (numPositions == 0 || numCorners == 0) {
+		failure = "no vertex positions or faces found";
+		return 0;
+	}
+
+	// Exact-sized from here on: only the vertex buffer and weld table grow (and are tallied as they do).
+	vector<float> positions, normals, texCoords, colors;
+	size_t fixedBytes = READ_BUFFER_BYTES + sizeof(float) * (3 * numPositions + 3 * numNormals + 2 * numTexCoords
+							+ (hasColors ? 3 * numPositions : 0)) + sizeof(uint32_t) * numCorners;
+	peakMemory = fixedBytes;
+	if (memoryLimit > 0 && fixedBytes > memoryLimit) {
+		failure = "needs over " + to_string(fixedBytes / MEGABYTE) + " MB, exceeding limit of "
+				+ to_string(memoryLimit / MEGABYTE) + " MB";
+		return 0;
+	}
+	positions.resize(3 * numPositions);
+	normals.resize(3 * numNormals);
+	texCoords.resize(2 * numTexCoords);
+	if (hasColors)
+		colors.resize(3 * numPositions, 1.0f);
+	indices.clear();
+	indices.reserve(numCorners);
+
+	AttributeBits attribits = Attribits[POSITION]
+							| ((numNormals > 0)	  ? Attribits[NORMAL]	: 0)
+							| ((numTexCoords > 0) ? Attribits[TEXCOORD] : 0)
+							| (hasColors		  ? Attribits[COLOR]	: 0);
+	vertices.setAttributes(attribits);
+	size_t stride = sizeof(CatchAllVertexType::position)
+				  + ((numNormals > 0)	? sizeof(CatchAllVertexType::normal)   : 0)
+				  + ((numTexCoords > 0) ? sizeof(CatchAllVertexType::texCoord) : 0)
+				  + (hasColors			? sizeof(CatchAllVertexType::color)	   : 0);
+
+	size_t expectedUnique = numCorners / 6;		// (see assembleVertices; here growth is cheaper than over-reserving)
+	WeldIndex				uniqueVertices(weldMode == WELD_BY_VALUE ? expectedUnique : 0);
+	WeldTable<CornerKey>	uniqueCorners(weldMode == WELD_BY_INDEX ? expectedUnique : 0);
+	size_t vertexCapacity = 0;					// (presumed, as VerticesDynamic grows by doubling)
+
+	// What's held now, plus whichever new (doubled) allocation the next vertex might need while its
+	//	predecessor's still held.  Checked after every new vertex, so the next one never overshoots.
+	auto projectedPeak = [&]() {
+		size_t weldGrowth	= uniqueVertices.growthBytes() + uniqueCorners.growthBytes();
+		size_t vertexGrowth = (vertices.count() == vertexCapacity) ? 2 * vertexCapacity * stride : 0;
+		return fixedBytes + uniqueVertices.memoryUsed() + uniqueCorners.memoryUsed() + vertexCapacity * stride
+			 + max(weldGrowth, vertexGrowth);
+	};
+
+	uint8_t packed[sizeof(CatchAllVertexType)];
+	auto makeVertex = [&](const CornerKey& corner) {
+		CatchAllVertexType vertex;
+		memset((void*) &vertex, 0, sizeof(vertex));
+		const float* xyz = &positions[3 * corner.position];
+		vertex.position = { xyz[0], xyz[1], xyz[2] };
+		if (corner.normal >= 0) {
+			const float* normal = &normals[3 * corner.normal];
+			vertex.normal = { normal[0], normal[1], normal[2] };
+		}
+		if (corner.texCoord >= 0)
+			vertex.texCoord = { texCoords[2 * corner.texCoord], texCoords[2 * corner.texCoord + 1] };
+		if (hasColors) {
+			const float* rgb = &colors[3 * corner.position];
+			vertex.color = { rgb[0], rgb[1], rgb[2], 1.0f };
+		} else
+			vertex.color = { 1.0f, 1.0f, 1.0f, 1.0f };
+		return vertex;
+	};
+	// Returns false if this vertex would break the memory limit.
+	auto addCorner = [&](const CornerKey& corner) {
+		bool isNew;
+		uint32_t iVertex;
+		if (weldMode == WELD_BY_INDEX) {
+			iVertex = uniqueCorners.findOrInsert(corner, isNew);
+			if (isNew)
+				vertices.push_back(makeVertex(corner));
+		} else {
+			CatchAllVertexType vertex = makeVertex(corner);
+			packVertex(vertex, attribits, packed);
+			iVertex = uniqueVertices.findOrInsert(Hash64(packed, stride), [&](uint32_t iExisting) {
+				return memcmp((uint8_t*) vertices.pBytes + iExisting * stride, packed, stride) == 0;
+			}, isNew);
+			if (isNew)
+				vertices.push_back(vertex);
+		}
+		indices.push_back(iVertex);
+		if (! isNew) {
+			++numRedundantVertices;
+			return true;
+		}
+		if (vertices.count() > vertexCapacity)
+			vertexCapacity = max<size_t>(16, 2 * vertexCapacity);
+		size_t peak = projectedPeak();
+		peakMemory = max(peakMemory, peak);
+		return memoryLimit == 0 || peak <= memoryLimit;
+	};
+
+	// PASS 2: parse, resolving each face as it comes
+	reader.restart();
+	size_t iPosition = 0, iNormal = 0, iTexCoord = 0;
+	vector<CornerKey> polygon;
+	bool isWithinLimit = true;
+
+	while (isWithinLimit && reader.next(begin, end))
+		for (const char* p = begin; p < end && isWithinLimit; p = nextLine(p, end)) {
+			skipBlanks(p, end);
+			if (end - p < 2)
+				continue;
+			bool isOK = true;
+
+			if (p[0] == 'v' && isBlank(p[1]) && iPosition < numPositions) {
+				p += 2;
+				float* xyz = &positions[3 * iPosition];
+				isOK = parseFloat(p, end, xyz[0]) && parseFloat(p, end, xyz[1]) && parseFloat(p, end, xyz[2]);
+				float w, rgb[3];		// optional: either w (ignored) or vertex color r g b
+				if (isOK && hasColors && parseFloat(p, end, w)) {
+					rgb[0] = w;
+					if (parseFloat(p, end, rgb[1]) && parseFloat(p, end, rgb[2]))
+						memcpy(&colors[3 * iPosition], rgb, sizeof(rgb));
+				}
+				++iPosition;
+			}
+			else if (p[0] == 'v' && p[1] == 'n' && iNormal < numNormals) {
+				p += 2;
+				float* xyz = &normals[3 * iNormal++];
+				isOK = parseFloat(p, end, xyz[0]) && parseFloat(p, end, xyz[1]) && parseFloat(p, end, xyz[2]);
+			}
+			else if (p[0] == 'v' && p[1] == 't' && iTexCoord < numTexCoords) {
+				p += 2;
+				float* uv = &texCoords[2 * iTexCoord++];
+				isOK = parseFloat(p, end, uv[0]);
+				if (isOK && ! parseFloat(p, end, uv[1]))
+					uv[1] = 0.0f;
+			}
+			else if (p[0] == 'f' && isBlank(p[1])) {
+				p += 2;
+				polygon.clear();
+				for (skipBlanks(p, end); p < end && ! isEndOfLine(*p) && isOK; skipBlanks(p, end)) {
+					CornerKey corner = { -1, -1, -1 };
+					int index;
+					isOK = parseInt(p, end, index);
+					if (! isOK)
+						break;
+					corner.position = resolveIndex(index, iPosition);
+					if (p < end && *p == '/') {
+						if (++p < end && *p != '/' && parseInt(p, end, index))
+							corner.texCoord = resolveIndex(index, iTexCoord);
+						if (p < end && *p == '/' && parseInt(++p, end, index))
+							corner.normal = resolveIndex(index, iNormal);
+					}
+					if (corner.texCoord >= (int) iTexCoord)		// (ahead, so not yet read: treat as absent,
+						corner.texCoord = -1;					//	as tinyobj does out-of-range ones)
+					if (corner.normal >= (int) iNormal)
+						corner.normal = -1;
+					isOK = corner.position >= 0 && corner.position < (int) iPosition
+						&& (p == end || isBlank(*p) || isEndOfLine(*p));
+					polygon.push_back(corner);
+				}
+				if (isOK && polygon.size() >= 3 && indices.size() + 3 * (polygon.size() - 2) <= numCorners)
+					for (size_t iCorner = 2; iCorner < polygon.size() && isWithinLimit; ++iCorner)	// triangle fan
+						isWithinLimit = addCorner(polygon[0]) && addCorner(polygon[iCorner - 1])
+									 && addCorner(polygon[iCorner]);
+				else
+					isOK = false;
+			}
+			if (! isOK)
+				++numLinesSkipped;
+		}
+	numLinesSkipped += reader.numLinesTooLong;
+	uniqueVertices = WeldIndex();				// (release before exactResize makes its copy)
+	uniqueCorners  = WeldTable<CornerKey>();
+
+	if (! isWithinLimit) {
+		failure = "exceeded memory limit of " + to_string(memoryLimit / MEGABYTE) + " MB after "
+				+ to_string(vertices.count()) + " vertices";
+		vertices.clear();
+		vector<uint32_t>().swap(indices);
+		numRedundantVertices = 0;
+		return 0;
+	}
+	if (indices.empty()) {
+		failure = "no valid faces";
+		return 0;
+	}
+	size_t trimmedPeak = fixedBytes + (vertexCapacity + vertices.count()) * stride;
+	if (memoryLimit == 0 || trimmedPeak <= memoryLimit) {
+		peakMemory = max(peakMemory, trimmedPeak);
+		vertices.exactResize();
+	}
+	return attribits;
+}
@@ -0,0 +1,53 @@
+//
+// StreamingObjLoader.h
+//	Vulkan Convenience 3D Objects
+//
+// OBJ loading in bounded memory (see SpecType OBJ_FILE_STREAMED), for models
+//	too large to load the usual way, which holds at once the parsed attribute
+//	arrays, per-shape face corner lists, a weld table holding a copy of every
+//	unique vertex, and the growing vertex buffer.  Instead, the file is read
+//	sequentially through one fixed-size buffer (never mapped or read whole),
+//	twice:
+//	1. counting v/vn/vt lines and triangulated face corners, so everything
+//		can be allocated exactly (and the load refused up front if that alone
+//		won't fit under the memory limit), and which attributes exist, thus
+//		the final vertex layout, is known before the first vertex is made.
+//	2. parsing, with each face corner resolved and welded as soon as it's
+//		read, straight into the final packed VerticesDynamic and index buffer.
+//		Welding by value keeps no copy of the vertices: its WeldIndex compares
+//		against those already packed in the vertex buffer.
+//	Memory use is tallied as it goes, including the transient extra copy when
+//	a container grows, and loading stops (fails) rather than exceed the limit.
+// Unlike FastObjParser, faces may only refer to vertex data that precedes
+//	them (true of practically every exporter's output); others are skipped.
+//	Same supported subset otherwise: v (with optional RGB), vn, vt, f.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef StreamingObjLoader_h
+#define StreamingObjLoader_h
+
+#include "VerticesDynamic.h"
+#include "ModelDefSpec.h"
+
+
+class StreamingObjLoader
+{
+public:
+	StreamingObjLoader(size_t memoryLimit = 0)	: memoryLimit(memoryLimit)	{ }		// in bytes; 0 for none
+
+	// Fills vertices/indices, returning the attributes the vertices have, or 0 if nothing loaded
+	//	(either file unreadable or containing no faces, or memory limit reached; see 'failure').
+	AttributeBits load(const string& fullPath, WeldMode weldMode, VerticesDynamic& vertices, vector<uint32_t>& indices);
+
+	size_t	memoryLimit;
+	size_t	peakMemory			 = 0;	// (informational) most bytes accounted for at once
+	size_t	numLinesSkipped		 = 0;	// malformed, or faces referring ahead
+	int		numRedundantVertices = 0;
+	string	failure;
+
+	static const size_t READ_BUFFER_BYTES = 4 * 1024 * 1024;	// (also longest line allowed)
+};
+
+#endif	// StreamingObjLoader_h
@@ -0,0 +1,117 @@
+//
+// Submeshes.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "Submeshes.h"
+#include "WeldTable.h"
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+
+using std::vector;
+
+
+struct SubmeshKey {
+	uint32_t shapeID;
+	int32_t	 materialID;
+};
+
+
+void SubmeshBuilder::Build(uint32_t* indices, size_t indexCount, const vector<uint32_t>& triangleShapes,
+						   const vector<int32_t>& triangleMaterials, const uint8_t* pVertices, size_t vertexStride,
+						   vector<Submesh>& submeshes)
+{
+	submeshes.clear();
+	size_t numTriangles = indexCount / 3;
+	if (numTriangles == 0)
+		return;
+
+	// Distinct (shape, material) pairs in order of first appearance...
+	WeldTable<SubmeshKey> keys;
+	vector<uint32_t> keyOf(numTriangles);
+	vector<uint32_t> numTrianglesOf;
+	for (size_t iTri = 0; iTri < numTriangles; ++iTri) {
+		SubmeshKey key = { iTri < triangleShapes.size() ? triangleShapes[iTri] : 0,
+						   iTri < triangleMaterials.size() ? triangleMaterials[iTri] : -1 };
+		bool isNew;
+		keyOf[iTri] = keys.findOrInsert(key, isNew);
+		if (isNew)
+			numTrianglesOf.push_back(0);
+		++numTrianglesOf[keyOf[iTri]];
+	}
+
+	// ...then grouped by material.
+	vector<uint32_t> order(keys.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+		return keys.key(a).materialID < keys.key(b).materialID;
+	});
+	vector<uint32_t> nextIndexOf(keys.size());
+	uint32_t firstIndex = 0;
+	for (uint32_t iKey : order) {
+		Submesh submesh = {};
+		submesh.firstIndex = firstIndex;
+		submesh.indexCount = 3 * numTrianglesOf[iKey];
+		submesh.materialID = keys.key(iKey).materialID;
+		submesh.shapeID	   = keys.key(iKey).shapeID;
+		nextIndexOf[iKey] = firstIndex;
+		firstIndex += submesh.indexCount;
+		submeshes.push_back(submesh);
+	}
+
+	if (keys.size() > 1) {
+		vector<uint32_t> sorted(3 * numTriangles);
+		for (size_t iTri = 0; iTri < numTriangles; ++iTri) {
+			uint32_t& iNext = nextIndexOf[keyOf[iTri]];
+			std::copy(&indices[3 * iTri], &indices[3 * iTri + 3], &sorted[iNext]);
+			iNext += 3;
+		}
+		std::copy(sorted.begin(), sorted.end(), indices);
+	}
+
+	for (Submesh& submesh : submeshes) {
+		std::fill(submesh.boundsMin, submesh.boundsMin + 3, INFINITY);
+		std::fill(submesh.boundsMax, submesh.boundsMax + 3, -INFINITY);
+		for (uint32_t i = submesh.firstIndex; i < submesh.firstIndex + submesh.indexCount; ++i) {
+			const float* position = (const float*) (pVertices + indices[i] * vertexStride);
+			for (int xyz = 0; xyz < 3; ++xyz) {
+				submesh.boundsMin[xyz] = std::min(submesh.boundsMin[xyz], position[xyz]);
+				submesh.boundsMax[xyz] = std::max(submesh.boundsMax[xyz], position[xyz]);
+			}
+		}
+	}
+}
+
+// Outside if the box corner farthest along a plane's (inward) normal is still behind it.
+//
+bool SubmeshBuilder::IsOutsideFrustum(const Submesh& submesh, const float planes[6][4])
+{
+	for (int iPlane = 0; iPlane < 6; ++iPlane) {
+		const float* plane = planes[iPlane];
+		float distance = plane[3];
+		for (int xyz = 0; xyz < 3; ++xyz)
+			distance += plane[xyz] * (plane[xyz] >= 0.0f ? submesh.boundsMax[xyz] : submesh.boundsMin[xyz]);
+		if (distance < 0.0f)
+			return true;
+	}
+	return false;
+}
+
+void SubmeshBuilder::VisibleDraws(const vector<Submesh>& submeshes, const float planes[6][4], vector<SubmeshDraw>& draws)
+{
+	draws.clear();
+	for (const Submesh& submesh : submeshes) {
+		if (planes && IsOutsideFrustum(submesh, planes))
+			continue;
+		SubmeshDraw* pLast = draws.empty() ? nullptr : &draws.back();
+		if (pLast && pLast->materialID == submesh.materialID && pLast->firstIndex + pLast->indexCount == submesh.firstIndex)
+			pLast->indexCount += submesh.indexCount;
+		else
+			draws.push_back({ submesh.materialID, submesh.firstIndex, submesh.indexCount });
+	}
+}
@@ -0,0 +1,67 @@
+//
+// Submeshes.h
+//	Vulkan Convenience 3D Objects
+//
+// Keep a model's parts - its OBJ objects/groups ('o'/'g') and the materials
+//	('usemtl') their faces use - distinguishable once loaded into one vertex
+//	and one index buffer: each distinct (shape, material) pair becomes a
+//	Submesh, a contiguous range of the index buffer with its own bounding box.
+//	Submeshes are ordered by material, so a renderer can cull each submesh
+//	on its own, then draw the survivors in as few calls as possible, binding
+//	each material's textures once per run of same-material submeshes (see
+//	VisibleDraws).
+// Materials are as read from the OBJ's .mtl library, reduced to what we use.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef Submeshes_h
+#define Submeshes_h
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+
+struct Submesh {
+	uint32_t firstIndex;		// triangles: indices[firstIndex .. firstIndex + indexCount)
+	uint32_t indexCount;
+	int32_t	 materialID;		// into ModelLoader::materials(), or -1 for none
+	uint32_t shapeID;			// into ModelLoader::shapeNames()
+	float	 boundsMin[3];		// axis-aligned bounding box, in model space
+	float	 boundsMax[3];
+};
+
+struct ModelMaterial {
+	std::string name;
+	std::string diffuseTexture;		// (filename as given in .mtl map_Kd, or empty)
+	float		diffuseColor[3] = { 1.0f, 1.0f, 1.0f };
+};
+
+struct SubmeshDraw {			// one draw call covering one or more adjacent submeshes
+	int32_t	 materialID;
+	uint32_t firstIndex;
+	uint32_t indexCount;
+};
+
+
+class SubmeshBuilder
+{
+public:
+	// Given each triangle's shape and material (either vector may be empty, meaning all 0, or -1 for
+	//	material) reorder triangles so each Submesh is contiguous, stable within it.  Expects positions
+	//	as three floats starting each vertex.
+	static void Build(uint32_t* indices, size_t indexCount, const std::vector<uint32_t>& triangleShapes,
+					  const std::vector<int32_t>& triangleMaterials, const uint8_t* pVertices, size_t vertexStride,
+					  std::vector<Submesh>& submeshes);
+
+	// Planes as from MeshletBuilder::FrustumPlanes (in the mesh's model space).
+	static bool IsOutsideFrustum(const Submesh& submesh, const float planes[6][4]);
+
+	// Submeshes not culled (all, if planes is nullptr), merged into as few draws as possible.
+	static void VisibleDraws(const std::vector<Submesh>& submeshes, const float planes[6][4],
+							 std::vector<SubmeshDraw>& draws);
+};
+
+#endif	// Submeshes_h
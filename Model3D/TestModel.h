@@ -7,6 +7,9 @@
 //	This model originated from OpenGL; render in Vulkan accordingly.
 //	There's no texturing or vertex color, so just use shader with
 //	normal-based/calculated/simplistic shading.
+// Loads in the background; don't render until whenLoaded() is ready.
+//	Loaded via MeshRegistry, so re-creating it reuses the mesh already loaded.
+//	Pickable: its bvh() finds which triangle a ray (e.g. from a tap) hits.
 //
 // Created 7/15/20 by Tadd Jensen
 //	© 0000 (uncopyrighted; use at will)
@@ -15,23 +18,29 @@
 #include "Vertex3DTypes.h"
 #include "MeshObject.h"
 
-#include "ModelLoader.h"
+#include "MeshRegistry.h"
 
 
 class RenderableTestModel : public DrawableSpecifier {
 
 	VertexDescriptionDynamic vertexDescriptor;
 	MeshObject object3D = { vertexDescriptor };
-	ModelLoader model;
+	MeshHandle model;
 
 	DrawableObjectName name	= "viking_room.obj";	// object's "name" can arbitrarily be same as its filename
 
+	std::shared_future<bool> loaded;
+
 public:
 	RenderableTestModel(UBO& refMVP)
 		:	DrawableSpecifier(object3D, name)
 	{
-		model.load(mesh, name);
-		object3D.indexType = model.indexType();
+		ModelDefSpec spec;
+		spec.filename = name;
+		spec.type = OBJ_FILE;
+		spec.isOptimized = true;
+		spec.isPickable = true;
+		loaded = MeshRegistry::Shared().loadAsync(mesh, spec, model);	// (sets mesh.indexType too)
 
 		shaders = { { VERTEX,	"uv,mvp+norm=diffuv-vert.spv"},
 					{ FRAGMENT, "textuv+intens-frag.spv" } };
@@ -39,4 +48,14 @@ public:
 		textures = { { "viking_room.png" }, { } };
 		customize = SHOW_BACKFACES;
 	}
+
+	~RenderableTestModel()
+	{
+		if (loaded.valid())		// (registry would otherwise still fill in our mesh)
+			loaded.wait();
+	}
+
+	std::shared_future<bool> whenLoaded()	{ return loaded; }
+	float loadProgress()					{ return model->progress(); }
+	const MeshBVH& bvh()					{ return model->loader.bvh(); }		// (once loaded)
 };
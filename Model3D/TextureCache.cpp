@@ -0,0 +1,402 @@
+//
+// TextureCache.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "TextureCache.h"
+#include "FileSystem.h"
+#include "MeshCache.h"
+#include "PngDecoder.h"
+#include "MipGenerator.h"
+#include "WorkerPool.h"
+#include "Hash64.h"
+#include <sys/stat.h>
+#include <cstdio>
+#include <chrono>
+#include <numeric>
+
+
+// KTX2 LAYOUT (see the Khronos KTX 2.0 specification)
+
+static const uint8_t Ktx2Identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+struct Ktx2Header {
+	uint8_t		identifier[12];
+	uint32_t	vkFormat;
+	uint32_t	typeSize;
+	uint32_t	pixelWidth;
+	uint32_t	pixelHeight;
+	uint32_t	pixelDepth;			// (0 for 2D)
+	uint32_t	layerCount;			// (0 if not an array)
+	uint32_t	faceCount;
+	uint32_t	levelCount;
+	uint32_t	supercompressionScheme;
+	uint32_t	dfdByteOffset;		// data format descriptor,
+	uint32_t	dfdByteLength;
+	uint32_t	kvdByteOffset;		//	key/value data,
+	uint32_t	kvdByteLength;
+	uint64_t	sgdByteOffset;		//	and supercompression global data (none)
+	uint64_t	sgdByteLength;
+};									// (followed by a Ktx2Level per level, largest first)
+static_assert(sizeof(Ktx2Header) == 80, "KTX2 header must be packed as the file lays it out");
+
+struct Ktx2Level {
+	uint64_t	byteOffset;			// from beginning of file
+	uint64_t	byteLength;
+	uint64_t	uncompressedByteLength;
+};
+
+// Our key/value entry, recording what the texture was prepared from, and how.
+static const char SourceKey[] = "VulkanViewer.source";
+
+struct TextureCacheSource {
+	uint32_t	version;
+	uint32_t	isSRGB;
+	uint32_t	isMipmapped;
+	uint32_t	compression;		// (as asked for; if ETC2, the texture may be uncompressed for having alpha)
+	uint64_t	sourceHash;			// Hash64 of source file's contents
+	uint64_t	sourceSize;
+	uint64_t	sourceModifyTime;
+};
+
+static const char WriterKey[]	= "KTXwriter";
+static const char WriterValue[]	= "VulkanViewer TextureCache";
+
+static uint64_t alignUp(uint64_t offset, uint64_t alignment) {
+	return (offset + alignment - 1) / alignment * alignment;
+}
+
+static VkFormat formatFor(TextureCompression compression, bool isSRGB)
+{
+	switch (compression) {
+		case TEXTURE_BC7:	return isSRGB ? VK_FORMAT_BC7_SRGB_BLOCK : VK_FORMAT_BC7_UNORM_BLOCK;
+		case TEXTURE_ETC2:	return isSRGB ? VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK : VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK;
+		default:			return isSRGB ? VK_FORMAT_R8G8B8A8_SRGB : VK_FORMAT_R8G8B8A8_UNORM;
+	}
+}
+
+static bool compressionOf(uint32_t vkFormat, TextureCompression& compression, bool& isSRGB)
+{
+	for (TextureCompression each : { TEXTURE_UNCOMPRESSED, TEXTURE_BC7, TEXTURE_ETC2 })
+		for (bool eachSRGB : { false, true })
+			if (vkFormat == (uint32_t) formatFor(each, eachSRGB)) {
+				compression = each;
+				isSRGB = eachSRGB;
+				return true;
+			}
+	return false;
+}
+
+static size_t levelBytes(uint32_t width, uint32_t height, TextureCompression compression)
+{
+	return (compression == TEXTURE_UNCOMPRESSED) ? (size_t) width * height * 4
+												 : BlockCompressor::CompressedSize(width, height, compression);
+}
+
+// Khronos Data Format descriptor: one "basic" block, describing each channel (or for block formats, the block).
+//
+static vector<uint32_t> dataFormatDescriptor(TextureCompression compression, bool isSRGB)
+{
+	enum { MODEL_RGBSDA = 1, MODEL_BC7 = 134, MODEL_ETC2 = 161 };
+	enum { PRIMARIES_BT709 = 1, TRANSFER_LINEAR = 1, TRANSFER_SRGB = 2 };
+	enum { CHANNEL_ALPHA = 15, ETC2_COLOR = 2, QUALIFIER_LINEAR = 0x10 };
+
+	bool isBlock = compression != TEXTURE_UNCOMPRESSED;
+	uint32_t model = (compression == TEXTURE_BC7) ? MODEL_BC7 : (compression == TEXTURE_ETC2) ? MODEL_ETC2 : MODEL_RGBSDA;
+	uint32_t numSamples = isBlock ? 1 : 4;
+	uint32_t blockSize = 24 + 16 * numSamples;
+	vector<uint32_t> words = {
+		4 + blockSize,						// (total size)
+		0,									// vendor: Khronos; type: basic
+		2 | blockSize << 16,				// version 2
+		model | PRIMARIES_BT709 << 8 | (isSRGB ? TRANSFER_SRGB : TRANSFER_LINEAR) << 16,
+		isBlock ? (3u | 3u << 8) : 0u,		// texel block: 4x4, or 1x1 (as size less one)
+		(uint32_t) (isBlock ? BlockCompressor::BlockBytes(compression) : 4),
+		0
+	};
+	auto addSample = [&](uint32_t bitOffset, uint32_t bitLength, uint32_t channel, uint32_t upper) {
+		words.insert(words.end(), { bitOffset | (bitLength - 1) << 16 | channel << 24, 0, 0, upper });
+	};
+	if (compression == TEXTURE_BC7)
+		addSample(0, 128, 0, UINT32_MAX);
+	else if (compression == TEXTURE_ETC2)
+		addSample(0, 64, ETC2_COLOR, UINT32_MAX);
+	else {
+		for (uint32_t c = 0; c < 3; ++c)
+			addSample(8 * c, 8, c, 255);
+		addSample(24, 8, CHANNEL_ALPHA | (isSRGB ? QUALIFIER_LINEAR : 0), 255);		// (alpha is never sRGB)
+	}
+	return words;
+}
+
+static void appendKeyValue(vector<uint8_t>& data, const char* key, const void* pValue, size_t valueSize)
+{
+	uint32_t length = (uint32_t) (strlen(key) + 1 + valueSize);
+	const uint8_t* pLength = (const uint8_t*) &length;
+	data.insert(data.end(), pLength, pLength + sizeof(length));
+	data.insert(data.end(), key, key + strlen(key) + 1);
+	data.insert(data.end(), (const uint8_t*) pValue, (const uint8_t*) pValue + valueSize);
+	data.resize(alignUp(data.size(), 4));
+}
+
+// Our entry's value within the key/value data, or null if there's none or it's malformed.
+//
+static const uint8_t* findSourceValue(const uint8_t* pData, size_t numBytes)
+{
+	for (size_t offset = 0; offset + sizeof(uint32_t) <= numBytes; ) {
+		uint32_t length;
+		memcpy(&length, pData + offset, sizeof(length));
+		const char* pKey = (const char*) pData + offset + sizeof(length);
+		if (length > numBytes - offset - sizeof(length))
+			return nullptr;
+		if (length == sizeof(SourceKey) + sizeof(TextureCacheSource) && memcmp(pKey, SourceKey, sizeof(SourceKey)) == 0)
+			return (const uint8_t*) pKey + sizeof(SourceKey);
+		offset = alignUp(offset + sizeof(length) + length, 4);
+	}
+	return nullptr;
+}
+
+// Write to a temporary file first, then rename it into place (as MeshCache does).  Level data is smallest
+//	first, as KTX2 lays it out, each aligned to its block size (and to 4 bytes).
+//
+static bool writeKtx2(const string& cachePath, TextureCompression compression, bool isSRGB,
+					  const vector<vector<uint8_t>>& levels, uint32_t width, uint32_t height, const TextureCacheSource& source)
+{
+	vector<uint32_t> descriptor = dataFormatDescriptor(compression, isSRGB);
+	vector<uint8_t> keyValues;
+	appendKeyValue(keyValues, WriterKey, WriterValue, sizeof(WriterValue));		// (sorted by key, as required)
+	appendKeyValue(keyValues, SourceKey, &source, sizeof(source));
+
+	Ktx2Header header = { };
+	memcpy(header.identifier, Ktx2Identifier, sizeof(Ktx2Identifier));
+	header.vkFormat		 = formatFor(compression, isSRGB);
+	header.typeSize		 = 1;
+	header.pixelWidth	 = width;
+	header.pixelHeight	 = height;
+	header.faceCount	 = 1;
+	header.levelCount	 = (uint32_t) levels.size();
+	header.dfdByteOffset = (uint32_t) (sizeof(Ktx2Header) + levels.size() * sizeof(Ktx2Level));
+	header.dfdByteLength = (uint32_t) (descriptor.size() * sizeof(uint32_t));
+	header.kvdByteOffset = header.dfdByteOffset + header.dfdByteLength;
+	header.kvdByteLength = (uint32_t) keyValues.size();
+
+	size_t alignment = std::lcm<size_t>(compression == TEXTURE_UNCOMPRESSED ? 4 : BlockCompressor::BlockBytes(compression), 4);
+	vector<Ktx2Level> levelIndex(levels.size());
+	uint64_t offset = header.kvdByteOffset + header.kvdByteLength;
+	for (size_t iLevel = levels.size(); iLevel-- > 0; ) {
+		offset = alignUp(offset, alignment);
+		levelIndex[iLevel] = { offset, levels[iLevel].size(), levels[iLevel].size() };
+		offset += levels[iLevel].size();
+	}
+
+	string tempPath = cachePath + ".tmp";
+	FILE* pFile = fopen(tempPath.c_str(), "wb");
+	if (! pFile) {
+		Log(ERROR, "TextureCache: can't create %s", tempPath.c_str());
+		return false;
+	}
+	bool isOK = fwrite(&header, sizeof(header), 1, pFile) == 1
+			 && fwrite(levelIndex.data(), sizeof(Ktx2Level), levelIndex.size(), pFile) == levelIndex.size()
+			 && fwrite(descriptor.data(), sizeof(uint32_t), descriptor.size(), pFile) == descriptor.size()
+			 && fwrite(keyValues.data(), 1, keyValues.size(), pFile) == keyValues.size();
+	for (size_t iLevel = levels.size(); isOK && iLevel-- > 0; ) {
+		static const uint8_t padding[16] = { };
+		size_t numPadding = levelIndex[iLevel].byteOffset - ftell(pFile);
+		isOK = fwrite(padding, 1, numPadding, pFile) == numPadding
+			&& fwrite(levels[iLevel].data(), 1, levels[iLevel].size(), pFile) == levels[iLevel].size();
+	}
+	isOK = (fclose(pFile) == 0) && isOK;
+	remove(cachePath.c_str());		// (Windows' rename won't replace an existing file)
+	if (! isOK || rename(tempPath.c_str(), cachePath.c_str()) != 0) {
+		remove(tempPath.c_str());
+		Log(ERROR, "TextureCache: FAILED writing %s", cachePath.c_str());
+		return false;
+	}
+	return true;
+}
+
+
+// e.g. ".../VulkanViewer/viking_room-3f9c0a2b7d41e6c5.ktx2" where hex is of the source's full path (as for MeshCache).
+//
+string TextureCache::CachePathFor(const string& sourceFullPath)
+{
+	string meshCachePath = MeshCache::CachePathFor(sourceFullPath);
+	if (meshCachePath.empty())
+		return "";
+	return meshCachePath.substr(0, meshCachePath.find_last_of('.')) + ".ktx2";
+}
+
+
+bool TextureCache::open(const string& sourceFullPath, const TextureCacheOptions& options)
+{
+	close();
+	sourcePath = sourceFullPath;
+	cachePath = CachePathFor(sourceFullPath);
+
+	struct stat source;
+	if (cachePath.empty() || stat(sourcePath.c_str(), &source) != 0
+		|| ! mapping.open(cachePath) || mapping.size() < sizeof(Ktx2Header)) {
+		close();
+		return false;
+	}
+	Ktx2Header header;
+	memcpy(&header, mapping.data(), sizeof(header));
+	const uint8_t* pFile = (const uint8_t*) mapping.data();
+	size_t fileSize = mapping.size();
+
+	TextureCompression compression;
+	bool isSRGB;
+	uint32_t fullLevelCount = MipGenerator::LevelCount(header.pixelWidth, header.pixelHeight);
+	bool isValid = memcmp(header.identifier, Ktx2Identifier, sizeof(Ktx2Identifier)) == 0
+				&& compressionOf(header.vkFormat, compression, isSRGB) && isSRGB == options.isSRGB
+				&& header.pixelWidth > 0 && header.pixelHeight > 0 && header.pixelDepth == 0
+				&& header.layerCount == 0 && header.faceCount == 1 && header.supercompressionScheme == 0
+				&& header.levelCount == (options.isMipmapped ? fullLevelCount : 1)
+				&& sizeof(Ktx2Header) + header.levelCount * sizeof(Ktx2Level) <= fileSize
+				&& (uint64_t) header.kvdByteOffset + header.kvdByteLength <= fileSize;
+
+	const uint8_t* pSourceValue = isValid ? findSourceValue(pFile + header.kvdByteOffset, header.kvdByteLength) : nullptr;
+	TextureCacheSource recorded = { };
+	if (pSourceValue)
+		memcpy(&recorded, pSourceValue, sizeof(recorded));
+	isValid = isValid && pSourceValue
+		   && recorded.version == VERSION && recorded.isSRGB == options.isSRGB
+		   && recorded.isMipmapped == options.isMipmapped && recorded.compression == (uint32_t) options.compression
+		   && recorded.sourceSize == (uint64_t) source.st_size;
+
+	for (uint32_t iLevel = 0; isValid && iLevel < header.levelCount; ++iLevel) {
+		Ktx2Level entry;
+		memcpy(&entry, pFile + sizeof(Ktx2Header) + iLevel * sizeof(Ktx2Level), sizeof(entry));
+		uint32_t levelWidth	 = MipGenerator::LevelSize(header.pixelWidth, iLevel);
+		uint32_t levelHeight = MipGenerator::LevelSize(header.pixelHeight, iLevel);
+		isValid = entry.byteLength == levelBytes(levelWidth, levelHeight, compression)
+			   && entry.byteOffset + entry.byteLength <= fileSize;
+		if (isValid)
+			levelList.push_back({ pFile + entry.byteOffset, (size_t) entry.byteLength, levelWidth, levelHeight });
+	}
+
+	if (isValid && recorded.sourceModifyTime != (uint64_t) source.st_mtime) {
+		uint64_t hash, size, modifyTime;	// timestamp changed, but did contents?
+		isValid = MeshCache::HashFile(sourcePath, hash, size, modifyTime) && hash == recorded.sourceHash;
+		if (isValid) {
+			FILE* pCacheFile = fopen(cachePath.c_str(), "r+b");		// if not, avoid re-hashing next time
+			if (pCacheFile) {
+				TextureCacheSource updated = recorded;
+				updated.sourceModifyTime = modifyTime;
+				fseek(pCacheFile, (long) (pSourceValue - pFile), SEEK_SET);
+				fwrite(&updated, sizeof(updated), 1, pCacheFile);
+				fclose(pCacheFile);
+			}
+		}
+	}
+	if (! isValid) {
+		close();
+		return false;
+	}
+	vkFormat = (VkFormat) header.vkFormat;
+	return true;
+}
+
+void TextureCache::close()
+{
+	mapping.close();
+	vkFormat = VK_FORMAT_UNDEFINED;
+	levelList.clear();
+}
+
+// Decoding is of the one file, on this thread; mips and compression are spread across the pool.
+//
+bool TextureCache::prepare(const string& sourceFullPath, const TextureCacheOptions& options)
+{
+	if (open(sourceFullPath, options))
+		return true;
+
+	TextureCacheSource source = { };
+	source.version		= VERSION;
+	source.isSRGB		= options.isSRGB;
+	source.isMipmapped	= options.isMipmapped;
+	source.compression	= options.compression;
+	vector<vector<uint8_t>> images(1);
+	uint32_t width, height;
+	bool hasAlpha;
+	{
+		MappedFile file(sourceFullPath);
+		if (! file.isOpen()) {
+			Log(ERROR, "TextureCache: can't open %s", sourceFullPath.c_str());
+			return false;
+		}
+		if (! PngDecoder::Decode((const uint8_t*) file.data(), file.size(), images[0], width, height, &hasAlpha)) {
+			Log(ERROR, "TextureCache: '%s' not decoded", sourceFullPath.c_str());
+			return false;
+		}
+		source.sourceHash		= Hash64(file.data(), file.size());
+		source.sourceSize		= file.size();
+		source.sourceModifyTime	= file.mtime();
+	}
+
+	uint32_t numLevels = options.isMipmapped ? MipGenerator::LevelCount(width, height) : 1;
+	images.resize(numLevels);
+	for (uint32_t iLevel = 1; iLevel < numLevels; ++iLevel) {
+		images[iLevel].resize((size_t) MipGenerator::LevelSize(width, iLevel) * MipGenerator::LevelSize(height, iLevel) * 4);
+		MipGenerator::Downsample(images[iLevel - 1].data(), MipGenerator::LevelSize(width, iLevel - 1),
+								 MipGenerator::LevelSize(height, iLevel - 1), options.isSRGB, images[iLevel].data());
+	}
+
+	TextureCompression compression = options.compression;
+	if (compression == TEXTURE_ETC2 && hasAlpha) {
+		Log(RAW, "      TextureCache: '%s' has alpha, so is left uncompressed (ETC2 RGB being opaque)",
+				 sourceFullPath.c_str());
+		compression = TEXTURE_UNCOMPRESSED;
+	}
+	if (compression != TEXTURE_UNCOMPRESSED)
+		for (uint32_t iLevel = 0; iLevel < numLevels; ++iLevel) {
+			uint32_t levelWidth = MipGenerator::LevelSize(width, iLevel), levelHeight = MipGenerator::LevelSize(height, iLevel);
+			vector<uint8_t> blocks(BlockCompressor::CompressedSize(levelWidth, levelHeight, compression));
+			BlockCompressor::Compress(images[iLevel].data(), levelWidth, levelHeight, compression, blocks.data());
+			images[iLevel].swap(blocks);
+		}
+
+	if (cachePath.empty()
+		|| ! writeKtx2(cachePath, compression, options.isSRGB, images, width, height, source))
+		return false;
+	return open(sourceFullPath, options);
+}
+
+
+// As ModelLoader::LoadMany: as many at a time as there are cores, each taking the next not yet started,
+//	largest file first.
+//
+vector<PreparedTexture> TextureCache::PrepareMany(const vector<string>& sourceFullPaths, const TextureCacheOptions& options)
+{
+	vector<PreparedTexture> results(sourceFullPaths.size());
+	vector<size_t> fileBytes(sourceFullPaths.size(), 0);
+	for (size_t iTexture = 0; iTexture < sourceFullPaths.size(); ++iTexture) {
+		struct stat source;
+		if (stat(sourceFullPaths[iTexture].c_str(), &source) == 0)
+			fileBytes[iTexture] = source.st_size;
+	}
+	vector<size_t> largestFirst(sourceFullPaths.size());
+	std::iota(largestFirst.begin(), largestFirst.end(), 0);
+	std::stable_sort(largestFirst.begin(), largestFirst.end(),
+					 [&](size_t a, size_t b) { return fileBytes[a] > fileBytes[b]; });
+
+	WorkerPool& pool = WorkerPool::Shared();
+	std::atomic<size_t> iNext { 0 };
+	pool.parallelFor(std::min<size_t>(pool.concurrency(), sourceFullPaths.size()), [&](size_t) {
+		for (size_t iStarted; (iStarted = iNext.fetch_add(1)) < sourceFullPaths.size(); ) {
+			size_t iTexture = largestFirst[iStarted];
+			PreparedTexture& result = results[iTexture];
+			auto start = std::chrono::steady_clock::now();
+			TextureCache cache;
+			result.wasCached  = cache.open(sourceFullPaths[iTexture], options);
+			result.isPrepared = result.wasCached || cache.prepare(sourceFullPaths[iTexture], options);
+			result.cacheBytes = cache.bytes();
+			result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		}
+	});
+	return results;
+}
@@ -0,0 +1,84 @@
+//
+// TextureCache.h
+//	Vulkan Convenience 3D Objects
+//
+// On-disk cache of a texture already prepared for the GPU - decoded, its
+//	whole mip chain built, and optionally block-compressed - so that later
+//	runs simply memory-map it and upload each level straight from the
+//	mapping (see level()), with no decoding or filtering on the critical
+//	path.  Stored as a KTX2 file in the app's local storage directory, so
+//	standard tools can inspect it.
+// Preparing decodes the PNG (PngDecoder), downsamples each level from the
+//	last (MipGenerator), then compresses each (BlockCompressor), the latter
+//	two spread across the shared WorkerPool; PrepareMany also prepares as
+//	many textures at once as there are cores, biggest first.
+// Validated, as MeshCache is, against its source file by size and time, or
+//	failing that content hash, and against the options it was prepared with;
+//	anything else is a miss, after which it's prepared again.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef TextureCache_h
+#define TextureCache_h
+
+#include "VulkanPlatform.h"
+#include "MappedFile.h"
+#include "BlockCompressor.h"
+
+
+struct TextureCacheOptions {		// how a texture's prepared (a cache prepared otherwise is prepared again)
+	bool				isSRGB		= true;		// color, rather than data (e.g. a normal map): filter in linear light
+	bool				isMipmapped	= true;
+	TextureCompression	compression	= TEXTURE_UNCOMPRESSED;
+};
+
+struct TextureLevel {				// one mip level, ready to copy into a staging buffer
+	const uint8_t*	pData;
+	size_t			numBytes;
+	uint32_t		width;
+	uint32_t		height;
+};
+
+struct PreparedTexture {			// one of PrepareMany's results
+	bool	isPrepared	= false;
+	bool	wasCached	= false;	// (was up to date already, so nothing was decoded)
+	double	seconds		= 0.0;
+	size_t	cacheBytes	= 0;
+};
+
+
+class TextureCache
+{
+public:
+	static const uint32_t VERSION = 1;
+
+		// MEMBERS
+private:
+	string			sourcePath;
+	string			cachePath;
+	MappedFile		mapping;
+	VkFormat		vkFormat = VK_FORMAT_UNDEFINED;
+	vector<TextureLevel> levelList;
+
+		// METHODS
+public:
+	bool open(const string& sourceFullPath, const TextureCacheOptions& options);	// (false if absent or stale)
+	bool prepare(const string& sourceFullPath, const TextureCacheOptions& options);	// open, else prepare it anew
+	void close();
+
+	static string CachePathFor(const string& sourceFullPath);
+	static vector<PreparedTexture> PrepareMany(const vector<string>& sourceFullPaths,	// (results in same order;
+											   const TextureCacheOptions& options);	//	caches left closed)
+
+		// getters (valid after open() or prepare() succeeds)
+	bool				isOpen()		{ return mapping.isOpen(); }
+	VkFormat			format()		{ return vkFormat; }	// (RGBA8, BC7 or ETC2; UNORM or SRGB)
+	uint32_t			width()			{ return levelList.empty() ? 0 : levelList[0].width; }
+	uint32_t			height()		{ return levelList.empty() ? 0 : levelList[0].height; }
+	uint32_t			levelCount()	{ return (uint32_t) levelList.size(); }
+	const TextureLevel&	level(uint32_t iLevel)	{ return levelList[iLevel]; }	// (0 is full size)
+	size_t				bytes()			{ return mapping.size(); }
+};
+
+#endif	// TextureCache_h
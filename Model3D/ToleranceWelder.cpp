@@ -0,0 +1,164 @@
+//
+// ToleranceWelder.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "ToleranceWelder.h"
+#include "WorkerPool.h"
+#include <cstring>
+#include <algorithm>
+#include <cmath>
+
+
+static int64_t cellOf(float coordinate, float cellSize)
+{
+	return std::isfinite(coordinate) ? (int64_t) std::floor((double) coordinate / cellSize) : 0;
+}
+
+// Interleaves the low 21 bits of each cell coordinate (a Morton code), so that sorting by it keeps
+//	neighboring cells mostly near each other in memory.  Cells 2^21 apart share a key: that only adds
+//	candidates, which fail the test.
+static uint64_t spreadBits(int64_t coordinate)
+{
+	uint64_t x = (uint64_t) coordinate & 0x1FFFFF;
+	x = (x | (x << 32)) & 0x1F00000000FFFFULL;
+	x = (x | (x << 16)) & 0x1F0000FF0000FFULL;
+	x = (x | (x << 8))	& 0x100F00F00F00F00FULL;
+	x = (x | (x << 4))	& 0x10C30C30C30C30C3ULL;
+	x = (x | (x << 2))	& 0x1249249249249249ULL;
+	return x;
+}
+
+static uint64_t cellKey(int64_t x, int64_t y, int64_t z)
+{
+	return spreadBits(x) | (spreadBits(y) << 1) | (spreadBits(z) << 2);
+}
+
+struct SortedVertex {
+	uint64_t	cell;
+	uint32_t	index;
+
+	bool operator<(const SortedVertex& other) const
+	{
+		return cell < other.cell || (cell == other.cell && index < other.index);
+	}
+};
+
+static bool isWithin(const float* a, const float* b, int numComponents, float epsilon)
+{
+	for (int i = 0; i < numComponents; ++i)
+		if (! (std::fabs(a[i] - b[i]) <= epsilon))		// (so NaN never matches)
+			return false;
+	return true;
+}
+
+
+size_t ToleranceWelder::Weld(const uint8_t* pVertices, size_t vertexCount, size_t vertexStride,
+							 const WeldLayout& layout, const WeldTolerance& tolerance, std::vector<uint32_t>& remap)
+{
+	remap.resize(vertexCount);
+	for (size_t v = 0; v < vertexCount; ++v)
+		remap[v] = (uint32_t) v;
+	if (vertexCount < 2 || ! (tolerance.position > 0.0f))
+		return vertexCount;
+
+	auto position = [&](size_t v) { return (const float*) (pVertices + v * vertexStride); };
+
+	// Sort vertices by their cell (then by index, so each cell's lowest-numbered come first).
+	WorkerPool& pool = WorkerPool::Shared();
+	size_t numTasks = (vertexCount + VERTICES_PER_TASK - 1) / VERTICES_PER_TASK;
+	float cellSize = 2 * tolerance.position;
+	std::vector<SortedVertex> sorted(vertexCount);
+	pool.parallelFor(numTasks, [&](size_t iTask) {
+		size_t iEnd = std::min(vertexCount, (iTask + 1) * VERTICES_PER_TASK);
+		for (size_t v = iTask * VERTICES_PER_TASK; v < iEnd; ++v) {
+			const float* p = position(v);
+			sorted[v] = { cellKey(cellOf(p[0], cellSize), cellOf(p[1], cellSize), cellOf(p[2], cellSize)),
+						  (uint32_t) v };
+		}
+	});
+	std::sort(sorted.begin(), sorted.end());
+
+	// Gather the vertices into that order too, so candidates are compared where they lie near each other.
+	size_t floatsPerVertex = vertexStride / sizeof(float);
+	std::vector<float> gathered(vertexCount * floatsPerVertex);
+	pool.parallelFor(numTasks, [&](size_t iTask) {
+		size_t iEnd = std::min(vertexCount, (iTask + 1) * VERTICES_PER_TASK);
+		for (size_t iSorted = iTask * VERTICES_PER_TASK; iSorted < iEnd; ++iSorted)
+			memcpy(&gathered[iSorted * floatsPerVertex], position(sorted[iSorted].index), vertexStride);
+	});
+	auto isMatch = [&](size_t iSortedU, size_t iSortedV) {
+		const float* a = &gathered[iSortedU * floatsPerVertex];
+		const float* b = &gathered[iSortedV * floatsPerVertex];
+		return isWithin(a, b, 3, tolerance.position)
+			&& (layout.normal	< 0 || isWithin(a + layout.normal,	 b + layout.normal,	  3, tolerance.normal))
+			&& (layout.texCoord < 0 || isWithin(a + layout.texCoord, b + layout.texCoord, 2, tolerance.texCoord))
+			&& (layout.color	< 0 || isWithin(a + layout.color,	 b + layout.color,	  4, tolerance.color));
+	};
+
+	// Where each cell's run of the sorted order starts, found by open addressing on its (mixed) key.
+	size_t numCells = 1;
+	for (size_t iSorted = 1; iSorted < vertexCount; ++iSorted)
+		numCells += sorted[iSorted].cell != sorted[iSorted - 1].cell;
+	size_t numSlots = 16;
+	while (numSlots < 2 * numCells)		// (kept small, for the lookups' sake)
+		numSlots <<= 1;
+	size_t mask = numSlots - 1;
+	auto slotOf = [&](uint64_t cell) { return (size_t) ((cell * 0x9E3779B185EBCA87ULL) >> 32) & mask; };
+	std::vector<uint32_t> cellStarts(numSlots, UINT32_MAX);
+	for (size_t iSorted = 0; iSorted < vertexCount; ++iSorted)
+		if (iSorted == 0 || sorted[iSorted].cell != sorted[iSorted - 1].cell) {
+			size_t iSlot = slotOf(sorted[iSorted].cell);
+			while (cellStarts[iSlot] != UINT32_MAX)
+				iSlot = (iSlot + 1) & mask;
+			cellStarts[iSlot] = (uint32_t) iSorted;
+		}
+	auto cellStart = [&](uint64_t cell) -> size_t {
+		for (size_t iSlot = slotOf(cell); cellStarts[iSlot] != UINT32_MAX; iSlot = (iSlot + 1) & mask)
+			if (sorted[cellStarts[iSlot]].cell == cell)
+				return cellStarts[iSlot];
+		return vertexCount;
+	};
+
+	// Each vertex finds the lowest-numbered one it matches (if lower than itself) among its cell and those
+	//	neighbors it's nearest: cells being two epsilons wide, anything within one lies no further away than
+	//	the adjacent cell on the near side of each axis - 8 cells in all.  Tasks take runs of the sorted
+	//	order, i.e. whole cells, give or take those at either end.
+	std::vector<uint32_t> firstMatch(vertexCount);
+	pool.parallelFor(numTasks, [&](size_t iTask) {
+		size_t iEnd = std::min(vertexCount, (iTask + 1) * VERTICES_PER_TASK);
+		for (size_t iSorted = iTask * VERTICES_PER_TASK; iSorted < iEnd; ++iSorted) {
+			const SortedVertex& vertex = sorted[iSorted];
+			const float* p = &gathered[iSorted * floatsPerVertex];
+			int64_t cell[3], near[3];
+			for (int axis = 0; axis < 3; ++axis) {
+				cell[axis] = cellOf(p[axis], cellSize);
+				double offset = (double) p[axis] / cellSize - (double) cell[axis];
+				near[axis] = (std::isfinite(p[axis]) && offset < 0.5) ? -1 : 1;
+			}
+			uint32_t lowest = vertex.index;
+			for (int iNeighbor = 0; iNeighbor < 8; ++iNeighbor) {
+				uint64_t key = cellKey(cell[0] + ((iNeighbor & 1) ? near[0] : 0),
+									   cell[1] + ((iNeighbor & 2) ? near[1] : 0),
+									   cell[2] + ((iNeighbor & 4) ? near[2] : 0));
+				for (size_t iCandidate = cellStart(key); iCandidate < vertexCount && sorted[iCandidate].cell == key
+						&& sorted[iCandidate].index < lowest; ++iCandidate)
+					if (isMatch(iCandidate, iSorted)) {
+						lowest = sorted[iCandidate].index;
+						break;		// (the rest of this cell being higher-numbered)
+					}
+			}
+			firstMatch[vertex.index] = lowest;
+		}
+	});
+
+	// Follow each chain down to the vertex it started from, numbering those kept in order.
+	size_t numKept = 0;
+	for (size_t v = 0; v < vertexCount; ++v)
+		remap[v] = (firstMatch[v] == v) ? (uint32_t) numKept++ : remap[firstMatch[v]];
+	return numKept;
+}
@@ -0,0 +1,54 @@
+//
+// ToleranceWelder.h
+//	Vulkan Convenience 3D Objects
+//
+// Welding of vertices that are nearly, rather than bitwise, identical (see
+//	WELD_BY_TOLERANCE): as exporters leave behind when they write the same
+//	position with different rounding, or normals differing in the last ulp.
+//	Vertices match if every component of each attribute is within that
+//	attribute's epsilon (WeldTolerance) of the other's.
+// Positions are quantized to a grid of cells two epsilons wide, so any match
+//	lies in the same cell or, along each axis, the adjacent one on the side
+//	nearer the vertex; vertices are sorted by their cell's Morton code (so
+//	neighboring cells mostly lie near each other), then each looks through
+//	those 8 cells - cells being handed out across the shared WorkerPool -
+//	for the lowest-numbered vertex it matches.
+//	Matches chain, so a vertex merges into whatever its match merged into.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef ToleranceWelder_h
+#define ToleranceWelder_h
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+
+struct WeldTolerance {			// per component, in the model's own units
+	float	position = 1e-5f;
+	float	normal	 = 1e-3f;
+	float	texCoord = 1e-5f;
+	float	color	 = 1e-3f;
+};
+
+struct WeldLayout {				// where each attribute is within a vertex, in floats (-1 if it's absent);
+	int		normal	 = -1;		//	position, always present, is first
+	int		texCoord = -1;
+	int		color	 = -1;
+};
+
+
+class ToleranceWelder
+{
+public:
+	// Returns how many vertices remain; remap[v] becomes the index of the vertex v merges into, in that numbering
+	//	(kept vertices keeping their order, so remap[v] <= v, and each kept vertex is the first in its group).
+	static size_t Weld(const uint8_t* pVertices, size_t vertexCount, size_t vertexStride,
+					   const WeldLayout& layout, const WeldTolerance& tolerance, std::vector<uint32_t>& remap);
+
+	static const size_t VERTICES_PER_TASK = 16 * 1024;
+};
+
+#endif	// ToleranceWelder_h
@@ -0,0 +1,319 @@
+//
+// VertexQuantizer.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "VertexQuantizer.h"
+#include "Vertex3DTypes.h"
+#include "WorkerPool.h"
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+
+using std::vector;
+
+typedef Vertex3DNormalTextureColor	CatchAllVertexType;		// (as ModelLoader's)
+
+
+struct FloatLayout {			// where each attribute is in a VerticesDynamic-packed vertex, in floats (-1 if absent)
+	int		normal	 = -1;
+	int		texCoord = -1;
+	int		color	 = -1;
+	int		numColorComponents = 0;
+	int		numFloats = 0;
+};
+
+static FloatLayout floatLayoutFor(AttributeBits attribits)
+{
+	FloatLayout layout;
+	int offset = 3;
+	if (attribits & Attribits[NORMAL])		{ layout.normal	  = offset;  offset += 3; }
+	if (attribits & Attribits[TEXCOORD])	{ layout.texCoord = offset;  offset += 2; }
+	if (attribits & Attribits[COLOR]) {
+		layout.color = offset;
+		layout.numColorComponents = (int) (sizeof(CatchAllVertexType::color) / sizeof(float));
+		offset += layout.numColorComponents;
+	}
+	layout.numFloats = offset;
+	return layout;
+}
+
+static int16_t snorm16(float value)
+{
+	return (int16_t) lroundf(std::max(-1.0f, std::min(1.0f, value)) * 32767.0f);
+}
+
+static float fromSnorm16(int16_t value)		// (as Vulkan's SNORM formats read it)
+{
+	return std::max(value / 32767.0f, -1.0f);
+}
+
+// IEEE half float, rounded to nearest even; overflow goes to infinity.
+//
+static uint16_t halfFromFloat(float value)
+{
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	uint32_t sign = (bits >> 16) & 0x8000;
+	uint32_t floatExponent = (bits >> 23) & 0xFF;
+	uint32_t mantissa = bits & 0x7FFFFF;
+	if (floatExponent == 0xFF)									// infinity or NaN
+		return (uint16_t) (sign | 0x7C00 | (mantissa ? 0x200 : 0));
+	int32_t exponent = (int32_t) floatExponent - 127 + 15;
+	if (exponent >= 31)
+		return (uint16_t) (sign | 0x7C00);
+	if (exponent <= 0) {										// subnormal (or zero)
+		if (exponent < -10)
+			return (uint16_t) sign;
+		mantissa |= 0x800000;
+		uint32_t shift = (uint32_t) (14 - exponent);
+		uint32_t half = mantissa >> shift;
+		uint32_t rest = mantissa & ((1u << shift) - 1), halfway = 1u << (shift - 1);
+		if (rest > halfway || (rest == halfway && (half & 1)))
+			++half;
+		return (uint16_t) (sign | half);
+	}
+	uint32_t half = sign | ((uint32_t) exponent << 10) | (mantissa >> 13);
+	uint32_t rest = mantissa & 0x1FFF;
+	if (rest > 0x1000 || (rest == 0x1000 && (half & 1)))
+		++half;													// (carrying into exponent if need be)
+	return (uint16_t) half;
+}
+
+static float floatFromHalf(uint16_t half)
+{
+	uint32_t sign = (uint32_t) (half & 0x8000) << 16;
+	uint32_t exponent = (half >> 10) & 0x1F, mantissa = half & 0x3FF;
+	if (exponent == 0) {
+		float value = ldexpf((float) mantissa, -24);
+		return sign ? -value : value;
+	}
+	uint32_t bits = sign | ((exponent == 31) ? (0xFF << 23) : ((exponent + 127 - 15) << 23)) | (mantissa << 13);
+	float value;
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+// Greatest rounding error of a value of this magnitude as a half: half its spacing there.
+//
+static float halfError(float magnitude)
+{
+	if (magnitude > 65504.0f)
+		return INFINITY;
+	int exponent = (magnitude < 6.1035e-5f) ? -14 : (int) floorf(log2f(magnitude));
+	return ldexpf(1.0f, exponent - 10) * 0.5f;
+}
+
+// Unit vector onto the octahedron |x|+|y|+|z| = 1, its lower half folded out over the corners of the upper.
+//
+static void octahedralEncode(const float normal[3], int16_t encoded[2])
+{
+	float sum = fabsf(normal[0]) + fabsf(normal[1]) + fabsf(normal[2]);
+	float x = (sum > 0.0f) ? normal[0] / sum : 0.0f;
+	float y = (sum > 0.0f) ? normal[1] / sum : 0.0f;
+	if (normal[2] < 0.0f) {
+		float foldedX = (1.0f - fabsf(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+		y = (1.0f - fabsf(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+		x = foldedX;
+	}
+	encoded[0] = snorm16(x);
+	encoded[1] = snorm16(y);
+}
+
+static void octahedralDecode(const int16_t encoded[2], float normal[3])	// (as the q16 shaders do)
+{
+	float x = fromSnorm16(encoded[0]), y = fromSnorm16(encoded[1]);
+	float z = 1.0f - fabsf(x) - fabsf(y);
+	float fold = std::max(-z, 0.0f);
+	x += (x >= 0.0f) ? -fold : fold;
+	y += (y >= 0.0f) ? -fold : fold;
+	float length = sqrtf(x * x + y * y + z * z);
+	normal[0] = x / length;
+	normal[1] = y / length;
+	normal[2] = z / length;
+}
+
+template<typename FN>
+static void forEachVertex(size_t vertexCount, FN fn)
+{
+	size_t numTasks = (vertexCount + VertexQuantizer::VERTICES_PER_TASK - 1) / VertexQuantizer::VERTICES_PER_TASK;
+	WorkerPool::Shared().parallelFor(numTasks, [&](size_t iTask) {
+		size_t iBegin = iTask * VertexQuantizer::VERTICES_PER_TASK;
+		fn(iTask, iBegin, std::min(vertexCount, iBegin + VertexQuantizer::VERTICES_PER_TASK));
+	});
+}
+
+
+// Positions' error follows from the bounds alone; texCoords' and colors' from their ranges, found in parallel.
+//
+QuantizedVertexFormat VertexQuantizer::Choose(const uint8_t* pVertices, size_t vertexCount, AttributeBits attribits,
+											  const MeshBounds& bounds, const QuantizationBudget& budget)
+{
+	FloatLayout layout = floatLayoutFor(attribits);
+	const float* floats = (const float*) pVertices;
+
+	struct Range {
+		float texCoordMagnitude = 0.0f;
+		float colorMin = 0.0f, colorMax = 0.0f;
+	};
+	size_t numTasks = (vertexCount + VERTICES_PER_TASK - 1) / VERTICES_PER_TASK;
+	vector<Range> taskRanges(numTasks);
+	forEachVertex(vertexCount, [&](size_t iTask, size_t iBegin, size_t iEnd) {
+		Range& range = taskRanges[iTask];
+		for (size_t v = iBegin; v < iEnd; ++v) {
+			const float* vertex = &floats[v * layout.numFloats];
+			if (layout.texCoord >= 0)
+				range.texCoordMagnitude = std::max({ range.texCoordMagnitude, fabsf(vertex[layout.texCoord]),
+																			  fabsf(vertex[layout.texCoord + 1]) });
+			for (int i = 0; i < layout.numColorComponents; ++i) {
+				range.colorMin = std::min(range.colorMin, vertex[layout.color + i]);
+				range.colorMax = std::max(range.colorMax, vertex[layout.color + i]);
+			}
+		}
+	});
+	Range range;
+	for (const Range& taskRange : taskRanges) {
+		range.texCoordMagnitude = std::max(range.texCoordMagnitude, taskRange.texCoordMagnitude);
+		range.colorMin = std::min(range.colorMin, taskRange.colorMin);
+		range.colorMax = std::max(range.colorMax, taskRange.colorMax);
+	}
+
+	QuantizedVertexFormat format;
+	uint32_t offset = 0;
+	auto add = [&](QuantizedAttribute& attribute, VkFormat vkFormat, uint32_t size) {
+		attribute = { (int32_t) offset, vkFormat };
+		offset += size;
+	};
+
+	float halfExtents[3], positionError = 0.0f;
+	for (int xyz = 0; xyz < 3; ++xyz) {
+		halfExtents[xyz] = (bounds.boundsMax[xyz] - bounds.boundsMin[xyz]) * 0.5f;
+		positionError = std::max(positionError, halfExtents[xyz] / 32767.0f * 0.5f);
+	}
+	if (positionError <= budget.position * bounds.radius && std::isfinite(positionError)) {
+		add(format.position, VK_FORMAT_R16G16B16A16_SNORM, 4 * sizeof(int16_t));	// (w is padding, and 1)
+		for (int xyz = 0; xyz < 3; ++xyz) {
+			format.dequantizeScale[xyz]	 = (halfExtents[xyz] > 0.0f) ? halfExtents[xyz] : 1.0f;
+			format.dequantizeOffset[xyz] = bounds.center[xyz];		// (the box's center)
+		}
+	} else {
+		add(format.position, VK_FORMAT_R32G32B32_SFLOAT, 3 * sizeof(float));
+		for (int xyz = 0; xyz < 3; ++xyz) {
+			format.dequantizeScale[xyz]	 = 1.0f;
+			format.dequantizeOffset[xyz] = 0.0f;
+		}
+	}
+	if (layout.normal >= 0)
+		add(format.normal, VK_FORMAT_R16G16_SNORM, 2 * sizeof(int16_t));
+	if (layout.texCoord >= 0) {
+		if (halfError(range.texCoordMagnitude) <= budget.texCoord)
+			add(format.texCoord, VK_FORMAT_R16G16_SFLOAT, 2 * sizeof(uint16_t));
+		else
+			add(format.texCoord, VK_FORMAT_R32G32_SFLOAT, 2 * sizeof(float));
+	}
+	if (layout.color >= 0) {
+		if (range.colorMin >= 0.0f && range.colorMax <= 1.0f && 0.5f / 255 <= budget.color)
+			add(format.color, VK_FORMAT_R8G8B8A8_UNORM, 4 * sizeof(uint8_t));
+		else if (layout.numColorComponents == 4)
+			add(format.color, VK_FORMAT_R32G32B32A32_SFLOAT, 4 * sizeof(float));
+		else
+			add(format.color, VK_FORMAT_R32G32B32_SFLOAT, 3 * sizeof(float));
+	}
+	format.stride = offset;
+	return format;
+}
+
+void VertexQuantizer::Quantize(const uint8_t* pVertices, size_t vertexCount, AttributeBits attribits,
+							   const QuantizedVertexFormat& format, vector<uint8_t>& quantized)
+{
+	FloatLayout layout = floatLayoutFor(attribits);
+	const float* floats = (const float*) pVertices;
+	quantized.assign(vertexCount * format.stride, 0);
+
+	forEachVertex(vertexCount, [&](size_t, size_t iBegin, size_t iEnd) {
+		for (size_t v = iBegin; v < iEnd; ++v) {
+			const float* vertex = &floats[v * layout.numFloats];
+			uint8_t* pOut = &quantized[v * format.stride];
+
+			if (format.position.format == VK_FORMAT_R16G16B16A16_SNORM) {
+				int16_t position[4];
+				for (int xyz = 0; xyz < 3; ++xyz)
+					position[xyz] = snorm16((vertex[xyz] - format.dequantizeOffset[xyz]) / format.dequantizeScale[xyz]);
+				position[3] = 32767;
+				memcpy(pOut + format.position.offset, position, sizeof(position));
+			} else
+				memcpy(pOut + format.position.offset, vertex, 3 * sizeof(float));
+
+			if (layout.normal >= 0) {
+				int16_t normal[2];
+				octahedralEncode(&vertex[layout.normal], normal);
+				memcpy(pOut + format.normal.offset, normal, sizeof(normal));
+			}
+			if (layout.texCoord >= 0) {
+				if (format.texCoord.format == VK_FORMAT_R16G16_SFLOAT) {
+					uint16_t texCoord[2] = { halfFromFloat(vertex[layout.texCoord]), halfFromFloat(vertex[layout.texCoord + 1]) };
+					memcpy(pOut + format.texCoord.offset, texCoord, sizeof(texCoord));
+				} else
+					memcpy(pOut + format.texCoord.offset, &vertex[layout.texCoord], 2 * sizeof(float));
+			}
+			if (layout.color >= 0) {
+				if (format.color.format == VK_FORMAT_R8G8B8A8_UNORM) {
+					uint8_t color[4] = { 0, 0, 0, 255 };
+					for (int i = 0; i < layout.numColorComponents; ++i)
+						color[i] = (uint8_t) lroundf(vertex[layout.color + i] * 255.0f);
+					memcpy(pOut + format.color.offset, color, sizeof(color));
+				} else
+					memcpy(pOut + format.color.offset, &vertex[layout.color], layout.numColorComponents * sizeof(float));
+			}
+		}
+	});
+}
+
+void VertexQuantizer::Dequantize(const uint8_t* pQuantized, size_t vertexCount, AttributeBits attribits,
+								 const QuantizedVertexFormat& format, vector<uint8_t>& vertices)
+{
+	FloatLayout layout = floatLayoutFor(attribits);
+	vertices.assign(vertexCount * layout.numFloats * sizeof(float), 0);
+	float* floats = (float*) vertices.data();
+
+	forEachVertex(vertexCount, [&](size_t, size_t iBegin, size_t iEnd) {
+		for (size_t v = iBegin; v < iEnd; ++v) {
+			float* vertex = &floats[v * layout.numFloats];
+			const uint8_t* pIn = &pQuantized[v * format.stride];
+
+			if (format.position.format == VK_FORMAT_R16G16B16A16_SNORM) {
+				int16_t position[4];
+				memcpy(position, pIn + format.position.offset, sizeof(position));
+				for (int xyz = 0; xyz < 3; ++xyz)
+					vertex[xyz] = format.dequantizeOffset[xyz] + format.dequantizeScale[xyz] * fromSnorm16(position[xyz]);
+			} else
+				memcpy(vertex, pIn + format.position.offset, 3 * sizeof(float));
+
+			if (layout.normal >= 0) {
+				int16_t normal[2];
+				memcpy(normal, pIn + format.normal.offset, sizeof(normal));
+				octahedralDecode(normal, &vertex[layout.normal]);
+			}
+			if (layout.texCoord >= 0) {
+				if (format.texCoord.format == VK_FORMAT_R16G16_SFLOAT) {
+					uint16_t texCoord[2];
+					memcpy(texCoord, pIn + format.texCoord.offset, sizeof(texCoord));
+					vertex[layout.texCoord]		= floatFromHalf(texCoord[0]);
+					vertex[layout.texCoord + 1] = floatFromHalf(texCoord[1]);
+				} else
+					memcpy(&vertex[layout.texCoord], pIn + format.texCoord.offset, 2 * sizeof(float));
+			}
+			if (layout.color >= 0) {
+				if (format.color.format == VK_FORMAT_R8G8B8A8_UNORM)
+					for (int i = 0; i < layout.numColorComponents; ++i)
+						vertex[layout.color + i] = pIn[format.color.offset + i] / 255.0f;
+				else
+					memcpy(&vertex[layout.color], pIn + format.color.offset, layout.numColorComponents * sizeof(float));
+			}
+		}
+	});
+}
@@ -0,0 +1,74 @@
+//
+// VertexQuantizer.h
+//	Vulkan Convenience 3D Objects
+//
+// Compact vertex formats: each attribute packed into as few bits as the
+//	mesh allows within an error budget, cutting vertex memory and fetch
+//	bandwidth about 2-2.5x (a position+normal+texCoord+color vertex drops
+//	from 48 bytes to 20; position+normal+texCoord from 32 to 16):
+//	- positions as 16-bit snorm, relative to the mesh's bounding box, so a
+//		per-mesh transform (dequantizeScale/Offset) restores model space.
+//	- normals octahedral-encoded: the unit sphere folded onto a square, held
+//		as two 16-bit snorms, within about 0.01 degree.
+//	- texCoords as half floats, if their range keeps those precise enough.
+//	- colors as 8-bit unorms, if within 0..1.
+//	Positions, texCoords or colors that would exceed the budget stay 32-bit
+//	floats; shaders read them the same way regardless (the Vulkan formats do
+//	the converting), so one shader serves either.  Normals are always
+//	octahedral, as the shaders decode them explicitly.
+// Attributes keep VerticesDynamic's order, each 4-byte aligned.  Renderers
+//	bind them per QuantizedVertexFormat's formats and offsets (not the
+//	MeshObject's vertexType, which describes the float layout) and pass
+//	dequantizeScale/Offset to the vertex shader: see shaders/q16*.vert.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef VertexQuantizer_h
+#define VertexQuantizer_h
+
+#include "VerticesDynamic.h"
+#include "MeshGeometry.h"
+
+
+struct QuantizationBudget {		// greatest error allowed per component:
+	float	position = 1e-4f;	//	as a fraction of the mesh's bounding sphere radius
+	float	texCoord = 1.0f / 2048;	//	(enough for 0..1 texCoords to be halfs)
+	float	color	 = 1.0f / 255;
+};
+
+struct QuantizedAttribute {
+	int32_t		offset = -1;	// bytes into the vertex (-1 if absent)
+	VkFormat	format = VK_FORMAT_UNDEFINED;
+};
+
+struct QuantizedVertexFormat {
+	uint32_t	stride = 0;
+	QuantizedAttribute position;
+	QuantizedAttribute normal;
+	QuantizedAttribute texCoord;
+	QuantizedAttribute color;
+	float		dequantizeScale[3];		// position = dequantizeOffset + dequantizeScale * (as read)
+	float		dequantizeOffset[3];	//	(1 and 0 if positions stay floats)
+};
+
+
+class VertexQuantizer
+{
+public:
+	// The most compact format within budget, for vertices packed as VerticesDynamic does per 'attribits'.
+	static QuantizedVertexFormat Choose(const uint8_t* pVertices, size_t vertexCount, AttributeBits attribits,
+										const MeshBounds& bounds, const QuantizationBudget& budget);
+
+	// Packs vertices into 'quantized' per 'format' (in parallel, on the shared WorkerPool).
+	static void Quantize(const uint8_t* pVertices, size_t vertexCount, AttributeBits attribits,
+						 const QuantizedVertexFormat& format, std::vector<uint8_t>& quantized);
+
+	// The reverse, back into VerticesDynamic's packing, for any CPU-side use of a quantized mesh.
+	static void Dequantize(const uint8_t* pQuantized, size_t vertexCount, AttributeBits attribits,
+						   const QuantizedVertexFormat& format, std::vector<uint8_t>& vertices);
+
+	static const size_t VERTICES_PER_TASK = 16 * 1024;
+};
+
+#endif	// VertexQuantizer_h
@@ -0,0 +1,177 @@
+//
+// WeldTable.h
+//	Vulkan Convenience 3D Objects
+//
+// Vertex "welding" (deduplication) table: maps each distinct key - either a
+//	whole vertex, or the OBJ index triplet that produced it - to the index of
+//	its first occurrence.  In lieu of std::unordered_map (a heap node per
+//	entry, a weak hash, and typically multiple lookups per corner) this uses:
+//	- flat open addressing with linear probing, 8 bytes per slot, holding
+//		part of the hash as a "tag" so mismatches rarely touch the key itself.
+//	- keys stored contiguously, in insertion order, i.e. by vertex index.
+//	- Hash64 over the key's raw bytes.  Equality is likewise bytewise, so
+//		KEY must be trivially-copyable and its padding (if any) zeroed.
+//	- a single probe sequence per lookup, which either finds or inserts.
+//	- capacity pre-sized from the caller's estimate (e.g. derived from the
+//		number of face corners), growing only if that estimate proves low.
+// WeldIndex is the same minus the keys: for when they already live elsewhere
+//	(e.g. packed in the vertex buffer being built), so needn't be duplicated.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef WeldTable_h
+#define WeldTable_h
+
+#include "Hash64.h"
+#include <vector>
+#include <cstring>
+
+
+template<typename KEY>
+class WeldTable
+{
+	struct Slot {
+		uint32_t tag;		// upper half of key's hash
+		uint32_t iPlusOne;	// key's index + 1, or 0 if slot is empty
+	};
+	std::vector<Slot>	slots;
+	std::vector<KEY>	keys;
+	size_t				mask = 0;
+
+	static const size_t MAX_LOAD_PERCENT = 70;
+
+public:
+	WeldTable(size_t expectedCount = 0)	{ reserve(expectedCount); }
+
+	size_t size()				{ return keys.size(); }
+	const KEY& key(uint32_t i)	{ return keys[i]; }
+	size_t memoryUsed()			{ return slots.capacity() * sizeof(Slot) + keys.capacity() * sizeof(KEY); }
+	size_t growthBytes()		// more that next insertion may briefly need, if it must grow (presuming vector doubles)
+	{
+		return (((keys.size() + 1) * 100 > slots.size() * MAX_LOAD_PERCENT) ? 2 * slots.size() * sizeof(Slot) : 0)
+			 + ((keys.size() == keys.capacity()) ? 2 * keys.capacity() * sizeof(KEY) : 0);
+	}
+
+	void reserve(size_t expectedCount)
+	{
+		size_t capacity = 16;
+		while (capacity * MAX_LOAD_PERCENT / 100 < expectedCount)
+			capacity <<= 1;
+		if (capacity > slots.size())
+			rehash(capacity);
+	}
+
+	// Returns index of 'key', either pre-existing, or if new (isNew = true) the one it's now assigned.
+	//
+	uint32_t findOrInsert(const KEY& key, bool& isNew)
+	{
+		uint64_t hash = Hash64(&key, sizeof(KEY));
+		uint32_t tag = (uint32_t) (hash >> 32);
+
+		for (size_t iSlot = (size_t) hash & mask; ; iSlot = (iSlot + 1) & mask) {
+			Slot& slot = slots[iSlot];
+			if (slot.iPlusOne == 0) {
+				if ((keys.size() + 1) * 100 > slots.size() * MAX_LOAD_PERCENT) {
+					rehash(slots.size() * 2);
+					return findOrInsert(key, isNew);	// (once; now it fits)
+				}
+				keys.push_back(key);
+				slot = { tag, (uint32_t) keys.size() };
+				isNew = true;
+				return slot.iPlusOne - 1;
+			}
+			if (slot.tag == tag && memcmp(&keys[slot.iPlusOne - 1], &key, sizeof(KEY)) == 0) {
+				isNew = false;
+				return slot.iPlusOne - 1;
+			}
+		}
+	}
+
+private:
+	void rehash(size_t capacity)
+	{
+		slots.assign(capacity, Slot { 0, 0 });
+		mask = capacity - 1;
+		for (uint32_t iKey = 0; iKey < (uint32_t) keys.size(); ++iKey) {
+			uint64_t hash = Hash64(&keys[iKey], sizeof(KEY));
+			size_t iSlot = (size_t) hash & mask;
+			while (slots[iSlot].iPlusOne != 0)
+				iSlot = (iSlot + 1) & mask;
+			slots[iSlot] = { (uint32_t) (hash >> 32), iKey + 1 };
+		}
+	}
+};
+
+
+// Caller hashes its key, and supplies isMatch(i) comparing it to its i-th key; new keys get index size().
+//	The slot's tag doubles as its home position, so growing needn't revisit (or re-hash) the keys.
+//
+class WeldIndex
+{
+	struct Slot {
+		uint32_t tag;
+		uint32_t iPlusOne;
+	};
+	std::vector<Slot>	slots;
+	uint32_t			numKeys = 0;
+	size_t				mask = 0;
+
+	static const size_t MAX_LOAD_PERCENT = 70;
+
+public:
+	WeldIndex(size_t expectedCount = 0)
+	{
+		size_t capacity = 16;
+		while (capacity * MAX_LOAD_PERCENT / 100 < expectedCount)
+			capacity <<= 1;
+		rehash(capacity);
+	}
+
+	size_t size()		{ return numKeys; }
+	size_t memoryUsed()	{ return slots.capacity() * sizeof(Slot); }
+	size_t growthBytes()
+	{
+		return ((numKeys + 1) * 100 > slots.size() * MAX_LOAD_PERCENT) ? 2 * slots.size() * sizeof(Slot) : 0;
+	}
+
+	template<typename MATCHES>
+	uint32_t findOrInsert(uint64_t hash, MATCHES isMatch, bool& isNew)
+	{
+		uint32_t tag = (uint32_t) (hash >> 32);
+
+		for (size_t iSlot = tag & mask; ; iSlot = (iSlot + 1) & mask) {
+			Slot& slot = slots[iSlot];
+			if (slot.iPlusOne == 0) {
+				if ((numKeys + 1) * 100 > slots.size() * MAX_LOAD_PERCENT) {
+					rehash(slots.size() * 2);
+					return findOrInsert(hash, isMatch, isNew);
+				}
+				slot = { tag, ++numKeys };
+				isNew = true;
+				return slot.iPlusOne - 1;
+			}
+			if (slot.tag == tag && isMatch(slot.iPlusOne - 1)) {
+				isNew = false;
+				return slot.iPlusOne - 1;
+			}
+		}
+	}
+
+private:
+	void rehash(size_t capacity)
+	{
+		std::vector<Slot> previous(capacity, Slot { 0, 0 });
+		previous.swap(slots);
+		mask = capacity - 1;
+		for (const Slot& slot : previous)
+			if (slot.iPlusOne != 0) {
+				size_t iSlot = slot.tag & mask;
+				while (slots[iSlot].iPlusOne != 0)
+					iSlot = (iSlot + 1) & mask;
+				slots[iSlot] = slot;
+			}
+	}
+};
+
+#endif	// WeldTable_h
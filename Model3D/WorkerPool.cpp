@@ -0,0 +1,106 @@
+//
+// WorkerPool.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Main comment in header file.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "WorkerPool.h"
+
+
+WorkerPool::WorkerPool(unsigned numThreads)
+{
+	if (numThreads == 0) {
+		unsigned numCores = std::thread::hardware_concurrency();
+		numThreads = (numCores > 1) ? numCores - 1 : 1;
+	}
+	for (unsigned iThread = 0; iThread < numThreads; ++iThread)
+		threads.emplace_back(&WorkerPool::workerLoop, this);
+}
+
+WorkerPool::~WorkerPool()
+{
+	{	std::lock_guard<std::mutex> lock(mutex);
+		isQuitting = true;
+	}
+	wakeup.notify_all();
+	for (auto& thread : threads)
+		thread.join();
+}
+
+WorkerPool& WorkerPool::Shared()
+{
+	static WorkerPool shared;
+	return shared;
+}
+
+
+void WorkerPool::workerLoop()
+{
+	for (;;) {
+		std::function<void()> task;
+		{	std::unique_lock<std::mutex> lock(mutex);
+			wakeup.wait(lock, [this] { return isQuitting || ! queue.empty(); });
+			if (queue.empty())		// (so quitting still drains whatever's queued)
+				return;
+			task = std::move(queue.front());
+			queue.pop_front();
+		}
+		task();
+	}
+}
+
+void WorkerPool::enqueue(std::function<void()> task)
+{
+	{	std::lock_guard<std::mutex> lock(mutex);
+		queue.push_back(std::move(task));
+	}
+	wakeup.notify_one();
+}
+
+
+// Items are handed out one at a time from a shared counter, so uneven work per item self-balances.
+//	State lives on the heap because helpers that only get scheduled after all items are finished
+//	(e.g. the pool was busy) still need something valid to look at, after we've returned.
+//
+void WorkerPool::parallelFor(size_t count, std::function<void(size_t)> fn)
+{
+	if (count == 0)
+		return;
+	if (count == 1) {
+		fn(0);
+		return;
+	}
+	struct Shared {
+		std::function<void(size_t)>	fn;
+		std::atomic<size_t>			iNext { 0 };
+		std::atomic<size_t>			numDone { 0 };
+		size_t						count;
+		std::mutex					mutex;
+		std::condition_variable		finished;
+
+		void drain() {
+			size_t numDoneHere = 0;
+			for (size_t i; (i = iNext.fetch_add(1)) < count; ++numDoneHere)
+				fn(i);
+			if (numDoneHere > 0 && numDone.fetch_add(numDoneHere) + numDoneHere == count) {
+				std::lock_guard<std::mutex> lock(mutex);
+				finished.notify_all();
+			}
+		}
+	};
+	auto pShared = std::make_shared<Shared>();
+	pShared->fn = std::move(fn);
+	pShared->count = count;
+
+	size_t numHelpers = std::min(count - 1, threads.size());
+	for (size_t iHelper = 0; iHelper < numHelpers; ++iHelper)
+		enqueue([pShared]() { pShared->drain(); });
+
+	pShared->drain();
+
+	std::unique_lock<std::mutex> lock(pShared->mutex);
+	pShared->finished.wait(lock, [&] { return pShared->numDone.load() == count; });
+}
@@ -0,0 +1,68 @@
+//
+// WorkerPool.h
+//	Vulkan Convenience 3D Objects
+//
+// Small persistent pool of worker threads, shared process-wide, so loaders
+//	can spread parsing/welding across cores without spawning threads anew
+//	for every model.  Two ways in:
+//	- parallelFor(count, fn) calls fn(i) for every i < count and blocks
+//		until all are done.  The calling thread pitches-in too, so it's safe
+//		to call from within a worker (nested) without deadlocking the pool.
+//	- submit(fn) queues fn to run "whenever" and returns a std::future.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#ifndef WorkerPool_h
+#define WorkerPool_h
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <deque>
+#include <vector>
+#include <algorithm>
+
+
+class WorkerPool
+{
+public:
+	WorkerPool(unsigned numThreads = 0);	// 0 means: one per hardware core (minus this one)
+	~WorkerPool();
+
+	static WorkerPool& Shared();
+
+		// MEMBERS
+private:
+	std::vector<std::thread>			threads;
+	std::deque<std::function<void()>>	queue;
+	std::mutex							mutex;
+	std::condition_variable				wakeup;
+	bool								isQuitting = false;
+
+		// METHODS
+private:
+	void workerLoop();
+	void enqueue(std::function<void()> task);
+
+public:
+	unsigned numThreads()	{ return (unsigned) threads.size(); }
+	unsigned concurrency()	{ return numThreads() + 1; }	// workers plus whoever's calling
+
+	template<typename FN>
+	auto submit(FN fn) -> std::future<decltype(fn())>
+	{
+		auto pTask = std::make_shared<std::packaged_task<decltype(fn())()>>(std::move(fn));
+		auto future = pTask->get_future();
+		enqueue([pTask]() { (*pTask)(); });
+		return future;
+	}
+
+	void parallelFor(size_t count, std::function<void(size_t)> fn);
+};
+
+#endif	// WorkerPool_h
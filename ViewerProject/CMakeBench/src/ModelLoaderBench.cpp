@@ -0,0 +1,352 @@
+//
+// ModelLoaderBench.cpp
+//	Headless ModelLoader benchmark
+//
+// Loads viking_room.obj plus synthetic grid meshes (1K to 10M triangles,
+//	written as OBJ, and also as binary PLY and .glb for those loaders) through
+//	every loader path - tinyobj, FastObjParser, StreamingObjLoader, each
+//	welding by value then by index, and the MeshCache warm start (raw and
+//	compressed), PlyLoader, GlbLoader - with no window, GPU, or SDL involved.  Each path is run a few
+//	times, keeping the fastest; the file's already in the OS's page cache by
+//	then (it was just written), so this measures parsing, not disk.
+// Results go to a CSV file (one row per model and path), with a readable
+//	summary on stdout after ModelLoader's own logging:
+//		model,loader,weld,triangles,file_mb,parse_ms,weld_ms,total_ms,mb_per_s,
+//		peak_rss_mb,vertices,vertices_culled
+//	Peak RSS is per run where Linux allows resetting it (/proc/self/clear_refs),
+//	otherwise the process's peak so far.
+// Usage:  ModelLoaderBench [--max-triangles N] [--repeat N] [--optimize] [--csv file] [--keep]
+//	--optimize includes MeshOptimizer's reordering in total (off by default, to time loading alone);
+//	--keep leaves the synthetic models in the models directory.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "ModelLoader.h"
+#include "MeshCache.h"
+#include "AppConstants.h"
+#include "Logging.h"
+#include <cmath>
+#include <sys/resource.h>
+
+
+struct LoaderPath {
+	const char*	name;
+	SpecType	type;
+	WeldMode	weld;
+	bool		isCached;
+	bool		isCompressed;
+	const char*	extension;
+};
+
+static const LoaderPath LoaderPaths[] = {
+	{ "tinyobj",  OBJ_FILE_TINY,	 WELD_BY_VALUE, false, false, ".obj" },
+	{ "tinyobj",  OBJ_FILE_TINY,	 WELD_BY_INDEX, false, false, ".obj" },
+	{ "fast",	  OBJ_FILE_FAST,	 WELD_BY_VALUE, false, false, ".obj" },
+	{ "fast",	  OBJ_FILE_FAST,	 WELD_BY_INDEX, false, false, ".obj" },
+	{ "fast",	  OBJ_FILE_FAST,	 WELD_BY_TOLERANCE, false, false, ".obj" },
+	{ "streamed", OBJ_FILE_STREAMED, WELD_BY_VALUE, false, false, ".obj" },
+	{ "streamed", OBJ_FILE_STREAMED, WELD_BY_INDEX, false, false, ".obj" },
+	{ "cache",	  OBJ_FILE_FAST,	 WELD_BY_VALUE, true,  false, ".obj" },
+	{ "codec",	  OBJ_FILE_FAST,	 WELD_BY_VALUE, true,  true,  ".obj" },	// (compressed cache)
+	{ "ply",	  PLY_BINARY,		 WELD_BY_VALUE, false, false, ".ply" },
+	{ "glb",	  GLTF_BINARY,		 WELD_BY_VALUE, false, false, ".glb" },
+};
+
+static const size_t TriangleCounts[] = { 1000, 10000, 100000, 1000000, 10000000 };
+
+
+// PEAK MEMORY
+
+static void resetPeakRSS()
+{
+	FILE* file = fopen("/proc/self/clear_refs", "w");
+	if (file) {
+		fputs("5", file);
+		fclose(file);
+	}
+}
+
+static double peakRSSMB()
+{
+	FILE* file = fopen("/proc/self/status", "r");
+	if (file) {
+		char line[256];
+		long kilobytes = -1;
+		while (fgets(line, sizeof(line), file))
+			if (sscanf(line, "VmHWM: %ld kB", &kilobytes) == 1)
+				break;
+		fclose(file);
+		if (kilobytes >= 0)
+			return kilobytes / 1024.0;
+	}
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_maxrss / 1024.0;		// (kilobytes, on Linux)
+}
+
+
+// SYNTHETIC MODELS
+//	A square grid of gently rolling terrain, n by n vertices, each with position, normal and texCoord,
+//	so (n - 1)^2 quads of two triangles.  Vertices shared among faces as any exporter would write them.
+
+struct Grid {
+	size_t n;
+	size_t numVertices()	{ return n * n; }
+	size_t numTriangles()	{ return 2 * (n - 1) * (n - 1); }
+
+	void vertex(size_t i, float* out)	// position xyz, normal xyz, texCoord uv
+	{
+		float x = (float) (i % n), y = (float) (i / n);
+		float dzdx = 0.3f * cosf(0.3f * x) * cosf(0.2f * y), dzdy = -0.2f * sinf(0.3f * x) * sinf(0.2f * y);
+		float length = sqrtf(dzdx * dzdx + dzdy * dzdy + 1.0f);
+		float values[8] = { x, y, sinf(0.3f * x) * cosf(0.2f * y),
+							-dzdx / length, -dzdy / length, 1.0f / length, x / (n - 1), y / (n - 1) };
+		memcpy(out, values, sizeof(values));
+	}
+	void triangle(size_t iTriangle, uint32_t* corners)
+	{
+		size_t iQuad = iTriangle / 2, x = iQuad % (n - 1), y = iQuad / (n - 1);
+		uint32_t a = (uint32_t) (y * n + x);
+		uint32_t quad[2][3] = { { a, a + 1, a + (uint32_t) n }, { a + 1, a + (uint32_t) n + 1, a + (uint32_t) n } };
+		memcpy(corners, quad[iTriangle % 2], sizeof(quad[0]));
+	}
+};
+
+static Grid gridFor(size_t numTriangles)
+{
+	return Grid { (size_t) ceil(sqrt(numTriangles / 2.0)) + 1 };
+}
+
+static bool writeOBJ(const string& path, Grid grid)
+{
+	FILE* file = fopen(path.c_str(), "wb");
+	if (! file)
+		return false;
+	float v[8];
+	for (size_t i = 0; i < grid.numVertices(); ++i) {
+		grid.vertex(i, v);
+		fprintf(file, "v %.4f %.4f %.4f\nvn %.4f %.4f %.4f\nvt %.4f %.4f\n", v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7]);
+	}
+	uint32_t c[3];
+	for (size_t i = 0; i < grid.numTriangles(); ++i) {
+		grid.triangle(i, c);
+		fprintf(file, "f %u/%u/%u %u/%u/%u %u/%u/%u\n", c[0] + 1, c[0] + 1, c[0] + 1, c[1] + 1, c[1] + 1, c[1] + 1,
+														c[2] + 1, c[2] + 1, c[2] + 1);
+	}
+	return fclose(file) == 0;
+}
+
+static bool writePLY(const string& path, Grid grid)
+{
+	FILE* file = fopen(path.c_str(), "wb");
+	if (! file)
+		return false;
+	fprintf(file, "ply\nformat binary_little_endian 1.0\nelement vertex %zu\n"
+				  "property float x\nproperty float y\nproperty float z\n"
+				  "property float nx\nproperty float ny\nproperty float nz\n"
+				  "property float u\nproperty float v\n"
+				  "element face %zu\nproperty list uchar uint vertex_indices\nend_header\n",
+			grid.numVertices(), grid.numTriangles());
+	float v[8];
+	for (size_t i = 0; i < grid.numVertices(); ++i) {
+		grid.vertex(i, v);
+		fwrite(v, sizeof(v), 1, file);
+	}
+	uint8_t face[1 + 3 * sizeof(uint32_t)] = { 3 };
+	for (size_t i = 0; i < grid.numTriangles(); ++i) {
+		grid.triangle(i, (uint32_t*) &face[1]);		// (x86/ARM: unaligned is fine; file is little-endian as are they)
+		fwrite(face, sizeof(face), 1, file);
+	}
+	return fclose(file) == 0;
+}
+
+// Interleaved exactly as VerticesDynamic would pack it, so GlbLoader loads it in place.
+//
+static bool writeGLB(const string& path, Grid grid)
+{
+	FILE* file = fopen(path.c_str(), "wb");
+	if (! file)
+		return false;
+	size_t vertexBytes = grid.numVertices() * 8 * sizeof(float);
+	size_t indexSize   = (grid.numVertices() <= 65536) ? sizeof(uint16_t) : sizeof(uint32_t);
+	size_t indexBytes  = grid.numTriangles() * 3 * indexSize;
+	size_t binaryBytes = (vertexBytes + indexBytes + 3) & ~(size_t) 3;
+	char json[1024];
+	snprintf(json, sizeof(json),
+		"{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"byteLength\":%zu}],"
+		"\"bufferViews\":[{\"buffer\":0,\"byteLength\":%zu,\"byteStride\":32},"
+						 "{\"buffer\":0,\"byteOffset\":%zu,\"byteLength\":%zu}],"
+		"\"accessors\":[{\"bufferView\":0,\"componentType\":5126,\"count\":%zu,\"type\":\"VEC3\"},"
+					   "{\"bufferView\":0,\"byteOffset\":12,\"componentType\":5126,\"count\":%zu,\"type\":\"VEC3\"},"
+					   "{\"bufferView\":0,\"byteOffset\":24,\"componentType\":5126,\"count\":%zu,\"type\":\"VEC2\"},"
+					   "{\"bufferView\":1,\"componentType\":%d,\"count\":%zu,\"type\":\"SCALAR\"}],"
+		"\"meshes\":[{\"primitives\":[{\"attributes\":{\"POSITION\":0,\"NORMAL\":1,\"TEXCOORD_0\":2},\"indices\":3}]}]}",
+		binaryBytes, vertexBytes, vertexBytes, indexBytes, grid.numVertices(), grid.numVertices(), grid.numVertices(),
+		indexSize == sizeof(uint16_t) ? 5123 : 5125, grid.numTriangles() * 3);
+	string jsonChunk = json;
+	jsonChunk.resize((jsonChunk.size() + 3) & ~(size_t) 3, ' ');
+	uint32_t header[5] = { 0x46546C67, 2, (uint32_t) (12 + 8 + jsonChunk.size() + 8 + binaryBytes),
+						   (uint32_t) jsonChunk.size(), 0x4E4F534A };
+	uint32_t binaryHeader[2] = { (uint32_t) binaryBytes, 0x004E4942 };
+	fwrite(header, sizeof(header), 1, file);
+	fwrite(jsonChunk.data(), jsonChunk.size(), 1, file);
+	fwrite(binaryHeader, sizeof(binaryHeader), 1, file);
+	float v[8];
+	for (size_t i = 0; i < grid.numVertices(); ++i) {
+		grid.vertex(i, v);
+		fwrite(v, sizeof(v), 1, file);
+	}
+	uint32_t c[3];
+	for (size_t i = 0; i < grid.numTriangles(); ++i) {
+		grid.triangle(i, c);
+		uint16_t small[3] = { (uint16_t) c[0], (uint16_t) c[1], (uint16_t) c[2] };
+		fwrite(indexSize == sizeof(uint16_t) ? (void*) small : (void*) c, indexSize, 3, file);
+	}
+	uint32_t padding = 0;
+	fwrite(&padding, binaryBytes - vertexBytes - indexBytes, 1, file);
+	return fclose(file) == 0;
+}
+
+
+// RUNNING
+
+struct Result {
+	LoadTimings	timings;
+	double		peakRSS	 = 0.0;
+	uint32_t	vertices = 0;
+	uint32_t	triangles = 0;
+	int			culled	 = 0;
+	bool		isOK	 = false;
+};
+
+static Result runOnce(const string& filename, const LoaderPath& path, bool isOptimized)
+{
+	Result result;
+	resetPeakRSS();
+	{
+		VertexDescriptionDynamic vertexDescriptor;
+		MeshObject mesh = { vertexDescriptor };
+		ModelLoader loader;
+		ModelDefSpec spec;
+		spec.filename	 = filename;
+		spec.type		 = path.type;
+		spec.weld		 = path.weld;
+		spec.isCached	 = path.isCached;
+		spec.isCompressed = path.isCompressed;
+		spec.isOptimized = isOptimized;
+		result.isOK		= loader.load(mesh, spec);
+		result.timings	= loader.timings();
+		result.vertices	= mesh.vertexCount;
+		result.triangles = mesh.indexCount / 3;
+		result.culled	= loader.redundantVertices();
+		result.peakRSS	= peakRSSMB();
+	}
+	return result;
+}
+
+static Result runBest(const string& filename, const LoaderPath& path, bool isOptimized, int repeat)
+{
+	if (path.isCached)
+		runOnce(filename, path, isOptimized);		// (cold: writes the cache the timed runs start from)
+	Result best;
+	for (int i = 0; i < repeat; ++i) {
+		Result result = runOnce(filename, path, isOptimized);
+		if (! result.isOK)
+			return result;
+		if (! best.isOK || result.timings.total < best.timings.total) {
+			double peak = max(best.peakRSS, result.peakRSS);
+			best = result;
+			best.peakRSS = peak;
+		}
+	}
+	return best;
+}
+
+
+int main(int argc, char* argv[])
+{
+	AppConstants.setExePath(argv[0]);		// (as in the viewer's main, for FileSystem's paths)
+	LogStartup();
+
+	size_t maxTriangles = 10000000;
+	int	   repeat		= 3;
+	bool   isOptimized	= false;
+	bool   isKept		= false;
+	string csvPath		= "ModelLoaderBench.csv";
+	for (int iArg = 1; iArg < argc; ++iArg) {
+		string arg = argv[iArg];
+		bool hasValue = iArg + 1 < argc;
+		if (arg == "--max-triangles" && hasValue)	maxTriangles = strtoull(argv[++iArg], nullptr, 10);
+		else if (arg == "--repeat" && hasValue)		repeat = max(1, atoi(argv[++iArg]));
+		else if (arg == "--csv" && hasValue)		csvPath = argv[++iArg];
+		else if (arg == "--optimize")				isOptimized = true;
+		else if (arg == "--keep")					isKept = true;
+		else {
+			printf("Usage: %s [--max-triangles N] [--repeat N] [--optimize] [--csv file] [--keep]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	FILE* csv = fopen(csvPath.c_str(), "w");
+	if (! csv) {
+		printf("Can't write %s\n", csvPath.c_str());
+		return 1;
+	}
+	fprintf(csv, "model,loader,weld,triangles,file_mb,parse_ms,weld_ms,total_ms,mb_per_s,peak_rss_mb,vertices,vertices_culled\n");
+
+	struct Model { string name; size_t triangles; bool isSynthetic; };	// (triangles: as requested)
+	vector<Model> models = { { "viking_room", 0, false } };
+	for (size_t numTriangles : TriangleCounts)
+		if (numTriangles <= maxTriangles)
+			models.push_back({ "bench-grid-" + to_string(numTriangles), numTriangles, true });
+
+	FileSystem fileSystem;
+	string summary;
+	for (const Model& model : models) {
+		vector<string> written;
+		if (model.isSynthetic) {
+			Grid grid = gridFor(model.triangles);
+			string base = fileSystem.ModelFileFullPath(model.name);
+			printf("Writing %s (%zu triangles)...\n", model.name.c_str(), grid.numTriangles());
+			if (! writeOBJ(base + ".obj", grid) || ! writePLY(base + ".ply", grid) || ! writeGLB(base + ".glb", grid)) {
+				printf("Can't write synthetic models to %s\n", base.c_str());
+				return 1;
+			}
+			written = { base + ".obj", base + ".ply", base + ".glb" };
+		}
+		for (const LoaderPath& path : LoaderPaths) {
+			if (! model.isSynthetic && string(path.extension) != ".obj")
+				continue;
+			string filename = model.name + path.extension;
+			Result result = runBest(filename, path, isOptimized, repeat);
+			if (path.isCached)
+				remove(MeshCache::CachePathFor(fileSystem.ModelFileFullPath(filename)).c_str());
+			if (! result.isOK) {
+				summary += model.name + " " + path.name + ": FAILED\n";
+				continue;
+			}
+			const char* weld = (path.type == OBJ_FILE_TINY || path.type == OBJ_FILE_FAST || path.type == OBJ_FILE_STREAMED)
+							 ? (path.isCached ? "-" : path.weld == WELD_BY_INDEX ? "index"
+													   : path.weld == WELD_BY_TOLERANCE ? "tolerance" : "value") : "-";
+			const LoadTimings& t = result.timings;
+			double fileMB = t.fileBytes / (1024.0 * 1024.0);
+			char row[512];
+			snprintf(row, sizeof(row), "%s,%s,%s,%zu,%.2f,%.2f,%.2f,%.2f,%.1f,%.1f,%u,%d\n",
+					 model.name.c_str(), path.name, weld, (size_t) result.triangles,
+					 fileMB, 1000 * t.parse, 1000 * t.weld, 1000 * t.total,
+					 t.total > 0 ? fileMB / t.total : 0.0, result.peakRSS, result.vertices, result.culled);
+			fputs(row, csv);
+			fflush(csv);
+			summary += row;
+		}
+		if (! isKept)
+			for (const string& path : written)
+				remove(path.c_str());
+	}
+	fclose(csv);
+
+	printf("\nmodel,loader,weld,triangles,file_mb,parse_ms,weld_ms,total_ms,mb_per_s,peak_rss_mb,vertices,vertices_culled\n%s"
+		   "(also written to %s)\n", summary.c_str(), csvPath.c_str());
+	return 0;
+}
@@ -0,0 +1,273 @@
+//
+// AssetCooker.cpp
+//	Headless offline asset cooker
+//
+// Walks the viewer's models directory (and its subdirectories) and runs
+//	every model found - .obj, .ply, .glb - through the full ModelLoader
+//	pipeline: parse, weld, generate normals/bounds, optimize, and whatever
+//	else the options below ask for.  What comes out is the same MeshCache the
+//	viewer itself would write on first load, in the same place (the app's
+//	local storage, keyed by each model's full path), so the viewer then
+//	memory-maps it instead of parsing anything.
+// Models are cooked across all cores (each also spreading its own welding
+//	etc. over the shared WorkerPool).  Cooking is incremental: a model whose
+//	MeshCache is still valid - same source size and time, or else the same
+//	content hash (see MeshCache) - and was cooked with the options asked for
+//	is skipped, so a nightly run only reprocesses what changed.
+// Options must match what the viewer loads with (e.g. its ModelDefSpec
+//	asking for meshlets, or LODs, that a cache lacks makes it reload anyway).
+// Then the textures directory's .png files likewise, into each one's
+//	TextureCache: decoded, mipmapped and (optionally) block-compressed.
+// Usage:  AssetCooker [--viewer path] [--jobs N] [--weld value|index|tolerance] [--clustered]
+//					   [--lods N] [--tangents] [--quantize] [--split] [--compress]
+//					   [--textures raw|bc7|etc2|none] [--force]
+//	--viewer is the viewer's executable, whose models directory (and cache paths) to use; else our own.
+//	--jobs limits how many models are loaded at once (default: one per core), as each may need a lot of memory.
+//	--textures is how to compress them (default: raw, i.e. RGBA8), or none to not cook them.
+//	--force re-cooks everything.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "ModelLoader.h"
+#include "MeshCache.h"
+#include "TextureCache.h"
+#include "WorkerPool.h"
+#include "AppConstants.h"
+#include "Logging.h"
+#include <dirent.h>
+#include <strings.h>
+#include <sys/stat.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+
+struct ModelExtension {
+	const char*	extension;
+	SpecType	type;
+};
+
+static const ModelExtension ModelExtensions[] = {
+	{ ".obj", OBJ_FILE },
+	{ ".ply", PLY_BINARY },
+	{ ".glb", GLTF_BINARY },
+};
+
+static SpecType typeOf(const string& filename)
+{
+	size_t iDot = filename.find_last_of('.');
+	if (iDot == string::npos)
+		return UNSPECIFIED;
+	string extension = filename.substr(iDot);
+	for (char& c : extension)
+		c = (char) tolower(c);
+	for (const ModelExtension& model : ModelExtensions)
+		if (extension == model.extension)
+			return model.type;
+	return UNSPECIFIED;
+}
+
+static bool isModel(const string& filename)		{ return typeOf(filename) != UNSPECIFIED; }
+
+static bool isTexture(const string& filename)
+{
+	return filename.size() > 4 && strcasecmp(filename.c_str() + filename.size() - 4, ".png") == 0;
+}
+
+// Names relative to 'directory' (e.g. "vehicles/truck.obj") of every file beneath it that 'isWanted'.  (With
+//	dirent rather than <filesystem>, as LocalFileSystem.h explains.)
+//
+static void findFiles(const string& directory, const string& relative, bool (*isWanted)(const string&),
+					  vector<string>& names)
+{
+	DIR* pDir = opendir((directory + relative).c_str());
+	if (! pDir)
+		return;
+	while (struct dirent* pEntry = readdir(pDir)) {
+		string name = pEntry->d_name;
+		if (name == "." || name == ".." || name.empty() || name[0] == '.')
+			continue;
+		struct stat info;
+		if (stat((directory + relative + name).c_str(), &info) != 0)
+			continue;
+		if (S_ISDIR(info.st_mode))
+			findFiles(directory, relative + name + "/", isWanted, names);
+		else if (isWanted(name))
+			names.push_back(relative + name);
+	}
+	closedir(pDir);
+}
+
+
+enum CookResult {
+	COOKED,
+	UP_TO_DATE,
+	IN_PLACE,					// (a .glb the viewer draws straight from the file: nothing to cook)
+	FAILED
+};
+
+static const char* CookResultNames[] = { "cooked", "up to date", "loads in place", "FAILED" };
+
+struct Cooked {
+	string		name;
+	CookResult	result = FAILED;
+	double		seconds = 0.0;
+	uint32_t	vertices = 0;
+	uint32_t	triangles = 0;
+	uint64_t	cacheBytes = 0;
+};
+
+static CookResult cook(ModelDefSpec spec, bool isForced, Cooked& cooked)
+{
+	FileSystem fileSystem;
+	string cachePath = MeshCache::CachePathFor(fileSystem.ModelFileFullPath(spec.filename));
+	if (isForced)
+		remove(cachePath.c_str());
+
+	VertexDescriptionDynamic vertexDescriptor;
+	MeshObject mesh = { vertexDescriptor };
+	ModelLoader loader;
+	if (! loader.load(mesh, spec))
+		return FAILED;
+	cooked.seconds	 = loader.timings().total;
+	cooked.vertices	 = mesh.vertexCount;
+	cooked.triangles = mesh.indexCount / 3;
+	if (loader.timings().isFromCache)
+		return UP_TO_DATE;
+	struct stat info;
+	if (stat(cachePath.c_str(), &info) != 0)
+		return (spec.type == GLTF_BINARY) ? IN_PLACE : FAILED;
+	cooked.cacheBytes = info.st_size;
+	return COOKED;
+}
+
+
+// Every texture beneath the textures directory into its TextureCache, as many at once as there are cores;
+//	returns how many failed.
+//
+static size_t cookTextures(const TextureCacheOptions& options, bool isForced)
+{
+	FileSystem fileSystem;
+	string texturesDirectory = fileSystem.TextureFileFullPath("");
+	vector<string> names;
+	findFiles(texturesDirectory, "", isTexture, names);
+	if (names.empty()) {
+		printf("\nNo textures (.png) found in %s\n", texturesDirectory.c_str());
+		return 0;
+	}
+	printf("\nCooking %zu textures from %s\n", names.size(), texturesDirectory.c_str());
+
+	vector<string> fullPaths;
+	for (const string& name : names) {
+		fullPaths.push_back(texturesDirectory + name);
+		if (isForced)
+			remove(TextureCache::CachePathFor(fullPaths.back()).c_str());
+	}
+	auto start = std::chrono::steady_clock::now();
+	vector<PreparedTexture> prepared = TextureCache::PrepareMany(fullPaths, options);
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	size_t numCooked = 0, numUpToDate = 0, numFailed = 0;
+	printf("\n");
+	for (size_t iTexture = 0; iTexture < names.size(); ++iTexture) {
+		const PreparedTexture& texture = prepared[iTexture];
+		size_t& count = ! texture.isPrepared ? numFailed : texture.wasCached ? numUpToDate : numCooked;
+		++count;
+		const char* result = ! texture.isPrepared ? "FAILED" : texture.wasCached ? "up to date" : "cooked";
+		printf("%-40s %-15s %9.1f ms", names[iTexture].c_str(), result, 1000 * texture.seconds);
+		if (texture.isPrepared)
+			printf(" %9.1f MB", texture.cacheBytes / (1024.0 * 1024.0));
+		printf("\n");
+	}
+	printf("\n%zu cooked, %zu up to date, %zu failed; %.2f s\n", numCooked, numUpToDate, numFailed, seconds);
+	return numFailed;
+}
+
+
+int main(int argc, char* argv[])
+{
+	const char* exePath = argv[0];
+	ModelDefSpec options;
+	options.isOptimized = true;		// (as the viewer loads them)
+	TextureCacheOptions textureOptions;
+	bool isCookingTextures = true;
+	size_t numJobs = 0;
+	bool isForced = false;
+	for (int iArg = 1; iArg < argc; ++iArg) {
+		string arg = argv[iArg];
+		bool hasValue = iArg + 1 < argc;
+		if (arg == "--viewer" && hasValue)		exePath = argv[++iArg];
+		else if (arg == "--jobs" && hasValue)	numJobs = max(1, atoi(argv[++iArg]));
+		else if (arg == "--lods" && hasValue)	options.lodCount = max(0, atoi(argv[++iArg]));
+		else if (arg == "--weld" && hasValue) {
+			string weld = argv[++iArg];
+			options.weld = (weld == "index") ? WELD_BY_INDEX : (weld == "tolerance") ? WELD_BY_TOLERANCE : WELD_BY_VALUE;
+		}
+		else if (arg == "--clustered")			options.isClustered = true;
+		else if (arg == "--tangents")			options.isTangentSpace = true;
+		else if (arg == "--quantize")			options.isQuantized = true;
+		else if (arg == "--split")				options.isSplit = true;
+		else if (arg == "--compress")			options.isCompressed = true;
+		else if (arg == "--textures" && hasValue) {
+			string compression = argv[++iArg];
+			isCookingTextures = (compression != "none");
+			textureOptions.compression = (compression == "bc7") ? TEXTURE_BC7
+									   : (compression == "etc2") ? TEXTURE_ETC2 : TEXTURE_UNCOMPRESSED;
+		}
+		else if (arg == "--force")				isForced = true;
+		else {
+			printf("Usage: %s [--viewer path] [--jobs N] [--weld value|index|tolerance] [--clustered]\n"
+				   "       [--lods N] [--tangents] [--quantize] [--split] [--compress]\n"
+				   "       [--textures raw|bc7|etc2|none] [--force]\n", argv[0]);
+			return 1;
+		}
+	}
+	AppConstants.setExePath(exePath);		// (as in the viewer's main, for FileSystem's paths)
+	LogStartup();
+
+	FileSystem fileSystem;
+	string modelsDirectory = fileSystem.ModelFileFullPath("");
+	vector<string> names;
+	findFiles(modelsDirectory, "", isModel, names);
+	if (names.empty()) {
+		printf("No models (.obj, .ply, .glb) found in %s\n", modelsDirectory.c_str());
+		return 1;
+	}
+	printf("Cooking %zu models from %s\n", names.size(), modelsDirectory.c_str());
+
+	// Each job takes the next model until none are left; the pool's threads (and this one) run the jobs.
+	WorkerPool& pool = WorkerPool::Shared();
+	vector<Cooked> cooked(names.size());
+	std::atomic<size_t> iNext { 0 };
+	if (numJobs == 0)
+		numJobs = std::thread::hardware_concurrency();
+	auto start = std::chrono::steady_clock::now();
+	pool.parallelFor(min(numJobs, names.size()), [&](size_t) {
+		for (size_t iModel; (iModel = iNext.fetch_add(1)) < names.size(); ) {
+			ModelDefSpec spec = options;
+			spec.filename = names[iModel];
+			spec.type	  = typeOf(names[iModel]);
+			spec.isCached = true;
+			cooked[iModel].name	  = names[iModel];
+			cooked[iModel].result = cook(spec, isForced, cooked[iModel]);
+		}
+	});
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	size_t counts[FAILED + 1] = { };
+	printf("\n");
+	for (const Cooked& model : cooked) {
+		++counts[model.result];
+		printf("%-40s %-15s %10u vertices %10u triangles %9.1f ms", model.name.c_str(),
+			   CookResultNames[model.result], model.vertices, model.triangles, 1000 * model.seconds);
+		if (model.cacheBytes > 0)
+			printf(" %9.1f MB", model.cacheBytes / (1024.0 * 1024.0));
+		printf("\n");
+	}
+	printf("\n%zu cooked, %zu up to date, %zu in place, %zu failed; %.2f s\n",
+		   counts[COOKED], counts[UP_TO_DATE], counts[IN_PLACE], counts[FAILED], seconds);
+
+	size_t numTexturesFailed = isCookingTextures ? cookTextures(textureOptions, isForced) : 0;
+	return (counts[FAILED] > 0 || numTexturesFailed > 0) ? 1 : 0;
+}
@@ -26,34 +26,89 @@ void Application::Init()
 	platform.RegisterForceRenderCallback(Application::ForceUpdateRender, this);
 
 	instantiateGraphicsObject();
+	swapInPendingObject();
 }
 
+// Start creating the next object, whose model may load in the background while the current one keeps
+//	rendering; swapInPendingObject replaces it once loaded.  Ignored if the previous request hasn't finished.
+//
 void Application::instantiateGraphicsObject()
 {
-	Renderables& renderables = vulkan.command.renderables;
-
-	if (pObject3D) {
-		vkDeviceWaitIdle(vulkan.device.getLogical());
-		vulkan.command.RecreateBuffers(vulkan.framebuffers);
-		renderables.Remove(pObject3D);
-		delete pObject3D;
-	}
+	if (pPendingObject)
+		return;
 
 	switch(iNextObject) {
 		default:  iNextObject = 0;	// reset, and fallthru:
 		case 0:
-			pObject3D = new RenderableCubeTextured(camera.uboMVP);
+			pPendingObject = new RenderableCubeTextured(camera.uboMVP);
+			pendingLoad = { };
+			pPendingPickable = nullptr;
 			break;
-		case 1:
-			pObject3D = new RenderableTestModel(camera.uboMVP);
+		case 1: {
+			RenderableTestModel* pModel = new RenderableTestModel(camera.uboMVP);
+			pendingLoad = pModel->whenLoaded();
+			pPendingObject = pModel;
+			pPendingPickable = &pModel->bvh();
 			break;
+		}
 	}
 	++iNextObject;
+}
+
+// Called every frame; only once the pending object's model is fully loaded does the (brief) part needing
+//	the GPU happen: retiring the current object, and creating/uploading the new one's buffers.
+//
+void Application::swapInPendingObject()
+{
+	if (! pPendingObject)
+		return;
+	if (pendingLoad.valid()) {
+		if (pendingLoad.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			return;
+		if (! pendingLoad.get()) {
+			Log(ERROR, "Next object failed to load; keeping current one.");
+			delete pPendingObject;
+			pPendingObject = nullptr;
+			return;
+		}
+	}
+	Renderables& renderables = vulkan.command.renderables;
+
+	if (pObject3D) {
+		vkDeviceWaitIdle(vulkan.device.getLogical());
+		vulkan.command.RecreateBuffers(vulkan.framebuffers);
+		renderables.Remove(pObject3D);
+		delete pObject3D;
+	}
+	pObject3D = pPendingObject;
+	pPendingObject = nullptr;
+	pPickable = pPendingPickable;
 
 	renderables.Add(FixedRenderable(*pObject3D, vulkan, platform));
 	vulkan.command.PostInitPrepBuffers(vulkan);
 }
 
+// A tap on the current object picks the triangle under it (for now, just reporting which) instead of cycling
+//	to the next object, as a tap anywhere else does.
+//
+bool Application::pickAt(int atX, int atY)
+{
+	if (! pPickable || ! pPickable->isBuilt())
+		return false;
+
+	vec3 origin, direction;
+	camera.screenRay(atX, atY, origin, direction);
+	PickHit hit;
+	auto start = std::chrono::steady_clock::now();
+	if (! pPickable->intersect(&origin[0], &direction[0], hit))
+		return false;
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	Log(NOTE, "Picked triangle %u at distance %.3f (in %.1f microseconds)", hit.triangle,
+			  hit.distance * length(direction), 1e6 * seconds);
+	return true;
+}
+
 void Application::initPersistentValues()
 {
 	camera.initSeldomChangedValues();	// and simply use camera's default "failsafe" position
@@ -72,8 +127,10 @@ void Application::Run()
 		if (platform.IsWindowMinimizedOrHidden())
 			platform.AwaitEvent();
 
-		if (controlScheme.WasPrimaryShortPressed())
+		int atX, atY;
+		if (controlScheme.WasPrimaryShortPressed(atX, atY) && ! pickAt(atX, atY))
 			instantiateGraphicsObject();
+		swapInPendingObject();
 
 		updateRender();
 	}
@@ -27,6 +27,8 @@
 #include "GameClock.h"
 #include "gxCamera.h"
 #include "gxControlCameraLocked.h"
+#include "MeshBVH.h"
+#include <future>
 
 
 class Application
@@ -50,6 +52,7 @@ public:
 			controlScheme(camera, gameClock)
 	{
 		pObject3D = nullptr;
+		pPendingObject = nullptr;
 	}
 
 	~Application()			// Before destruction, in turn destroying child
@@ -58,6 +61,8 @@ public:
 
 		if (pObject3D)
 			delete pObject3D;
+		if (pPendingObject)			// (its loader waits for any load in progress)
+			delete pPendingObject;
 	}
 
 		// lesser MEMBERS
@@ -73,6 +78,10 @@ private:
 
 	// Implementation
 	DrawableSpecifier*	pObject3D;
+	DrawableSpecifier*	pPendingObject;	// next object, still loading in background
+	std::shared_future<bool> pendingLoad;	//	(invalid if it needn't)
+	const MeshBVH*		pPickable = nullptr;		// current object's triangles, if it can be picked,
+	const MeshBVH*		pPendingPickable = nullptr;	//	and next one's
 	int					iNextObject = 0;
 	GameClock			gameClock;
 	gxCamera			camera;
@@ -93,6 +102,8 @@ public:
 private:
 	void initPersistentValues();
 	void instantiateGraphicsObject();
+	void swapInPendingObject();
+	bool pickAt(int atX, int atY);
 	void updateGameElements(float deltaSeconds);
 
 	void updateRender();
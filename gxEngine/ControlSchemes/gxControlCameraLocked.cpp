@@ -55,6 +55,7 @@ void gxControlCameraLocked::handlePrimaryPressUp(int atX, int atY)
 		//TJ_TODO: soon, add support to recognize Directional SWIPE !!!
 		//TJ_TODO:	oh also... add support for DOUBLE-CLICK/DOUBLE-TAP!
 		isPrimaryShortPress = true;
+		shortPressX = atX;  shortPressY = atY;
 	} else {
 		if (abs(atX - pressX) <= MAXIMUM_XY_MOVE_LONG_PRESS && abs(atY - pressY) <= MAXIMUM_XY_MOVE_LONG_PRESS)
 		{
@@ -37,6 +37,8 @@ public:
 	bool WasPrimaryShortPressed()		{ bool wasPrimaryShortPress = isPrimaryShortPress;
 		 /* This is a ONE SHOT! */		  isPrimaryShortPress = false;
 		 /*	Only resets once read. */	  return wasPrimaryShortPress; }
+	bool WasPrimaryShortPressed(int& atX, int& atY)	{ atX = shortPressX;  atY = shortPressY;	// (and where, e.g.
+													  return WasPrimaryShortPressed(); }		//	to pick with)
 
 protected:
 	void mimicZooming(float factor);
@@ -51,4 +53,5 @@ private:
 	int		pressX, pressY;
 
 	bool	isPrimaryShortPress = false;
+	int		shortPressX = 0, shortPressY = 0;
 };
@@ -68,6 +68,39 @@ void gxCamera::updateViewMatrix()
 }
 
 
+// Roughly how many pixels tall one world unit appears at this point's distance from the camera, e.g. to choose
+//	a model's level-of-detail (see MeshSimplifier::SelectLOD).  The projection's proj[1][1] is cot(verticalFOV/2),
+//	so one unit at distance d spans proj[1][1] / d of the screen's half-height.
+//
+float gxCamera::pixelsPerUnitAt(vec3 worldPoint)
+{
+	float distance = glm::distance(worldPoint, position3D);
+	if (distance < zNearPlane)
+		distance = zNearPlane;
+	return fabsf(MVP.proj[1][1]) * 0.5f * previousScreenHeight / distance;
+}
+
+
+// Ray from this camera through a point on screen (in pixels from its top left, as are the swapchain's) into
+//	the space the current model is in, e.g. to pick what's tapped on (see MeshBVH).  The point is unprojected
+//	onto the far plane, through the inverse of the whole model-view-projection (whose flipped Y, for Vulkan,
+//	already matches screen Y running down); the ray starts at the camera, and 'direction' reaches that far
+//	point (so isn't normalized).
+//
+void gxCamera::screenRay(int atX, int atY, vec3& origin, vec3& direction)
+{
+	mat4 model = MVP.model;
+	mat4 unproject = inverse(MVP.proj * MVP.view * model);
+	float x = 2.0f * (atX + 0.5f) / previousScreenWidth - 1.0f;
+	float y = 2.0f * (atY + 0.5f) / previousScreenHeight - 1.0f;
+	vec4 farPoint = unproject * vec4(x, y, 1.0f, 1.0f);
+	vec4 eye = inverse(model) * vec4(position3D, 1.0f);
+
+	origin	  = vec3(eye) / eye.w;
+	direction = vec3(farPoint) / farPoint.w - origin;
+}
+
+
 // First-time setup for drawing: mainly dereference variables that loop will use continually, so it
 //	doesn't have to repeatedly.  Also init big objects (e.g. matrices) that don't change every frame.
 //
@@ -95,6 +95,8 @@ public:
 	float adjustedFOVperOrientation(float landscapeVerticalFOV, float aspectRatio);
 	void  updateViewMatrix();
 	void  initSeldomChangedValues();
+	float pixelsPerUnitAt(vec3 worldPoint);
+	void  screenRay(int atX, int atY, vec3& origin, vec3& direction);
 
 		// getters
 	float getCurrentScreenWidth()	{ return previousScreenWidth; }
@@ -0,0 +1,48 @@
+//
+// Simple Lambert diffuse shader, for quantized vertices
+//	As "mvp+normal=diffuse.vert" but reading ModelLoader's compact vertex
+//	layout (see VertexQuantizer.h).
+// Inputs: MVP UBO, dequantizing transform push constant, XYZ vertex
+//		   coordinate (16-bit snorm, or float), octahedral-encoded normal
+// Output: intensity (at this position interpolated between the face's
+//					  3 vertices and 3 normal vectors at those vertices)
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+
+layout(binding = 0) uniform UniformBufferObject {
+	mat4 model;
+	mat4 view;
+	mat4 proj;
+} ubo;
+
+layout(push_constant) uniform Dequantize {		// QuantizedVertexFormat's dequantizeScale/Offset
+	vec4 scale;									//	(w unused)
+	vec4 offset;
+} dequantize;
+
+layout(location = 0) in vec4 inPosition;	// XYZ, in -1..1 across the mesh's bounding box (W padding)
+layout(location = 1) in vec2 inNormal;		// normal vector folded onto octahedron, then flattened
+
+layout(location = 0) out float fragDiffusity;
+
+vec3 octahedralDecode(vec2 encoded) {
+	vec3 normal = vec3(encoded, 1.0 - abs(encoded.x) - abs(encoded.y));
+	float fold = max(-normal.z, 0.0);			// (lower hemisphere was folded out over the corners)
+	normal.xy += mix(vec2(fold), vec2(-fold), greaterThanEqual(normal.xy, vec2(0.0)));
+	return normalize(normal);
+}
+
+void main() {
+	const vec3 lightVector = normalize(vec3(0, 2, 1));	// points AT light source
+	const float ambient = 0.2;
+
+	vec3 position = dequantize.offset.xyz + dequantize.scale.xyz * inPosition.xyz;
+
+	mat4 modelView = ubo.view * ubo.model;
+	gl_Position = ubo.proj * modelView * vec4(position, 1.0);
+
+	vec3 modelviewNormalVector = mat3(modelView) * octahedralDecode(inNormal);
+	vec3 viewLightVector = mat3(ubo.view) * lightVector;
+
+	fragDiffusity = max(0.0, dot(modelviewNormalVector, viewLightVector)) + ambient;
+}
@@ -0,0 +1,54 @@
+//
+// Texture-mapped diffuse-shaded Vertex shader, for quantized vertices
+//	As "uv,mvp+norm=diffuv.vert" but reading ModelLoader's compact vertex
+//	layout (see VertexQuantizer.h):
+//	Inputs: MVP UBO, dequantizing transform push constant,
+//			XYZ vertex (16-bit snorm, or float), octahedral-encoded normal
+//			(2 16-bit snorms), UV texture coordinates (half, or float)
+//	Outputs to Fragment shader:
+//		Intensity value from simplistically calculated Lambert shading.
+//		Texture coordinate passed-through as-is.
+//
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+
+layout(binding = 0) uniform UniformBufferObject {
+    mat4 model;
+    mat4 view;
+    mat4 proj;
+} ubo;
+
+layout(push_constant) uniform Dequantize {		// QuantizedVertexFormat's dequantizeScale/Offset
+	vec4 scale;									//	(w unused)
+	vec4 offset;
+} dequantize;
+											// Per QuantizedVertexFormat, for each vertex:
+layout(location = 0) in vec4 inPosition;		// XYZ, in -1..1 across the mesh's bounding box (W padding)
+layout(location = 1) in vec2 inNormal;			// normal vector folded onto octahedron, then flattened
+layout(location = 2) in vec2 inTexCoord;		// UV texture coordinate
+
+layout(location = 0) out vec2 fragTexCoord;
+layout(location = 1) out float fragIntensity;	// Diffuse-shaded
+
+vec3 octahedralDecode(vec2 encoded) {
+	vec3 normal = vec3(encoded, 1.0 - abs(encoded.x) - abs(encoded.y));
+	float fold = max(-normal.z, 0.0);			// (lower hemisphere was folded out over the corners)
+	normal.xy += mix(vec2(fold), vec2(-fold), greaterThanEqual(normal.xy, vec2(0.0)));
+	return normalize(normal);
+}
+
+void main() {
+	const vec3 lightVector = normalize(vec3(0, 2, 1));	// points AT light source
+	const float ambient = 0.2;
+
+	vec3 position = dequantize.offset.xyz + dequantize.scale.xyz * inPosition.xyz;
+
+	mat4 modelView = ubo.view * ubo.model;
+	gl_Position = ubo.proj * modelView * vec4(position, 1.0);
+
+	vec3 modelviewNormalVector = mat3(modelView) * octahedralDecode(inNormal);
+	vec3 viewLightVector = mat3(ubo.view) * lightVector;
+
+	fragIntensity = max(0.0, dot(modelviewNormalVector, viewLightVector)) + ambient;
+	fragTexCoord = inTexCoord;
+}
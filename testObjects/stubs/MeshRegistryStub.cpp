@@ -0,0 +1,28 @@
+//
+// MeshRegistryStub.cpp
+//	Vulkan Convenience 3D Objects
+//
+// Empty implementation, to go with ModelLoaderStub: nothing is ever loaded.
+//
+// Created 10/17/26
+//	© 0000 (uncopyrighted; use at will)
+//
+#include "MeshRegistry.h"
+
+
+MeshRegistry& MeshRegistry::Shared()
+{
+	static MeshRegistry shared;
+	return shared;
+}
+
+std::shared_future<bool> MeshRegistry::loadAsync(MeshObject& mesh, ModelDefSpec modelSpec, MeshHandle& handle)
+{
+	handle = std::make_shared<RegisteredMesh>();
+	std::promise<bool> loaded;
+	loaded.set_value(false);
+	return loaded.get_future().share();
+}
+
+void MeshRegistry::setBudget(size_t maxBytes)  { budgetBytes = maxBytes; }
+void MeshRegistry::clear()  { }
@@ -10,4 +10,24 @@
 #include "ModelLoader.h"
 
 
-void ModelLoader::load(MeshObject& mesh, string nameOBJFile)  { }
+static std::shared_future<bool> notLoaded()
+{
+	std::promise<bool> loaded;
+	loaded.set_value(false);
+	return loaded.get_future().share();
+}
+
+ModelLoader::~ModelLoader()  { }
+bool ModelLoader::load(MeshObject& mesh, string nameOBJFile)  { return false; }
+bool ModelLoader::load(MeshObject& mesh, ModelDefSpec modelSpec, MeshSink* pMeshSink)  { return false; }
+std::shared_future<bool> ModelLoader::loadAsync(MeshObject& mesh, ModelDefSpec modelSpec,
+												LoadProgressCallback onProgress, MeshSink* pMeshSink)  { return notLoaded(); }
+bool ModelLoader::LoadMany(vector<BatchedLoad>& batch, LoadProgressCallback onProgress)  { return false; }
+MeshIndexType ModelLoader::indexType()  { return meshIndexType; }
+uint32_t ModelLoader::vertexStride()  { return 0; }
+uint32_t ModelLoader::VertexStride(AttributeBits attribits)  { return 0; }
+AttributeBits ModelLoader::loadTinyObj(string nameOBJFile, WeldMode weldMode)  { return 0; }
+AttributeBits ModelLoader::loadFastObj(string nameOBJFile, WeldMode weldMode)  { return 0; }
+AttributeBits ModelLoader::loadStreamedObj(string nameOBJFile, WeldMode weldMode, size_t memoryLimitMB)  { return 0; }
+AttributeBits ModelLoader::loadGlb(string nameGLBFile)  { return 0; }
+AttributeBits ModelLoader::loadPly(string namePLYFile)  { return 0; }